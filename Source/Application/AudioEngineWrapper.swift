@@ -69,6 +69,42 @@ func AudioEngine_SetSendReturnLevel(_ handle: OpaquePointer, _ sendIndex: Int32,
 @_silgen_name("AudioEngine_GetCPULoad")
 func AudioEngine_GetCPULoad(_ handle: OpaquePointer) -> Float
 
+@_silgen_name("AudioEngine_GetDroppedParameterCommandCount")
+func AudioEngine_GetDroppedParameterCommandCount(_ handle: OpaquePointer) -> UInt64
+
+@_silgen_name("AudioEngine_GetRenderStageCount")
+func AudioEngine_GetRenderStageCount() -> Int32
+
+@_silgen_name("AudioEngine_GetRenderStageName")
+func AudioEngine_GetRenderStageName(_ stage: Int32) -> UnsafePointer<CChar>?
+
+@_silgen_name("AudioEngine_GetRenderStageStats")
+func AudioEngine_GetRenderStageStats(_ handle: OpaquePointer, _ path: Int32, _ stage: Int32, _ meanLoad: UnsafeMutablePointer<Float>?, _ p99Load: UnsafeMutablePointer<Float>?, _ maxLoad: UnsafeMutablePointer<Float>?, _ meanNsPerSample: UnsafeMutablePointer<Float>?) -> Bool
+
+@_silgen_name("AudioEngine_GetDeadlineMissCount")
+func AudioEngine_GetDeadlineMissCount(_ handle: OpaquePointer, _ path: Int32) -> UInt64
+
+@_silgen_name("AudioEngine_ResetRenderProfiler")
+func AudioEngine_ResetRenderProfiler(_ handle: OpaquePointer)
+
+@_silgen_name("AudioEngine_SetRenderWorkerCount")
+func AudioEngine_SetRenderWorkerCount(_ handle: OpaquePointer, _ count: Int32)
+
+@_silgen_name("AudioEngine_GetRenderWorkerCount")
+func AudioEngine_GetRenderWorkerCount(_ handle: OpaquePointer) -> Int32
+
+@_silgen_name("AudioEngine_SetPlaitsVoiceCount")
+func AudioEngine_SetPlaitsVoiceCount(_ handle: OpaquePointer, _ count: Int32)
+
+@_silgen_name("AudioEngine_GetPlaitsVoiceCount")
+func AudioEngine_GetPlaitsVoiceCount(_ handle: OpaquePointer) -> Int32
+
+@_silgen_name("AudioEngine_SetDrumHitCacheEnabled")
+func AudioEngine_SetDrumHitCacheEnabled(_ handle: OpaquePointer, _ enabled: Bool)
+
+@_silgen_name("AudioEngine_IsDrumHitCacheEnabled")
+func AudioEngine_IsDrumHitCacheEnabled(_ handle: OpaquePointer) -> Bool
+
 @_silgen_name("AudioEngine_TriggerPlaits")
 func AudioEngine_TriggerPlaits(_ handle: OpaquePointer, _ state: Bool)
 
@@ -105,18 +141,45 @@ func AudioEngine_ScheduleNoteOffTargetTagged(_ handle: OpaquePointer, _ note: In
 @_silgen_name("AudioEngine_ClearScheduledNotes")
 func AudioEngine_ClearScheduledNotes(_ handle: OpaquePointer)
 
+@_silgen_name("AudioEngine_ScheduleParameter")
+func AudioEngine_ScheduleParameter(_ handle: OpaquePointer, _ parameterId: Int32, _ voiceIndex: Int32, _ value: Float, _ sampleTime: UInt64)
+
+@_silgen_name("AudioEngine_ScheduleClockStartSample")
+func AudioEngine_ScheduleClockStartSample(_ handle: OpaquePointer, _ startSample: UInt64, _ sampleTime: UInt64)
+
+@_silgen_name("AudioEngine_ScheduleTrigger")
+func AudioEngine_ScheduleTrigger(_ handle: OpaquePointer, _ trigger: Int32, _ laneIndex: Int32, _ state: Bool, _ sampleTime: UInt64)
+
+@_silgen_name("AudioEngine_ScheduleReelOperation")
+func AudioEngine_ScheduleReelOperation(_ handle: OpaquePointer, _ operation: Int32, _ index: Int32, _ value: Float, _ sampleTime: UInt64)
+
 @_silgen_name("AudioEngine_GetCurrentSampleTime")
 func AudioEngine_GetCurrentSampleTime(_ handle: OpaquePointer) -> UInt64
 
 @_silgen_name("AudioEngine_LoadAudioData")
 func AudioEngine_LoadAudioData(_ handle: OpaquePointer, _ reelIndex: Int32, _ leftChannel: UnsafePointer<Float>?, _ rightChannel: UnsafePointer<Float>?, _ numSamples: Int, _ sampleRate: Float) -> Bool
 
+@_silgen_name("AudioEngine_LoadAudioFile")
+func AudioEngine_LoadAudioFile(_ handle: OpaquePointer, _ reelIndex: Int32, _ filePath: UnsafePointer<CChar>) -> Bool
+
+@_silgen_name("AudioEngine_GetReelLoadProgress")
+func AudioEngine_GetReelLoadProgress(_ handle: OpaquePointer, _ reelIndex: Int32) -> Float
+
 @_silgen_name("AudioEngine_ClearReel")
 func AudioEngine_ClearReel(_ handle: OpaquePointer, _ reelIndex: Int32)
 
 @_silgen_name("AudioEngine_GetReelLength")
 func AudioEngine_GetReelLength(_ handle: OpaquePointer, _ reelIndex: Int32) -> Int
 
+@_silgen_name("AudioEngine_GetReelMemoryUsage")
+func AudioEngine_GetReelMemoryUsage(_ handle: OpaquePointer, _ reelIndex: Int32) -> Int
+
+@_silgen_name("AudioEngine_GetTotalReelMemoryUsage")
+func AudioEngine_GetTotalReelMemoryUsage(_ handle: OpaquePointer) -> Int
+
+@_silgen_name("AudioEngine_GetReelDroppedRecordFrames")
+func AudioEngine_GetReelDroppedRecordFrames(_ handle: OpaquePointer, _ reelIndex: Int32) -> UInt64
+
 @_silgen_name("AudioEngine_GetReelSampleRate")
 func AudioEngine_GetReelSampleRate(_ handle: OpaquePointer, _ reelIndex: Int32) -> Float
 
@@ -141,6 +204,9 @@ func AudioEngine_GetGranularPosition(_ handle: OpaquePointer, _ voiceIndex: Int3
 @_silgen_name("AudioEngine_GetChannelLevel")
 func AudioEngine_GetChannelLevel(_ handle: OpaquePointer, _ channelIndex: Int32) -> Float
 
+@_silgen_name("AudioEngine_GetChannelRMSLevel")
+func AudioEngine_GetChannelRMSLevel(_ handle: OpaquePointer, _ channelIndex: Int32) -> Float
+
 @_silgen_name("AudioEngine_GetMasterLevel")
 func AudioEngine_GetMasterLevel(_ handle: OpaquePointer, _ channel: Int32) -> Float
 
@@ -291,6 +357,21 @@ func AudioEngine_IsMasterCaptureActive(_ handle: OpaquePointer) -> Bool
 @_silgen_name("AudioEngine_ReadMasterCaptureBuffer")
 func AudioEngine_ReadMasterCaptureBuffer(_ handle: OpaquePointer, _ left: UnsafeMutablePointer<Float>?, _ right: UnsafeMutablePointer<Float>?, _ maxFrames: Int32) -> Int32
 
+// Offline render
+typealias AudioEngine_OfflineBlockCallback = @convention(c) (UnsafeMutableRawPointer?, UInt64, Int32) -> Void
+
+@_silgen_name("AudioEngine_RenderOffline")
+func AudioEngine_RenderOffline(_ handle: OpaquePointer, _ wavPath: UnsafePointer<CChar>, _ numFrames: UInt64, _ bitsPerSample: Int32, _ callback: AudioEngine_OfflineBlockCallback?, _ context: UnsafeMutableRawPointer?) -> Bool
+
+@_silgen_name("AudioEngine_CancelOfflineRender")
+func AudioEngine_CancelOfflineRender(_ handle: OpaquePointer)
+
+@_silgen_name("AudioEngine_IsOfflineRenderActive")
+func AudioEngine_IsOfflineRenderActive(_ handle: OpaquePointer) -> Bool
+
+@_silgen_name("AudioEngine_GetOfflineRenderProgress")
+func AudioEngine_GetOfflineRenderProgress(_ handle: OpaquePointer) -> Float
+
 // Drum sequencer lane control
 @_silgen_name("AudioEngine_TriggerDrumSeqLane")
 func AudioEngine_TriggerDrumSeqLane(_ handle: OpaquePointer, _ lane: Int32, _ state: Bool)
@@ -345,6 +426,30 @@ func AudioEngine_UnloadWavSampler(_ handle: OpaquePointer)
 @_silgen_name("AudioEngine_GetWavSamplerInstrumentName")
 func AudioEngine_GetWavSamplerInstrumentName(_ handle: OpaquePointer) -> UnsafePointer<CChar>?
 
+@_silgen_name("AudioEngine_SetSamplerStreamingEnabled")
+func AudioEngine_SetSamplerStreamingEnabled(_ handle: OpaquePointer, _ enabled: Bool)
+
+@_silgen_name("AudioEngine_IsSamplerStreamingEnabled")
+func AudioEngine_IsSamplerStreamingEnabled(_ handle: OpaquePointer) -> Bool
+
+@_silgen_name("AudioEngine_GetSamplerStreamStarvationCount")
+func AudioEngine_GetSamplerStreamStarvationCount(_ handle: OpaquePointer) -> UInt64
+
+@_silgen_name("AudioEngine_SetSamplerCompactStorageEnabled")
+func AudioEngine_SetSamplerCompactStorageEnabled(_ handle: OpaquePointer, _ enabled: Bool)
+
+@_silgen_name("AudioEngine_IsSamplerCompactStorageEnabled")
+func AudioEngine_IsSamplerCompactStorageEnabled(_ handle: OpaquePointer) -> Bool
+
+@_silgen_name("AudioEngine_SetSamplerCacheDirectory")
+func AudioEngine_SetSamplerCacheDirectory(_ handle: OpaquePointer, _ path: UnsafePointer<CChar>?)
+
+@_silgen_name("AudioEngine_GetSamplerLoadProgress")
+func AudioEngine_GetSamplerLoadProgress(_ handle: OpaquePointer) -> Float
+
+@_silgen_name("AudioEngine_CancelSamplerLoad")
+func AudioEngine_CancelSamplerLoad(_ handle: OpaquePointer)
+
 @_silgen_name("AudioEngine_SetSamplerMode")
 func AudioEngine_SetSamplerMode(_ handle: OpaquePointer, _ mode: Int32)
 
@@ -661,6 +766,14 @@ class AudioEngineWrapper: ObservableObject {
         // Initialize C++ engine
         if let handle = cppEngineHandle {
             _ = AudioEngine_Initialize(handle, Int32(sampleRate), Int32(bufferSize))
+
+            // Decoded WAV/SFZ instruments are cached here and memory-mapped on the next load
+            if let caches = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first {
+                let instrumentCache = caches.appendingPathComponent("Grainulator/Instruments", isDirectory: true)
+                if (try? FileManager.default.createDirectory(at: instrumentCache, withIntermediateDirectories: true)) != nil {
+                    AudioEngine_SetSamplerCacheDirectory(handle, instrumentCache.path)
+                }
+            }
         }
 
         // Setup audio graph based on mode.
@@ -1733,6 +1846,12 @@ class AudioEngineWrapper: ObservableObject {
         }
     }
 
+    /// Smoothed post-gain RMS level for a mixer channel (0 when the engine is not running).
+    func getChannelRMSLevel(_ channelIndex: Int) -> Float {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetChannelRMSLevel(handle, Int32(channelIndex))
+    }
+
     /// Gets a send return level using thread-safe slot access.
     func getSendReturnLevel(busIndex: Int) -> Float {
         let slot = busIndex == 0 ? sendDelaySlot : sendReverbSlot
@@ -1964,7 +2083,7 @@ class AudioEngineWrapper: ObservableObject {
 
         // --- Batch-read all C++ values into local vars (no @Published writes yet) ---
 
-        let newCpuLoad = ProcessInfo.processInfo.systemUptime.truncatingRemainder(dividingBy: 100.0) / 4.0
+        let newCpuLoad = Double(AudioEngine_GetCPULoad(handle)) * 100.0
         let newLatency = (Double(bufferSize) / sampleRate) * 1000.0
 
         // Channel levels (8 channels)
@@ -2275,13 +2394,31 @@ class AudioEngineWrapper: ObservableObject {
         return AudioEngine_GetParameter(handle, cppParameterID(for: id), Int32(voiceIndex))
     }
 
+    /// Parameter changes dropped because the audio thread fell behind the command queue
+    func getDroppedParameterCommandCount() -> UInt64 {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetDroppedParameterCommandCount(handle)
+    }
+
     func getCompressorGainReduction() -> Float {
         guard let handle = cppEngineHandle else { return 0 }
         return AudioEngine_GetCompressorGainReduction(handle)
     }
 
     func loadAudioFile(url: URL, reelIndex: Int) {
-        // Load audio file asynchronously
+        // WAV/AIFF stream in natively; the reel plays while the rest decodes
+        if let handle = cppEngineHandle,
+           url.withUnsafeFileSystemRepresentation({ path in
+               path.map { AudioEngine_LoadAudioFile(handle, Int32(reelIndex), $0) } ?? false
+           }) {
+            print("✓ Streaming audio file: \(url.lastPathComponent)")
+            loadedAudioFilePaths[reelIndex] = url
+            reelBufferDirty.remove(reelIndex)
+            monitorReelLoad(reelIndex: reelIndex, url: url)
+            return
+        }
+
+        // Other formats (MP3, AAC, FLAC...) are decoded by AVFoundation
         Task.detached { [weak self] in
             guard let self = self else { return }
 
@@ -2351,6 +2488,30 @@ class AudioEngineWrapper: ObservableObject {
         }
     }
 
+    /// Refreshes a streaming reel's waveform as it fills, until the load ends
+    private func monitorReelLoad(reelIndex: Int, url: URL) {
+        Task { @MainActor [weak self] in
+            while let self = self, let handle = self.cppEngineHandle {
+                let progress = AudioEngine_GetReelLoadProgress(handle, Int32(reelIndex))
+                self.updateWaveformOverview(reelIndex: reelIndex)
+                if progress < 0 {
+                    print("✗ Failed to decode audio file: \(url.lastPathComponent)")
+                    return
+                }
+                if progress >= 1 {
+                    return
+                }
+                try? await Task.sleep(nanoseconds: 250_000_000) // 250ms
+            }
+        }
+    }
+
+    /// Gets the streaming load progress of a reel (0-1, 1 when idle, -1 on failure)
+    func getReelLoadProgress(_ reelIndex: Int) -> Float {
+        guard let handle = cppEngineHandle else { return 1 }
+        return AudioEngine_GetReelLoadProgress(handle, Int32(reelIndex))
+    }
+
     /// Clears the audio buffer for a reel
     func clearReel(_ reelIndex: Int) {
         guard let handle = cppEngineHandle else { return }
@@ -2366,6 +2527,24 @@ class AudioEngineWrapper: ObservableObject {
         return AudioEngine_GetReelLength(handle, Int32(reelIndex))
     }
 
+    /// Gets the resident memory (bytes) held by a reel: its audio pages and the reel itself
+    func getReelMemoryUsage(_ reelIndex: Int) -> Int {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetReelMemoryUsage(handle, Int32(reelIndex))
+    }
+
+    /// Gets the resident memory (bytes) held by all reels, including the warm page reserve
+    func getTotalReelMemoryUsage() -> Int {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetTotalReelMemoryUsage(handle)
+    }
+
+    /// Recorded frames a reel lost because reel memory ran out
+    func getReelDroppedRecordFrames(_ reelIndex: Int) -> UInt64 {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetReelDroppedRecordFrames(handle, Int32(reelIndex))
+    }
+
     /// Gets the sample rate of a reel buffer
     func getReelSampleRate(_ reelIndex: Int) -> Float {
         guard let handle = cppEngineHandle else { return 48000 }
@@ -2683,6 +2862,31 @@ class AudioEngineWrapper: ObservableObject {
         }
     }
 
+    /// Bounce the master mix to a WAV file faster than real time.
+    /// Events already scheduled on the engine's sample clock play back in place;
+    /// live output is silent until the bounce finishes. Returns false on failure
+    /// or cancellation.
+    func renderOffline(to url: URL, durationSeconds: Double, bitsPerSample: Int = 24) async -> Bool {
+        guard let handle = cppEngineHandle else { return false }
+        let frames = UInt64(max(0, durationSeconds * sampleRate))
+        let path = url.path
+        return await Task.detached(priority: .userInitiated) {
+            AudioEngine_RenderOffline(handle, path, frames, Int32(bitsPerSample), nil, nil)
+        }.value
+    }
+
+    /// Stop a running offline bounce (its file is deleted)
+    func cancelOfflineRender() {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_CancelOfflineRender(handle)
+    }
+
+    /// Progress of the running offline bounce (0-1)
+    func getOfflineRenderProgress() -> Float {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetOfflineRenderProgress(handle)
+    }
+
     /// Stop recording the master output and finalize the WAV file.
     func stopMasterRecording() {
         guard let handle = cppEngineHandle else { return }
@@ -2746,6 +2950,73 @@ class AudioEngineWrapper: ObservableObject {
         return Int(AudioEngine_GetActiveGrainCount(handle))
     }
 
+    struct RenderStageStats {
+        let name: String
+        let meanLoad: Float       // Fraction of the callback deadline
+        let p99Load: Float
+        let maxLoad: Float        // Peak since last reset
+        let meanNsPerSample: Float
+    }
+
+    /// Per-stage DSP load for the mixed (path 0) or multi-channel (path 1) render.
+    func getRenderStageStats(path: Int = 0) -> [RenderStageStats] {
+        guard let handle = cppEngineHandle else { return [] }
+        var result: [RenderStageStats] = []
+        for stage in 0..<AudioEngine_GetRenderStageCount() {
+            var mean: Float = 0, p99: Float = 0, peak: Float = 0, ns: Float = 0
+            guard AudioEngine_GetRenderStageStats(handle, Int32(path), stage, &mean, &p99, &peak, &ns) else { continue }
+            let name = AudioEngine_GetRenderStageName(stage).map { String(cString: $0) } ?? "\(stage)"
+            result.append(RenderStageStats(name: name, meanLoad: mean, p99Load: p99, maxLoad: peak, meanNsPerSample: ns))
+        }
+        return result
+    }
+
+    func getDeadlineMissCount(path: Int = 0) -> UInt64 {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetDeadlineMissCount(handle, Int32(path))
+    }
+
+    func resetRenderProfiler() {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_ResetRenderProfiler(handle)
+    }
+
+    /// Number of helper threads rendering voices in parallel (0 = audio thread only).
+    var renderWorkerCount: Int {
+        get {
+            guard let handle = cppEngineHandle else { return 0 }
+            return Int(AudioEngine_GetRenderWorkerCount(handle))
+        }
+        set {
+            guard let handle = cppEngineHandle else { return }
+            AudioEngine_SetRenderWorkerCount(handle, Int32(newValue))
+        }
+    }
+
+    /// Plaits voices available to new notes (1-16, default 1); the channel is scaled by 1/sqrt(count).
+    var plaitsVoiceCount: Int {
+        get {
+            guard let handle = cppEngineHandle else { return 1 }
+            return Int(AudioEngine_GetPlaitsVoiceCount(handle))
+        }
+        set {
+            guard let handle = cppEngineHandle else { return }
+            AudioEngine_SetPlaitsVoiceCount(handle, Int32(newValue))
+        }
+    }
+
+    /// Drum sequencer lanes play repeated, unmodulated hits from pre-rendered buffers.
+    var drumHitCacheEnabled: Bool {
+        get {
+            guard let handle = cppEngineHandle else { return false }
+            return AudioEngine_IsDrumHitCacheEnabled(handle)
+        }
+        set {
+            guard let handle = cppEngineHandle else { return }
+            AudioEngine_SetDrumHitCacheEnabled(handle, newValue)
+        }
+    }
+
     func triggerPlaits(_ state: Bool) {
         let eventSample = currentSampleTime() + liveEventLeadSamples
         if state {
@@ -2981,6 +3252,49 @@ class AudioEngineWrapper: ObservableObject {
 
     // MARK: - WAV Sampler (mx.samples)
 
+    /// Stream sample bodies from disk; applies to instruments loaded afterwards
+    var samplerStreamingEnabled: Bool {
+        get {
+            guard let handle = cppEngineHandle else { return false }
+            return AudioEngine_IsSamplerStreamingEnabled(handle)
+        }
+        set {
+            guard let handle = cppEngineHandle else { return }
+            AudioEngine_SetSamplerStreamingEnabled(handle, newValue)
+        }
+    }
+
+    /// Hold SF2/WAV/SFZ samples as 16/24-bit integers (about half the memory);
+    /// applies to instruments loaded afterwards
+    var samplerCompactStorageEnabled: Bool {
+        get {
+            guard let handle = cppEngineHandle else { return false }
+            return AudioEngine_IsSamplerCompactStorageEnabled(handle)
+        }
+        set {
+            guard let handle = cppEngineHandle else { return }
+            AudioEngine_SetSamplerCompactStorageEnabled(handle, newValue)
+        }
+    }
+
+    /// Voice-blocks that played silence because the disk fell behind
+    func getSamplerStreamStarvationCount() -> UInt64 {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetSamplerStreamStarvationCount(handle)
+    }
+
+    /// Progress (0-1) of the WAV/SFZ instrument load in flight, for polling while it runs
+    var samplerLoadProgress: Float {
+        guard let handle = cppEngineHandle else { return 0 }
+        return AudioEngine_GetSamplerLoadProgress(handle)
+    }
+
+    /// Abandon the instrument load in flight; the current instrument stays loaded
+    func cancelSamplerLoad() {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_CancelSamplerLoad(handle)
+    }
+
     /// Load a WAV instrument from a directory of mx.samples format WAV files
     func loadWavSampler(directory: URL) {
         let path = directory.path
@@ -3101,6 +3415,30 @@ class AudioEngineWrapper: ObservableObject {
         AudioEngine_ClearScheduledNotes(handle)
     }
 
+    /// Schedules a parameter change at an absolute engine sample time.
+    func scheduleParameter(id: ParameterID, value: Float, voiceIndex: Int = 0, sampleTime: UInt64) {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_ScheduleParameter(handle, cppParameterID(for: id), Int32(voiceIndex), value, sampleTime)
+    }
+
+    /// Schedules a clock restart at `startSample`, applied at `sampleTime`.
+    func scheduleClockStartSample(_ startSample: UInt64, sampleTime: UInt64) {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_ScheduleClockStartSample(handle, startSample, sampleTime)
+    }
+
+    /// Schedules a gate edge. trigger: 0=Plaits, 1=DaisyDrum, 2=drum sequencer lane `laneIndex`.
+    func scheduleTrigger(_ trigger: Int, laneIndex: Int = 0, state: Bool, sampleTime: UInt64) {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_ScheduleTrigger(handle, Int32(trigger), Int32(laneIndex), state, sampleTime)
+    }
+
+    /// Schedules a reel operation. operation: 0=play, 1=stop, 2=seek (value 0-1), 3=stop recording.
+    func scheduleReelOperation(_ operation: Int, index: Int, value: Float = 0, sampleTime: UInt64) {
+        guard let handle = cppEngineHandle else { return }
+        AudioEngine_ScheduleReelOperation(handle, Int32(operation), Int32(index), value, sampleTime)
+    }
+
     /// Returns the audio engine's absolute processed sample counter.
     func currentSampleTime() -> UInt64 {
         guard let handle = cppEngineHandle else { return 0 }
@@ -115,6 +115,7 @@ enum ModulationDestination: String, CaseIterable, Identifiable {
     case delayFeedback = "DLY:FDBK"
     case delayWow = "DLY:WOW"
     case delayFlutter = "DLY:FLTR"
+    case delayMix = "DLY:MIX"
 
     // Granular 1 destinations
     case granular1Speed = "GR1:SPED"
@@ -179,6 +180,7 @@ enum ModulationDestination: String, CaseIterable, Identifiable {
         case .delayFeedback: return "Delay Feedback"
         case .delayWow: return "Delay Wow"
         case .delayFlutter: return "Delay Flutter"
+        case .delayMix: return "Delay Mix"
         case .granular1Speed: return "Granular 1 Speed"
         case .granular1Pitch: return "Granular 1 Pitch"
         case .granular1Size: return "Granular 1 Size"
@@ -212,7 +214,7 @@ enum ModulationDestination: String, CaseIterable, Identifiable {
         case .none: return "None"
         case .plaitsHarmonics, .plaitsTimbre, .plaitsMorph, .plaitsLPGDecay: return "Macro Osc"
         case .ringsStructure, .ringsBrightness, .ringsDamping, .ringsPosition: return "Resonator"
-        case .delayTime, .delayFeedback, .delayWow, .delayFlutter: return "Delay"
+        case .delayTime, .delayFeedback, .delayWow, .delayFlutter, .delayMix: return "Delay"
         case .granular1Speed, .granular1Pitch, .granular1Size, .granular1Density, .granular1Filter: return "Granular 1"
         case .granular2Speed, .granular2Pitch, .granular2Size, .granular2Density, .granular2Filter: return "Granular 2"
         case .daisyDrumHarmonics, .daisyDrumTimbre, .daisyDrumMorph: return "Drums"
@@ -252,6 +254,7 @@ enum ModulationDestination: String, CaseIterable, Identifiable {
         case "DLY:FDBK": self = .delayFeedback
         case "DLY:WOW": self = .delayWow
         case "DLY:FLTR": self = .delayFlutter
+        case "DLY:MIX": self = .delayMix
         case "GR1:SPED": self = .granular1Speed
         case "GR1:PTCH": self = .granular1Pitch
         case "GR1:SIZE": self = .granular1Size
@@ -9,29 +9,34 @@
 #include "Plaits/PlaitsVoice.h"
 #include "Granular/GranularVoice.h"
 #include "Granular/ReelBuffer.h"
+#include "Granular/ReelPagePool.h"
 #include "Rings/RingsVoice.h"
 #include "Looper/LooperVoice.h"
 #include "DaisyDrums/DaisyDrumVoice.h"
+#include "DaisyDrums/DrumHitCache.h"
 #include "SoundFont/SoundFontVoice.h"
 #include "SoundFont/WavSamplerVoice.h"
 // Moog ladder filter models for master filter
-#include "Granular/MoogLadders/LadderFilterBase.h"
-#include "Granular/MoogLadders/StilsonModel.h"
-#include "Granular/MoogLadders/MicrotrackerModel.h"
-#include "Granular/MoogLadders/KrajeskiModel.h"
-#include "Granular/MoogLadders/MusicDSPModel.h"
-#include "Granular/MoogLadders/OberheimVariationModel.h"
-#include "Granular/MoogLadders/ImprovedModel.h"
-#include "Granular/MoogLadders/RKSimulationModel.h"
-#include "Granular/MoogLadders/HyperionModel.h"
-#include "Granular/MoogLadders/DaisyLadderModel.h"
-#include "Granular/MoogLadders/CytomicSvfModel.h"
+#include "Granular/MoogLadders/LadderFilterBank.h"
 #include "MasterCompressor.h"
+#include "RenderProfiler.h"
+#include "RenderWorkerPool.h"
+#include "ReelFileLoader.h"
+#include "EventTimeline.h"
+#include "MpscQueue.h"
+#include "MixerKernel.h"
+#include "FastMath.h"
+#include "SilenceDetector.h"
+#include "Freeverb.h"
+#include "TapeDelay.h"
+#include "dr_wav.h"
 #include <cstring>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <thread>
+#include <vector>
 
 #if defined(__APPLE__)
 #include <pthread.h>
@@ -50,6 +55,7 @@ namespace Grainulator {
 // smoothed = current * kMeterDecay + target * (1 - kMeterDecay)
 constexpr float kMeterDecay = 0.95f;
 constexpr float kMeterAttack = 1.0f - kMeterDecay;
+constexpr float kPlaitsStealLevel = 0.004f;  // -48 dBFS: a held voice this quiet is stolen first
 
 AudioEngine::AudioEngine()
     : m_sampleRate(kSampleRate)
@@ -58,6 +64,8 @@ AudioEngine::AudioEngine()
     , m_currentSampleTime(0)
     , m_cpuLoad(0.0f)
     , m_activeGrains(0)
+    , m_plaitsVoiceCount(kDefaultPlaitsVoices)
+    , m_plaitsPoolGain(1.0f / std::sqrt(static_cast<float>(kDefaultPlaitsVoices)))
     , m_voiceCounter(0)
     , m_currentEngine(8)
     , m_currentRingsModel(0)
@@ -128,31 +136,25 @@ AudioEngine::AudioEngine()
     , m_reverbSize(0.5f)
     , m_reverbDamping(0.5f)
     , m_reverbMix(0.0f)
-    , m_delayBufferL(nullptr)
-    , m_delayBufferR(nullptr)
-    , m_delayWritePos(0)
-    , m_delayTimeSmoothed(0.095f)
-    , m_tapeWowPhase(0.0f)
-    , m_tapeFlutterPhase(0.0f)
-    , m_tapeDrift(0.0f)
-    , m_tapeFeedbackLP(0.0f)
-    , m_tapeFeedbackHPIn(0.0f)
-    , m_tapeFeedbackHPOut(0.0f)
-    , m_tapeToneL(0.0f)
-    , m_tapeToneR(0.0f)
-    , m_tapeNoiseState(0x12345678u)
+    , m_delayTimeMod(0.0f)
+    , m_delayFeedbackMod(0.0f)
+    , m_delayMixMod(0.0f)
+    , m_delayWowMod(0.0f)
+    , m_delayFlutterMod(0.0f)
     , m_sendBufferAL(nullptr)
     , m_sendBufferAR(nullptr)
     , m_sendBufferBL(nullptr)
     , m_sendBufferBR(nullptr)
-    , m_scheduledReadIndex(0)
-    , m_scheduledWriteIndex(0)
 {
     // Initialize processing buffers
     m_processingBuffer[0] = nullptr;
     m_processingBuffer[1] = nullptr;
-    m_voiceBuffer[0] = nullptr;
-    m_voiceBuffer[1] = nullptr;
+    m_ringsRenderTicks = 0;
+    std::memset(m_channelRenderL, 0, sizeof(m_channelRenderL));
+    std::memset(m_channelRenderR, 0, sizeof(m_channelRenderR));
+    std::memset(m_drumLaneRender, 0, sizeof(m_drumLaneRender));
+    std::memset(m_trackActiveGrains, 0, sizeof(m_trackActiveGrains));
+    std::memset(m_voiceJobTicks, 0, sizeof(m_voiceJobTicks));
 
     // Zero exciter buffers
     std::memset(m_ringsExciterBufferL, 0, sizeof(m_ringsExciterBufferL));
@@ -161,22 +163,8 @@ AudioEngine::AudioEngine()
     // Zero scope buffers
     std::memset(m_scopeBuffer, 0, sizeof(m_scopeBuffer));
 
-    // Initialize effects buffers to nullptr
-    for (size_t i = 0; i < kNumCombs; ++i) {
-        m_combBuffersL[i] = nullptr;
-        m_combBuffersR[i] = nullptr;
-        m_combPos[i] = 0;
-        m_combFilters[i] = 0.0f;
-        m_combFiltersR[i] = 0.0f;
-    }
-    for (size_t i = 0; i < kNumAllpasses; ++i) {
-        m_allpassBuffersL[i] = nullptr;
-        m_allpassBuffersR[i] = nullptr;
-        m_allpassPos[i] = 0;
-    }
-
     // Initialize voice state
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         m_voiceNote[i] = -1;  // -1 = free
         m_voiceTrackId[i] = 0;
         m_voiceAge[i] = 0;
@@ -192,16 +180,22 @@ AudioEngine::AudioEngine()
         m_channelSendASmoothed[i] = 0.0f;
         m_channelSendB[i] = 0.0f;
         m_channelSendBSmoothed[i] = 0.0f;
+        mixerPanGains(0.0f, m_channelPanGainL[i], m_channelPanGainR[i]);
         m_channelDelaySamples[i] = 0;
         m_channelDelayWritePos[i] = 0;
         m_channelDelayBufferL[i].fill(0.0f);
         m_channelDelayBufferR[i].fill(0.0f);
+        m_channelSilent[i] = false;
+        m_channelSilentFrames[i] = 0;
         m_channelMute[i] = false;
         m_channelSolo[i] = false;
         m_channelLevels[i].store(0.0f);
+        m_channelRmsLevels[i].store(0.0f);
     }
     m_masterGain = 1.0f;  // Default master at unity
     m_masterGainSmoothed = 1.0f;
+    m_mixerSmoothFrames = 0;
+    m_mixerSmoothAlpha = 0.0f;
     m_masterLevelL.store(0.0f);
     m_masterLevelR.store(0.0f);
 
@@ -253,6 +247,24 @@ AudioEngine::AudioEngine()
     for (int i = 0; i < static_cast<int>(ModulationDestination::NumDestinations); ++i) {
         m_modulationValues[i] = 0.0f;
     }
+
+    // Profilers live for the engine's lifetime so UI reads never race shutdown()
+    m_renderProfiler = std::make_unique<RenderProfiler>();
+    m_multiChannelProfiler = std::make_unique<RenderProfiler>();
+    m_offlineProfiler = std::make_unique<RenderProfiler>();
+    m_renderWorkers = std::make_unique<RenderWorkerPool>();
+    m_eventTimeline = std::make_unique<EventTimeline>();
+    // Address space for every reel at full length; pages become resident only when written
+    m_reelPagePool = std::make_unique<ReelPagePool>(32 * ReelBuffer::kNumChannels * ReelBuffer::kMaxPages);
+    m_reelLoader = std::make_unique<ReelFileLoader>();
+    m_drumHitCache = std::make_unique<DrumHitCache>();
+    m_parameterCommands = std::make_unique<MpscQueue<ParameterCommand, kParameterCommandCapacity>>();
+    for (int id = 0; id < kNumParameterIDs; ++id) {
+        for (int slot = 0; slot < kParameterMirrorSlots; ++slot) {
+            m_parameterMirror[id][slot].store(0.0f, std::memory_order_relaxed);
+            m_parameterPending[id][slot].store(0, std::memory_order_relaxed);
+        }
+    }
 }
 
 AudioEngine::~AudioEngine() {
@@ -273,8 +285,16 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
 #endif
 
     m_sampleRate = sampleRate;
+    m_mixerSmoothFrames = 0;  // Recompute smoothing coefficient for the new rate
     m_bufferSize = bufferSize;
     m_currentSampleTime.store(0, std::memory_order_relaxed);
+    m_renderProfiler->setSampleRate(static_cast<float>(sampleRate));
+    m_multiChannelProfiler->setSampleRate(static_cast<float>(sampleRate));
+    m_offlineProfiler->setSampleRate(static_cast<float>(sampleRate));
+    m_renderProfiler->reset();
+    m_multiChannelProfiler->reset();
+    m_offlineProfiler->reset();
+    m_cpuLoad.store(0.0f, std::memory_order_relaxed);
     m_cachedBlockSampleTime.store(-1, std::memory_order_relaxed);
     m_cachedBlockFrames.store(0, std::memory_order_relaxed);
     m_cachedRenderInProgress.store(false, std::memory_order_relaxed);
@@ -286,24 +306,20 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
     m_renderingLegacyBlockSampleTime.store(-1, std::memory_order_relaxed);
     m_renderingLegacyBlockFrames.store(0, std::memory_order_relaxed);
     m_externalSendRoutingEnabled = false;
-    m_scheduledReadIndex.store(0, std::memory_order_relaxed);
-    m_scheduledWriteIndex.store(0, std::memory_order_relaxed);
+    m_eventTimeline->reset();
 
     // Allocate processing buffers
     m_processingBuffer[0] = new float[kMaxBufferSize];
     m_processingBuffer[1] = new float[kMaxBufferSize];
-    m_voiceBuffer[0] = new float[kMaxBufferSize];
-    m_voiceBuffer[1] = new float[kMaxBufferSize];
 
     // Clear buffers
     std::memset(m_processingBuffer[0], 0, kMaxBufferSize * sizeof(float));
     std::memset(m_processingBuffer[1], 0, kMaxBufferSize * sizeof(float));
-    std::memset(m_voiceBuffer[0], 0, kMaxBufferSize * sizeof(float));
-    std::memset(m_voiceBuffer[1], 0, kMaxBufferSize * sizeof(float));
 
-    // Initialize all Plaits voices
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
-        m_plaitsVoices[i] = std::make_unique<PlaitsVoice>();
+    // Initialize all Plaits voices, each on its own slice of one arena array
+    m_plaitsArenas.reset(new PlaitsVoiceArena[kMaxPlaitsVoices]);
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
+        m_plaitsVoices[i] = std::make_unique<PlaitsVoice>(&m_plaitsArenas[i]);
         m_plaitsVoices[i]->Init(static_cast<float>(sampleRate));
         m_voiceNote[i] = -1;
         m_voiceTrackId[i] = 0;
@@ -325,7 +341,7 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
 
     // Initialize DaisyDrum voice (manual control from synth tab)
     m_daisyDrumVoice = std::make_unique<DaisyDrumVoice>();
-    m_daisyDrumVoice->Init(static_cast<float>(sampleRate));
+    m_daisyDrumVoice->Init(static_cast<float>(sampleRate), 1);
 
     // Initialize drum sequencer voices (4 dedicated lanes)
     {
@@ -337,13 +353,15 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
         };
         for (int i = 0; i < kNumDrumSeqLanes; ++i) {
             m_drumSeqVoices[i] = std::make_unique<DaisyDrumVoice>();
-            m_drumSeqVoices[i]->Init(static_cast<float>(sampleRate));
+            m_drumSeqVoices[i]->Init(static_cast<float>(sampleRate), static_cast<uint32_t>(2 + i));  // Own noise per lane
             m_drumSeqVoices[i]->SetEngine(drumSeqEngines[i]);
             m_drumSeqVoices[i]->SetLevel(m_drumSeqLevel[i]);
             m_drumSeqVoices[i]->SetHarmonics(m_drumSeqHarmonics[i]);
             m_drumSeqVoices[i]->SetTimbre(m_drumSeqTimbre[i]);
             m_drumSeqVoices[i]->SetMorph(m_drumSeqMorph[i]);
+            m_drumSeqVoices[i]->SetHitCache(m_drumHitCache.get());
         }
+        m_drumHitCache->Start(static_cast<float>(sampleRate));
     }
 
     // Initialize SoundFont sampler voice
@@ -365,8 +383,11 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
         m_looperVoices[i]->Init(static_cast<float>(sampleRate));
     }
 
+    // Keep a few reel pages faulted in so recording never faults on the audio thread
+    m_reelPagePool->Start();
+
     // Create the first reel buffer (others created on demand)
-    m_reelBuffers[0] = std::make_unique<ReelBuffer>();
+    m_reelBuffers[0] = std::make_unique<ReelBuffer>(m_reelPagePool.get());
 
     // Assign first buffer to first granular voice
     if (m_granularVoices[0] && m_reelBuffers[0]) {
@@ -382,6 +403,13 @@ bool AudioEngine::initialize(int sampleRate, int bufferSize) {
     // Initialize master compressor
     initMasterCompressor();
 
+    // Spawn voice render workers: one per spare core, at most one per parallel job
+    {
+        const int spareCores = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+        m_renderWorkers->start(std::clamp(spareCores, 0, kNumVoiceRenderJobs - 1),
+                               static_cast<double>(m_bufferSize) / static_cast<double>(m_sampleRate));
+    }
+
     m_initialized.store(true);
     return true;
 }
@@ -392,11 +420,29 @@ void AudioEngine::shutdown() {
     }
 
     stopMultiChannelProcessing();
+    m_renderWorkers->stop();
+    m_reelLoader->stop();  // Before the reels it writes into are freed
+
+    // Lanes drop their cached hits before the cache frees them
+    for (int i = 0; i < kNumDrumSeqLanes; ++i) {
+        if (m_drumSeqVoices[i]) {
+            m_drumSeqVoices[i]->SetHitCache(nullptr);
+        }
+    }
+    m_drumHitCache->Stop();
+    m_reelPagePool->Stop();
+
+    // Audio is stopped: drop unapplied parameter commands
+    {
+        ParameterCommand command;
+        while (m_parameterCommands->pop(command)) {}
+    }
 
     // Cleanup Plaits voices
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         m_plaitsVoices[i].reset();
     }
+    m_plaitsArenas.reset();
     m_ringsVoice.reset();
 
     // Cleanup granular/looper voices and buffers
@@ -419,20 +465,11 @@ void AudioEngine::shutdown() {
         delete[] m_processingBuffer[1];
         m_processingBuffer[1] = nullptr;
     }
-    if (m_voiceBuffer[0]) {
-        delete[] m_voiceBuffer[0];
-        m_voiceBuffer[0] = nullptr;
-    }
-    if (m_voiceBuffer[1]) {
-        delete[] m_voiceBuffer[1];
-        m_voiceBuffer[1] = nullptr;
-    }
 
     // Cleanup effects
     cleanupEffects();
 
-    m_scheduledReadIndex.store(0, std::memory_order_relaxed);
-    m_scheduledWriteIndex.store(0, std::memory_order_relaxed);
+    m_eventTimeline->reset();
     m_cachedBlockSampleTime.store(-1, std::memory_order_relaxed);
     m_cachedBlockFrames.store(0, std::memory_order_relaxed);
     m_cachedRenderInProgress.store(false, std::memory_order_relaxed);
@@ -450,29 +487,43 @@ void AudioEngine::shutdown() {
 
 int AudioEngine::allocateVoice(int note, uint8_t trackId) {
     // First, check if this note is already playing BY THE SAME TRACK - retrigger same voice
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    // (including one left above a lowered voice count, so its note-off still matches)
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_voiceNote[i] == note && m_voiceTrackId[i] == trackId) {
             return i;
         }
     }
 
-    // Find a free voice
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
-        if (m_voiceNote[i] == -1) {
+    // Find a free voice: one that has gone silent, else the quietest release tail
+    const int count = m_plaitsVoiceCount.load(std::memory_order_relaxed);
+    int quietestFree = -1;
+    for (int i = 0; i < count; ++i) {
+        if (m_voiceNote[i] != -1) continue;
+        if (m_plaitsVoices[i]->IsSilent()) {
             return i;
         }
+        if (quietestFree < 0 ||
+            m_plaitsVoices[i]->GetOutputLevel() < m_plaitsVoices[quietestFree]->GetOutputLevel()) {
+            quietestFree = i;
+        }
+    }
+    if (quietestFree >= 0) {
+        return quietestFree;
     }
 
-    // No free voices - steal the oldest one
+    // No free voices - steal a held voice that has already decayed (a pinged
+    // LPG with the gate still open), otherwise the oldest one
+    int quietestVoice = 0;
     int oldestVoice = 0;
-    uint32_t oldestAge = m_voiceAge[0];
-    for (int i = 1; i < kNumPlaitsVoices; ++i) {
-        if (m_voiceAge[i] < oldestAge) {
-            oldestAge = m_voiceAge[i];
+    for (int i = 1; i < count; ++i) {
+        if (m_plaitsVoices[i]->GetOutputLevel() < m_plaitsVoices[quietestVoice]->GetOutputLevel()) {
+            quietestVoice = i;
+        }
+        if (m_voiceAge[i] < m_voiceAge[oldestVoice]) {
             oldestVoice = i;
         }
     }
-    return oldestVoice;
+    return m_plaitsVoices[quietestVoice]->GetOutputLevel() < kPlaitsStealLevel ? quietestVoice : oldestVoice;
 }
 
 void AudioEngine::noteOn(int note, int velocity) {
@@ -492,7 +543,7 @@ void AudioEngine::noteOnTarget(int note, int velocity, uint8_t targetMask, uint8
 
     if ((targetMask & static_cast<uint8_t>(NoteTarget::TargetPlaits)) != 0) {
         int voiceIndex = allocateVoice(note, trackId);
-        if (voiceIndex >= 0 && voiceIndex < kNumPlaitsVoices) {
+        if (voiceIndex >= 0 && voiceIndex < kMaxPlaitsVoices) {
             auto& voice = m_plaitsVoices[voiceIndex];
             if (voice) {
                 // Set up the voice
@@ -599,7 +650,7 @@ void AudioEngine::noteOffTarget(int note, uint8_t targetMask, uint8_t trackId) {
     }
 
     // Find the voice playing this note FROM THE SAME TRACK and release it
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_voiceNote[i] == note && m_voiceTrackId[i] == trackId) {
             if (m_plaitsVoices[i]) {
                 m_plaitsVoices[i]->Trigger(false);
@@ -610,25 +661,35 @@ void AudioEngine::noteOffTarget(int note, uint8_t targetMask, uint8_t trackId) {
     }
 }
 
-bool AudioEngine::enqueueScheduledEvent(const ScheduledNoteEvent& event) {
-    while (m_scheduledWriteLock.test_and_set(std::memory_order_acquire)) {
-        // UI/control thread only; tiny spin is acceptable and keeps audio thread lock-free.
-    }
-
-    const uint32_t write = m_scheduledWriteIndex.load(std::memory_order_relaxed);
-    const uint32_t nextWrite = (write + 1) % kScheduledEventCapacity;
-    const uint32_t read = m_scheduledReadIndex.load(std::memory_order_acquire);
-
-    if (nextWrite == read) {
-        // Queue full: drop newest event to avoid blocking the audio thread.
-        m_scheduledWriteLock.clear(std::memory_order_release);
-        return false;
+void AudioEngine::dispatchTimelineEvent(const TimelineEvent& event) {
+    switch (event.type) {
+        case TimelineEventType::NoteOn:
+            noteOnTarget(static_cast<int>(event.note), static_cast<int>(event.velocity), event.targetMask, event.trackId);
+            break;
+        case TimelineEventType::NoteOff:
+            noteOffTarget(static_cast<int>(event.note), event.targetMask, event.trackId);
+            break;
+        case TimelineEventType::Parameter:
+            applyParameter(ParameterCommand{static_cast<ParameterID>(event.id), event.index, event.value, event.payload});
+            break;
+        case TimelineEventType::Trigger: {
+            const bool state = event.value > 0.5f;
+            switch (static_cast<TimelineTrigger>(event.id)) {
+                case TimelineTrigger::Plaits: triggerPlaits(state); break;
+                case TimelineTrigger::DaisyDrum: triggerDaisyDrum(state); break;
+                case TimelineTrigger::DrumSeqLane: triggerDrumSeqLane(event.index, state); break;
+            }
+            break;
+        }
+        case TimelineEventType::ReelOperation:
+            switch (static_cast<ReelOperation>(event.id)) {
+                case ReelOperation::Play: setGranularPlaying(event.index, true); break;
+                case ReelOperation::Stop: setGranularPlaying(event.index, false); break;
+                case ReelOperation::Seek: setGranularPosition(event.index, event.value); break;
+                case ReelOperation::StopRecording: stopRecording(event.index); break;
+            }
+            break;
     }
-
-    m_scheduledEvents[write] = event;
-    m_scheduledWriteIndex.store(nextWrite, std::memory_order_release);
-    m_scheduledWriteLock.clear(std::memory_order_release);
-    return true;
 }
 
 void AudioEngine::scheduleNoteOn(int note, int velocity, uint64_t sampleTime) {
@@ -653,14 +714,14 @@ void AudioEngine::scheduleNoteOnTargetTagged(int note, int velocity, uint64_t sa
     const int clampedNote = std::max(0, std::min(note, 127));
     const int clampedVelocity = std::max(1, std::min(velocity, 127));
 
-    ScheduledNoteEvent event;
+    TimelineEvent event{};
     event.sampleTime = sampleTime;
+    event.type = TimelineEventType::NoteOn;
     event.note = static_cast<uint8_t>(clampedNote);
     event.velocity = static_cast<uint8_t>(clampedVelocity);
-    event.isNoteOn = true;
     event.targetMask = targetMask == 0 ? static_cast<uint8_t>(NoteTarget::TargetBoth) : targetMask;
     event.trackId = trackId;
-    enqueueScheduledEvent(event);
+    m_eventTimeline->push(event);
 }
 
 void AudioEngine::scheduleNoteOffTargetTagged(int note, uint64_t sampleTime, uint8_t targetMask, uint8_t trackId) {
@@ -668,23 +729,68 @@ void AudioEngine::scheduleNoteOffTargetTagged(int note, uint64_t sampleTime, uin
 
     const int clampedNote = std::max(0, std::min(note, 127));
 
-    ScheduledNoteEvent event;
+    TimelineEvent event{};
     event.sampleTime = sampleTime;
+    event.type = TimelineEventType::NoteOff;
     event.note = static_cast<uint8_t>(clampedNote);
-    event.velocity = 0;
-    event.isNoteOn = false;
     event.targetMask = targetMask == 0 ? static_cast<uint8_t>(NoteTarget::TargetBoth) : targetMask;
     event.trackId = trackId;
-    enqueueScheduledEvent(event);
+    m_eventTimeline->push(event);
+}
+
+void AudioEngine::scheduleParameter(ParameterID id, int voiceIndex, float value, uint64_t sampleTime) {
+    if (!m_initialized.load()) return;
+
+    TimelineEvent event{};
+    event.sampleTime = sampleTime;
+    event.type = TimelineEventType::Parameter;
+    event.id = static_cast<int32_t>(id);
+    event.index = voiceIndex;
+    event.value = value;
+    event.payload = parameterPayload(id, value);
+    m_eventTimeline->push(event);
+}
+
+void AudioEngine::scheduleClockStartSample(uint64_t startSample, uint64_t sampleTime) {
+    if (!m_initialized.load()) return;
+
+    TimelineEvent event{};
+    event.sampleTime = sampleTime;
+    event.type = TimelineEventType::Parameter;
+    event.id = static_cast<int32_t>(ParameterID::ClockStartSample);
+    event.payload = startSample;
+    m_eventTimeline->push(event);
+}
+
+void AudioEngine::scheduleTrigger(int trigger, int laneIndex, bool state, uint64_t sampleTime) {
+    if (!m_initialized.load()) return;
+    if (trigger < static_cast<int>(TimelineTrigger::Plaits) || trigger > static_cast<int>(TimelineTrigger::DrumSeqLane)) return;
+
+    TimelineEvent event{};
+    event.sampleTime = sampleTime;
+    event.type = TimelineEventType::Trigger;
+    event.id = trigger;
+    event.index = laneIndex;
+    event.value = state ? 1.0f : 0.0f;
+    m_eventTimeline->push(event);
+}
+
+void AudioEngine::scheduleReelOperation(int operation, int index, float value, uint64_t sampleTime) {
+    if (!m_initialized.load()) return;
+    if (operation < static_cast<int>(ReelOperation::Play) || operation > static_cast<int>(ReelOperation::StopRecording)) return;
+
+    TimelineEvent event{};
+    event.sampleTime = sampleTime;
+    event.type = TimelineEventType::ReelOperation;
+    event.id = operation;
+    event.index = index;
+    event.value = value;
+    m_eventTimeline->push(event);
 }
 
 void AudioEngine::clearScheduledNotes() {
-    while (m_scheduledWriteLock.test_and_set(std::memory_order_acquire)) {
-    }
-    // Consume everything currently queued.
-    const uint32_t write = m_scheduledWriteIndex.load(std::memory_order_relaxed);
-    m_scheduledReadIndex.store(write, std::memory_order_release);
-    m_scheduledWriteLock.clear(std::memory_order_release);
+    // Drops every pending event (notes and typed events); applied on the next callback.
+    m_eventTimeline->clear();
 }
 
 uint64_t AudioEngine::getCurrentSampleTime() const {
@@ -692,6 +798,18 @@ uint64_t AudioEngine::getCurrentSampleTime() const {
 }
 
 void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numChannels, int numFrames) {
+    // An offline bounce owns the engine while it runs; live callbacks get silence
+    LiveRenderScope live(*this);
+    if (!live.entered) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            std::memset(outputBuffers[ch], 0, numFrames * sizeof(float));
+        }
+        return;
+    }
+    processBlock(inputBuffers, outputBuffers, numChannels, numFrames);
+}
+
+void AudioEngine::processBlock(float** inputBuffers, float** outputBuffers, int numChannels, int numFrames) {
     if (!m_initialized.load()) {
         // Not initialized - output silence
         for (int ch = 0; ch < numChannels; ++ch) {
@@ -710,12 +828,23 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
             for (int ch = 0; ch < clampedChannels; ++ch) {
                 m_chunkOutputPtrs[ch] = outputBuffers[ch] + frameOffset;
             }
-            process(inputBuffers, m_chunkOutputPtrs, clampedChannels, chunkFrames);
+            processBlock(inputBuffers, m_chunkOutputPtrs, clampedChannels, chunkFrames);
             frameOffset += chunkFrames;
         }
         return;
     }
 
+    // Scope, meters and master capture only feed the UI; offline renders skip them
+    const bool updateUi = !m_offlineRenderActive.load(std::memory_order_relaxed);
+
+    // An offline bounce runs faster than real time; timing it with the live
+    // profiler would skew its deadline misses, mean and p99
+    RenderProfiler& profiler = updateUi ? *m_renderProfiler : *m_offlineProfiler;
+    profiler.beginCallback();
+
+    // Apply parameter changes queued by UI/control threads
+    drainParameterCommands();
+
     // Process master clock and update modulation values
     processClockOutputs(numFrames);
     applyModulation();
@@ -723,62 +852,9 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
     const uint64_t bufferStartSample = m_currentSampleTime.load(std::memory_order_relaxed);
     const uint64_t bufferEndSample = bufferStartSample + static_cast<uint64_t>(numFrames);
 
-    // Pop all queued note events that fall within this buffer.
-    // Events can arrive out-of-order (e.g., different tracks scheduling future note-offs),
-    // so collect due events and keep future events for later.
-    std::array<ScheduledNoteEvent, kScheduledEventCapacity> dueEvents{};
-    int dueEventCount = 0;
-
-    uint32_t read = m_scheduledReadIndex.load(std::memory_order_relaxed);
-    const uint32_t write = m_scheduledWriteIndex.load(std::memory_order_acquire);
-    std::array<ScheduledNoteEvent, kScheduledEventCapacity> futureEvents{};
-    int futureEventCount = 0;
-
-    while (read != write && (dueEventCount + futureEventCount) < static_cast<int>(kScheduledEventCapacity)) {
-        const ScheduledNoteEvent event = m_scheduledEvents[read];
-
-        if (event.sampleTime < bufferEndSample) {
-            dueEvents[dueEventCount] = event;
-            if (dueEvents[dueEventCount].sampleTime < bufferStartSample) {
-                dueEvents[dueEventCount].sampleTime = bufferStartSample;
-            }
-            ++dueEventCount;
-        } else {
-            futureEvents[futureEventCount] = event;
-            ++futureEventCount;
-        }
-
-        read = (read + 1) % kScheduledEventCapacity;
-    }
-
-    m_scheduledReadIndex.store(read, std::memory_order_release);
-
-    for (int i = 0; i < futureEventCount; ++i) {
-        enqueueScheduledEvent(futureEvents[i]);
-    }
-
-    auto eventComesAfter = [](const ScheduledNoteEvent& lhs, const ScheduledNoteEvent& rhs) -> bool {
-        if (lhs.sampleTime != rhs.sampleTime) {
-            return lhs.sampleTime > rhs.sampleTime;
-        }
-        // For same-sample events, process note-off before note-on so 100% gate
-        // lengths still produce a deterministic retrigger edge.
-        if (lhs.isNoteOn != rhs.isNoteOn) {
-            return lhs.isNoteOn && !rhs.isNoteOn;
-        }
-        return false;
-    };
-
-    // Insertion sort — no allocations, O(n^2) is fine for small event counts
-    for (int i = 1; i < dueEventCount; ++i) {
-        ScheduledNoteEvent key = dueEvents[i];
-        int j = i - 1;
-        while (j >= 0 && eventComesAfter(dueEvents[j], key)) {
-            dueEvents[j + 1] = dueEvents[j];
-            --j;
-        }
-        dueEvents[j + 1] = key;
-    }
+    // Move newly queued events into the timeline; only events due in this buffer are popped below.
+    EventTimeline& timeline = *m_eventTimeline;
+    timeline.drain(bufferStartSample);
 
     // Check if any channel is soloed
     bool anySoloed = false;
@@ -790,6 +866,7 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
     }
 
     float channelPeaks[kNumMixerChannels] = {0.0f};
+    float channelSumSquares[kNumMixerChannels] = {0.0f};
     float masterPeakL = 0.0f;
     float masterPeakR = 0.0f;
     int totalActiveGrains = 0;
@@ -797,41 +874,25 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
     std::memset(m_lastSendBusAR, 0, numFrames * sizeof(float));
     std::memset(m_lastSendBusBL, 0, numFrames * sizeof(float));
     std::memset(m_lastSendBusBR, 0, numFrames * sizeof(float));
+    profiler.lap(RenderStage::Events);
 
     auto renderChunk = [&](int frameOffset, int frameCount) {
         if (frameCount <= 0) return;
 
-        auto applyChannelDelay = [&](int channel, float inputL, float inputR, float& delayedL, float& delayedR) {
-            const int bufferLen = kMaxChannelDelaySamples + 1;
-            int writePos = m_channelDelayWritePos[channel];
-            int delaySamples = std::clamp(m_channelDelaySamples[channel], 0, kMaxChannelDelaySamples);
-            int readPos = writePos - delaySamples;
-            if (readPos < 0) {
-                readPos += bufferLen;
-            }
-
-            m_channelDelayBufferL[channel][writePos] = inputL;
-            m_channelDelayBufferR[channel][writePos] = inputR;
-            delayedL = m_channelDelayBufferL[channel][readPos];
-            delayedR = m_channelDelayBufferR[channel][readPos];
-
-            writePos++;
-            if (writePos >= bufferLen) {
-                writePos = 0;
-            }
-            m_channelDelayWritePos[channel] = writePos;
-        };
-
         // Process channel insert slots (called after synthesis, before gain/pan/send)
-        auto processChannelInserts = [&](int ch) {
-            if (!m_insertProcessCallback) return;
+        // Returns true if any insert ran.
+        auto processChannelInserts = [&](int ch, float* bufL, float* bufR) {
+            bool processed = false;
+            if (!m_insertProcessCallback) return processed;
             for (int slot = 0; slot < kMaxInsertsPerChannel; ++slot) {
                 auto& insert = m_channelInserts[ch][slot];
                 void* handle = insert.pluginHandle.load(std::memory_order_acquire);
                 if (handle && !insert.bypassed.load(std::memory_order_relaxed)) {
-                    m_insertProcessCallback(handle, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
+                    m_insertProcessCallback(handle, bufL, bufR, frameCount);
+                    processed = true;
                 }
             }
+            return processed;
         };
 
         // Clear main processing and send buffers for this chunk.
@@ -843,423 +904,140 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
         std::memset(m_sendBufferBR, 0, frameCount * sizeof(float));
 
         // Smooth mixer parameters toward targets (~10ms time constant)
-        // Prevents zipper noise from instantaneous gain/pan/send changes
+        // Prevents zipper noise from instantaneous gain/pan/send changes.
+        // Each chunk ramps linearly from the previous smoothed values to the new ones.
+        float gainFrom[kNumMixerChannels];
+        float panLFrom[kNumMixerChannels];
+        float panRFrom[kNumMixerChannels];
+        float sendAFrom[kNumMixerChannels];
+        float sendBFrom[kNumMixerChannels];
         {
-            const float kSmoothAlpha = 1.0f - std::exp(-static_cast<float>(frameCount) / (0.010f * static_cast<float>(m_sampleRate)));
+            if (frameCount != m_mixerSmoothFrames) {
+                m_mixerSmoothFrames = frameCount;
+                m_mixerSmoothAlpha = 1.0f - std::exp(-static_cast<float>(frameCount) / (0.010f * static_cast<float>(m_sampleRate)));
+            }
+            const float kSmoothAlpha = m_mixerSmoothAlpha;
             for (int ch = 0; ch < kNumMixerChannels; ++ch) {
+                gainFrom[ch] = m_channelGainSmoothed[ch];
+                panLFrom[ch] = m_channelPanGainL[ch];
+                panRFrom[ch] = m_channelPanGainR[ch];
+                sendAFrom[ch] = m_channelSendASmoothed[ch];
+                sendBFrom[ch] = m_channelSendBSmoothed[ch];
+
                 m_channelGainSmoothed[ch] += (m_channelGain[ch] - m_channelGainSmoothed[ch]) * kSmoothAlpha;
+                const float previousPan = m_channelPanSmoothed[ch];
                 m_channelPanSmoothed[ch] += (m_channelPan[ch] - m_channelPanSmoothed[ch]) * kSmoothAlpha;
+                if (m_channelPanSmoothed[ch] != previousPan) {
+                    mixerPanGains(m_channelPanSmoothed[ch], m_channelPanGainL[ch], m_channelPanGainR[ch]);
+                }
                 m_channelSendASmoothed[ch] += (m_channelSendA[ch] - m_channelSendASmoothed[ch]) * kSmoothAlpha;
                 m_channelSendBSmoothed[ch] += (m_channelSendB[ch] - m_channelSendBSmoothed[ch]) * kSmoothAlpha;
             }
             m_masterGainSmoothed += (m_masterGain - m_masterGainSmoothed) * kSmoothAlpha;
         }
+        profiler.lap(RenderStage::Mixer);
 
-        // ========== Channel 0: Plaits ==========
-        {
-            int ch = 0;
-            bool shouldPlay = !m_channelMute[ch] && (!anySoloed || m_channelSolo[ch]);
-
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            for (int v = 0; v < kNumPlaitsVoices; ++v) {
-                if (m_plaitsVoices[v]) {
-                    std::memset(m_tempVoiceL, 0, frameCount * sizeof(float));
-                    std::memset(m_tempVoiceR, 0, frameCount * sizeof(float));
-                    m_plaitsVoices[v]->Render(m_tempVoiceL, m_tempVoiceR, frameCount);
-                    for (int i = 0; i < frameCount; ++i) {
-                        m_voiceBuffer[0][i] += m_tempVoiceL[i];
-                        m_voiceBuffer[1][i] += m_tempVoiceR[i];
-                    }
-                }
-            }
-
-            // Normalize voice sum by configured polyphony.
-            const float kPlaitsVoiceNorm = 1.0f / std::sqrt(static_cast<float>(std::max(1, kNumPlaitsVoices)));
-            for (int i = 0; i < frameCount; ++i) {
-                m_voiceBuffer[0][i] *= kPlaitsVoiceNorm;
-                m_voiceBuffer[1][i] *= kPlaitsVoiceNorm;
-            }
-
-            // Process channel inserts (post-synthesis, pre-mixer)
-            processChannelInserts(ch);
-
-            // Record from Plaits (channel 0) pre-mixer
-            processRecordingForChannel(0, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Scope capture: Channel 0 (Plaits) — mono mix
-            {
-                size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
-                for (int i = 0; i < frameCount; ++i) {
-                    m_scopeBuffer[0][(wi + i) % kScopeBufferSize] = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
-                }
-            }
-
-            // Capture for Rings exciter if Plaits is the source (channel 0)
-            if (m_ringsExciterSource == 0) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            float gain = m_channelGainSmoothed[ch];
-            float pan = m_channelPanSmoothed[ch];
-            float sendA = m_channelSendASmoothed[ch];
-            float sendB = m_channelSendBSmoothed[ch];
-            float panL = std::cos((pan + 1.0f) * 0.25f * 3.14159265f);
-            float panR = std::sin((pan + 1.0f) * 0.25f * 3.14159265f);
-
-            for (int i = 0; i < frameCount; ++i) {
-                float mono = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f * gain;
-                float outL = mono * panL;
-                float outR = mono * panR;
-                float delayedL = 0.0f;
-                float delayedR = 0.0f;
-                applyChannelDelay(ch, outL, outR, delayedL, delayedR);
-
-                channelPeaks[ch] = std::max(channelPeaks[ch], std::abs(mono));
-
-                if (shouldPlay) {
-                    m_processingBuffer[0][i] += delayedL;
-                    m_processingBuffer[1][i] += delayedR;
-                }
-
-                const int outputIndex = frameOffset + i;
-                const float sendAL = delayedL * sendA;
-                const float sendAR = delayedR * sendA;
-                const float sendBL = delayedL * sendB;
-                const float sendBR = delayedR * sendB;
-                m_sendBufferAL[i] += sendAL;
-                m_sendBufferAR[i] += sendAR;
-                m_sendBufferBL[i] += sendBL;
-                m_sendBufferBR[i] += sendBR;
-                m_lastSendBusAL[outputIndex] += sendAL;
-                m_lastSendBusAR[outputIndex] += sendAR;
-                m_lastSendBusBL[outputIndex] += sendBL;
-                m_lastSendBusBR[outputIndex] += sendBR;
-            }
-        }
-
-        // ========== Channels 2-5: Track voices ==========
+        // ========== Voice rendering (fork-join across channels) ==========
+        const bool ringsRendered = renderVoiceChannels(frameCount, profiler);
         totalActiveGrains = 0;
         for (int trackIndex = 0; trackIndex < kNumGranularVoices; ++trackIndex) {
-            int ch = trackIndex + 2;
-            bool shouldPlay = !m_channelMute[ch] && (!anySoloed || m_channelSolo[ch]);
-
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            const bool isLooperTrack = (trackIndex == 1 || trackIndex == 2);
-            if (isLooperTrack) {
-                const int looperIndex = trackIndex - 1;
-                if (looperIndex >= 0 && looperIndex < kNumLooperVoices && m_looperVoices[looperIndex]) {
-                    m_looperVoices[looperIndex]->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            } else if (m_granularVoices[trackIndex]) {
-                m_granularVoices[trackIndex]->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                totalActiveGrains += static_cast<int>(m_granularVoices[trackIndex]->GetNumActiveGrains());
-            }
-
-            // Process channel inserts (post-synthesis, pre-mixer)
-            processChannelInserts(ch);
-
-            // Record from track voice (channel ch) pre-mixer
-            processRecordingForChannel(ch, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Scope capture: Channels 2-5 (track voices) — mono mix
-            {
-                size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
-                for (int i = 0; i < frameCount; ++i) {
-                    m_scopeBuffer[ch][(wi + i) % kScopeBufferSize] = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
-                }
-            }
-
-            // Capture for Rings exciter (ch maps to exciter source: 2=Gran1, 3=Loop1, 4=Loop2, 5=Gran2)
-            if (m_ringsExciterSource == ch) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            float gain = m_channelGainSmoothed[ch];
-            float pan = m_channelPanSmoothed[ch];
-            float sendA = m_channelSendASmoothed[ch];
-            float sendB = m_channelSendBSmoothed[ch];
-            float panL = std::cos((pan + 1.0f) * 0.25f * 3.14159265f);
-            float panR = std::sin((pan + 1.0f) * 0.25f * 3.14159265f);
-
-            for (int i = 0; i < frameCount; ++i) {
-                float sampleL = m_voiceBuffer[0][i] * gain;
-                float sampleR = m_voiceBuffer[1][i] * gain;
-                float outL = sampleL * panL;
-                float outR = sampleR * panR;
-                float delayedL = 0.0f;
-                float delayedR = 0.0f;
-                applyChannelDelay(ch, outL, outR, delayedL, delayedR);
-
-                channelPeaks[ch] = std::max(channelPeaks[ch], std::max(std::abs(sampleL), std::abs(sampleR)));
-
-                if (shouldPlay) {
-                    m_processingBuffer[0][i] += delayedL;
-                    m_processingBuffer[1][i] += delayedR;
-                }
-
-                const int outputIndex = frameOffset + i;
-                const float sendAL = delayedL * sendA;
-                const float sendAR = delayedR * sendA;
-                const float sendBL = delayedL * sendB;
-                const float sendBR = delayedR * sendB;
-                m_sendBufferAL[i] += sendAL;
-                m_sendBufferAR[i] += sendAR;
-                m_sendBufferBL[i] += sendBL;
-                m_sendBufferBR[i] += sendBR;
-                m_lastSendBusAL[outputIndex] += sendAL;
-                m_lastSendBusAR[outputIndex] += sendAR;
-                m_lastSendBusBL[outputIndex] += sendBL;
-                m_lastSendBusBR[outputIndex] += sendBR;
-            }
+            totalActiveGrains += m_trackActiveGrains[trackIndex];
         }
 
-        // ========== Channel 6: DaisyDrum ==========
-        {
-            int ch = 6;
+        // Inserts, recording tap, scope, exciter capture and gain/pan/sends for one channel.
+        // sourceIndex is the recording/exciter source id (matches the channel except Sampler=11).
+        bool sendAFed = false;
+        auto mixChannel = [&](int ch, int sourceIndex, float* bufL, float* bufR, bool monoSum) {
             bool shouldPlay = !m_channelMute[ch] && (!anySoloed || m_channelSolo[ch]);
 
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-            if (m_daisyDrumVoice) {
-                m_daisyDrumVoice->Render(m_voiceBuffer[0], nullptr, frameCount);
-                // Mono → stereo (duplicate to both channels)
-                std::memcpy(m_voiceBuffer[1], m_voiceBuffer[0], frameCount * sizeof(float));
-            }
+            // Process channel inserts (post-synthesis, pre-mixer). A plugin may
+            // have a tail of its own, so a channel with inserts never sleeps.
+            const bool silent = !processChannelInserts(ch, bufL, bufR) && m_channelSilent[ch];
 
-            // Render drum sequencer voices and sum into the same buffer
-            // Scale lanes by 1/sqrt(4) = 0.5 to prevent clipping when all hit together
-            {
-                constexpr float kDrumLaneNorm = 0.5f;
-                for (int lane = 0; lane < kNumDrumSeqLanes; ++lane) {
-                    if (m_drumSeqVoices[lane]) {
-                        std::memset(m_tempDrumSeq, 0, frameCount * sizeof(float));
-                        m_drumSeqVoices[lane]->Render(m_tempDrumSeq, nullptr, frameCount);
-                        // Record per-lane: channel 7=Kick, 8=SynthKick, 9=Snare, 10=HiHat
-                        processRecordingForChannel(7 + lane, m_tempDrumSeq, m_tempDrumSeq, frameCount);
-                        for (int i = 0; i < frameCount; ++i) {
-                            m_voiceBuffer[0][i] += m_tempDrumSeq[i] * kDrumLaneNorm;
-                            m_voiceBuffer[1][i] += m_tempDrumSeq[i] * kDrumLaneNorm;
-                        }
-                    }
-                }
-            }
-
-            // Process channel inserts (post-synthesis, pre-mixer)
-            processChannelInserts(ch);
-
-            // Record from DaisyDrum + all drum lanes mixed (channel 6) pre-mixer
-            processRecordingForChannel(6, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
+            // Record from this channel pre-mixer
+            processRecordingForChannel(sourceIndex, bufL, bufR, frameCount);
+            profiler.lap(RenderStage::Mixer);
 
-            // Scope capture: Channel 6 (DaisyDrum) — mono mix
-            {
+            // Scope capture — mono mix
+            if (updateUi) {
                 size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
                 for (int i = 0; i < frameCount; ++i) {
-                    m_scopeBuffer[6][(wi + i) % kScopeBufferSize] = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
+                    m_scopeBuffer[ch][(wi + i) % kScopeBufferSize] = (bufL[i] + bufR[i]) * 0.5f;
                 }
             }
+            profiler.lap(RenderStage::ScopeMeters);
+
+            // Capture for Rings exciter (Rings itself is never its own exciter)
+            if (ch != 1 && m_ringsExciterSource == sourceIndex) {
+                std::memcpy(m_ringsExciterBufferL, bufL, frameCount * sizeof(float));
+                std::memcpy(m_ringsExciterBufferR, bufR, frameCount * sizeof(float));
+            }
+
+            // A silent channel adds nothing to any bus once its micro-delay
+            // history holds only zeros, so the strip can be skipped outright.
+            const int historyLength = kMaxChannelDelaySamples + 1;
+            const bool skipStrip = silent && m_channelSilentFrames[ch] >= historyLength;
+            m_channelSilentFrames[ch] = silent ? std::min(m_channelSilentFrames[ch] + frameCount, historyLength) : 0;
+            if (skipStrip) {
+                profiler.lap(RenderStage::Mixer);
+                return;
+            }
+            sendAFed = true;
+
+            // Channel strip: gain/pan (+ meters) -> micro-delay -> main and send buses
+            const float peak = mixStripGainPan(
+                bufL, bufR, m_stripL, m_stripR, frameCount,
+                LinearRamp::between(gainFrom[ch], m_channelGainSmoothed[ch], frameCount),
+                LinearRamp::between(panLFrom[ch], m_channelPanGainL[ch], frameCount),
+                LinearRamp::between(panRFrom[ch], m_channelPanGainR[ch], frameCount),
+                monoSum, channelSumSquares[ch]);
+            channelPeaks[ch] = std::max(channelPeaks[ch], peak);
+
+            mixStripMicroDelay(m_stripL, m_stripR, m_stripDelayedL, m_stripDelayedR, frameCount,
+                               m_channelDelayBufferL[ch].data(), m_channelDelayBufferR[ch].data(),
+                               historyLength, m_channelDelaySamples[ch], m_channelDelayWritePos[ch]);
+
+            const MixStripTargets targets{
+                shouldPlay ? m_processingBuffer[0] : nullptr,
+                shouldPlay ? m_processingBuffer[1] : nullptr,
+                m_sendBufferAL, m_sendBufferAR, m_sendBufferBL, m_sendBufferBR,
+                m_lastSendBusAL + frameOffset, m_lastSendBusAR + frameOffset,
+                m_lastSendBusBL + frameOffset, m_lastSendBusBR + frameOffset
+            };
+            mixStripAccumulate(m_stripDelayedL, m_stripDelayedR, frameCount,
+                               LinearRamp::between(sendAFrom[ch], m_channelSendASmoothed[ch], frameCount),
+                               LinearRamp::between(sendBFrom[ch], m_channelSendBSmoothed[ch], frameCount),
+                               targets);
+            profiler.lap(RenderStage::Mixer);
+        };
 
-            // Capture for Rings exciter (channel 6 = Drums)
-            if (m_ringsExciterSource == 6) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            float gain = m_channelGainSmoothed[ch];
-            float pan = m_channelPanSmoothed[ch];
-            float sendA = m_channelSendASmoothed[ch];
-            float sendB = m_channelSendBSmoothed[ch];
-            float panL = std::cos((pan + 1.0f) * 0.25f * 3.14159265f);
-            float panR = std::sin((pan + 1.0f) * 0.25f * 3.14159265f);
+        // ========== Channel 0: Plaits ==========
+        mixChannel(0, 0, m_channelRenderL[0], m_channelRenderR[0], true);
 
-            for (int i = 0; i < frameCount; ++i) {
-                float sampleL = m_voiceBuffer[0][i] * gain;
-                float sampleR = m_voiceBuffer[1][i] * gain;
-                float outL = sampleL * panL;
-                float outR = sampleR * panR;
-                float delayedL = 0.0f;
-                float delayedR = 0.0f;
-                applyChannelDelay(ch, outL, outR, delayedL, delayedR);
-
-                channelPeaks[ch] = std::max(channelPeaks[ch], std::max(std::abs(sampleL), std::abs(sampleR)));
-
-                if (shouldPlay) {
-                    m_processingBuffer[0][i] += delayedL;
-                    m_processingBuffer[1][i] += delayedR;
-                }
+        // ========== Channels 2-5: Track voices ==========
+        for (int trackIndex = 0; trackIndex < kNumGranularVoices; ++trackIndex) {
+            const int ch = trackIndex + 2;
+            mixChannel(ch, ch, m_channelRenderL[ch], m_channelRenderR[ch], false);
+        }
 
-                const int outputIndex = frameOffset + i;
-                const float sendAL = delayedL * sendA;
-                const float sendAR = delayedR * sendA;
-                const float sendBL = delayedL * sendB;
-                const float sendBR = delayedR * sendB;
-                m_sendBufferAL[i] += sendAL;
-                m_sendBufferAR[i] += sendAR;
-                m_sendBufferBL[i] += sendBL;
-                m_sendBufferBR[i] += sendBR;
-                m_lastSendBusAL[outputIndex] += sendAL;
-                m_lastSendBusAR[outputIndex] += sendAR;
-                m_lastSendBusBL[outputIndex] += sendBL;
-                m_lastSendBusBR[outputIndex] += sendBR;
+        // ========== Channel 6: DaisyDrum ==========
+        // Record per-lane: channel 7=Kick, 8=SynthKick, 9=Snare, 10=HiHat
+        for (int lane = 0; lane < kNumDrumSeqLanes; ++lane) {
+            if (m_drumSeqVoices[lane]) {
+                processRecordingForChannel(7 + lane, m_drumLaneRender[lane], m_drumLaneRender[lane], frameCount);
             }
         }
+        mixChannel(6, 6, m_channelRenderL[6], m_channelRenderR[6], false);
 
         // ========== Channel 7: Sampler (SoundFont or WAV) ==========
-        {
-            int ch = 7;
-            bool shouldPlay = !m_channelMute[ch] && (!anySoloed || m_channelSolo[ch]);
-
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-            if (m_samplerMode == SamplerMode::WavSampler || m_samplerMode == SamplerMode::Sfz) {
-                if (m_wavSamplerVoice) {
-                    // Always call Render — it handles CheckSwap internally
-                    m_wavSamplerVoice->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            } else {
-                if (m_soundFontVoice) {
-                    // Always call Render — it handles CheckSwap internally
-                    // and outputs silence if no SoundFont is active yet
-                    m_soundFontVoice->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            }
-
-            // Process channel inserts (post-synthesis, pre-mixer)
-            processChannelInserts(ch);
-
-            // Record from Sampler (channel 11) pre-mixer
-            processRecordingForChannel(11, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Scope capture: Channel 7 (Sampler) — mono mix
-            {
-                size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
-                for (int i = 0; i < frameCount; ++i) {
-                    m_scopeBuffer[7][(wi + i) % kScopeBufferSize] = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
-                }
-            }
-
-            // Capture for Rings exciter (source 11 = Sampler)
-            if (m_ringsExciterSource == 11) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            float gain = m_channelGainSmoothed[ch];
-            float pan = m_channelPanSmoothed[ch];
-            float sendA = m_channelSendASmoothed[ch];
-            float sendB = m_channelSendBSmoothed[ch];
-            float panL = std::cos((pan + 1.0f) * 0.25f * 3.14159265f);
-            float panR = std::sin((pan + 1.0f) * 0.25f * 3.14159265f);
-
-            for (int i = 0; i < frameCount; ++i) {
-                float sampleL = m_voiceBuffer[0][i] * gain;
-                float sampleR = m_voiceBuffer[1][i] * gain;
-                float outL = sampleL * panL;
-                float outR = sampleR * panR;
-                float delayedL = 0.0f;
-                float delayedR = 0.0f;
-                applyChannelDelay(ch, outL, outR, delayedL, delayedR);
-
-                channelPeaks[ch] = std::max(channelPeaks[ch], std::max(std::abs(sampleL), std::abs(sampleR)));
-
-                if (shouldPlay) {
-                    m_processingBuffer[0][i] += delayedL;
-                    m_processingBuffer[1][i] += delayedR;
-                }
-
-                const int outputIndex = frameOffset + i;
-                const float sendAL = delayedL * sendA;
-                const float sendAR = delayedR * sendA;
-                const float sendBL = delayedL * sendB;
-                const float sendBR = delayedR * sendB;
-                m_sendBufferAL[i] += sendAL;
-                m_sendBufferAR[i] += sendAR;
-                m_sendBufferBL[i] += sendBL;
-                m_sendBufferBR[i] += sendBR;
-                m_lastSendBusAL[outputIndex] += sendAL;
-                m_lastSendBusAR[outputIndex] += sendAR;
-                m_lastSendBusBL[outputIndex] += sendBL;
-                m_lastSendBusBR[outputIndex] += sendBR;
-            }
-        }
+        mixChannel(7, 11, m_channelRenderL[7], m_channelRenderR[7], false);
 
         // ========== Channel 1: Rings (after all exciter sources) ==========
-        {
-            int ch = 1;
-            bool shouldPlay = !m_channelMute[ch] && (!anySoloed || m_channelSolo[ch]);
-
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-            if (m_ringsVoice) {
-                // Mix exciter buffer to mono for Rings input (Part expects mono in)
-                float exciterMono[kMaxBufferSize];
-                if (m_ringsExciterSource >= 0) {
-                    for (int i = 0; i < frameCount; ++i) {
-                        exciterMono[i] = (m_ringsExciterBufferL[i] + m_ringsExciterBufferR[i]) * 0.5f;
-                    }
-                } else {
-                    std::memset(exciterMono, 0, frameCount * sizeof(float));
-                }
-                m_ringsVoice->Render(exciterMono, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-            }
-
-            // Process channel inserts (post-synthesis, pre-mixer)
-            processChannelInserts(ch);
-
-            // Record from Rings (channel 1) pre-mixer
-            processRecordingForChannel(1, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Scope capture: Channel 1 (Rings) — mono mix
-            {
-                size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
-                for (int i = 0; i < frameCount; ++i) {
-                    m_scopeBuffer[1][(wi + i) % kScopeBufferSize] = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
-                }
-            }
-
-            float gain = m_channelGainSmoothed[ch];
-            float pan = m_channelPanSmoothed[ch];
-            float sendA = m_channelSendASmoothed[ch];
-            float sendB = m_channelSendBSmoothed[ch];
-            float panL = std::cos((pan + 1.0f) * 0.25f * 3.14159265f);
-            float panR = std::sin((pan + 1.0f) * 0.25f * 3.14159265f);
-
-            for (int i = 0; i < frameCount; ++i) {
-                float sampleL = m_voiceBuffer[0][i] * gain;
-                float sampleR = m_voiceBuffer[1][i] * gain;
-                float outL = sampleL * panL;
-                float outR = sampleR * panR;
-                float delayedL = 0.0f;
-                float delayedR = 0.0f;
-                applyChannelDelay(ch, outL, outR, delayedL, delayedR);
-
-                channelPeaks[ch] = std::max(channelPeaks[ch], std::max(std::abs(sampleL), std::abs(sampleR)));
-
-                if (shouldPlay) {
-                    m_processingBuffer[0][i] += delayedL;
-                    m_processingBuffer[1][i] += delayedR;
-                }
-
-                const int outputIndex = frameOffset + i;
-                const float sendAL = delayedL * sendA;
-                const float sendAR = delayedR * sendA;
-                const float sendBL = delayedL * sendB;
-                const float sendBR = delayedR * sendB;
-                m_sendBufferAL[i] += sendAL;
-                m_sendBufferAR[i] += sendAR;
-                m_sendBufferBL[i] += sendBL;
-                m_sendBufferBR[i] += sendBR;
-                m_lastSendBusAL[outputIndex] += sendAL;
-                m_lastSendBusAR[outputIndex] += sendAR;
-                m_lastSendBusBL[outputIndex] += sendBL;
-                m_lastSendBusBR[outputIndex] += sendBR;
-            }
+        if (!ringsRendered) {
+            renderRingsVoice(frameCount);
+            profiler.lap(RenderStage::Rings);
         }
+        mixChannel(1, 1, m_channelRenderL[1], m_channelRenderR[1], false);
 
         // ========== Process external input recording ==========
         processExternalInputRecording(frameCount);
@@ -1293,31 +1071,58 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
             }
         }
 
+        profiler.lap(RenderStage::Mixer);
+
         // ========== Process Internal Effects (disabled when external send routing or VST3 send A is active) ==========
+        // Delay and reverb run as separate passes over send A so each can be profiled;
+        // the per-sample chain (delay -> reverb -> sum) is unchanged.
+        // Each effect sleeps once both its input and its wet tail have stayed under
+        // the floor for its hold time, so a short send still gets its echoes; it wakes
+        // when signal reaches it, and a sleeping effect adds nothing.
         if (!m_externalSendRoutingEnabled && !vst3SendProcessed[0]) {
-            for (int i = 0; i < frameCount; ++i) {
-                float wetL = m_sendBufferAL[i];
-                float wetR = m_sendBufferAR[i];
-
-                if (m_delayMix > 0.001f) {
-                    processDelay(wetL, wetR);
-                }
-
-                if (m_reverbMix > 0.001f) {
-                    processReverb(wetL, wetR);
+            float unusedSquares = 0.0f;
+            auto sendAHasSignal = [&]() {
+                return mixStripMeter(m_sendBufferAL, m_sendBufferAR, frameCount, false, unusedSquares)
+                    > SilenceDetector::kThreshold;
+            };
+            bool sendAUsed = sendAFed;
+
+            const TapeDelayParams delay = delayParams();
+            const bool delayFed = delay.mix > 0.001f && sendAUsed && sendAHasSignal();
+            if (delay.mix > 0.001f && (delayFed || m_delayQuietFrames < kDelayTailHoldFrames)) {
+                m_delayWetPeak = 0.0f;
+                processDelay(m_sendBufferAL, m_sendBufferAR, frameCount, delay);
+                m_delayQuietFrames = (delayFed || m_delayWetPeak > kEffectTailFloor)
+                    ? 0 : std::min(m_delayQuietFrames + frameCount, kDelayTailHoldFrames);
+                sendAUsed = true;
+            }
+            profiler.lap(RenderStage::Delay);
+
+            const bool reverbFed = m_reverbMix > 0.001f && sendAUsed && sendAHasSignal();
+            if (m_reverbMix > 0.001f && (reverbFed || m_reverbQuietFrames < kReverbTailHoldFrames)) {
+                m_reverbWetPeak = 0.0f;
+                processReverb(m_sendBufferAL, m_sendBufferAR, frameCount);
+                m_reverbQuietFrames = (reverbFed || m_reverbWetPeak > kEffectTailFloor)
+                    ? 0 : std::min(m_reverbQuietFrames + frameCount, kReverbTailHoldFrames);
+                sendAUsed = true;
+            }
+            profiler.lap(RenderStage::Reverb);
+
+            if (sendAUsed) {
+                for (int i = 0; i < frameCount; ++i) {
+                    m_processingBuffer[0][i] += m_sendBufferAL[i];
+                    m_processingBuffer[1][i] += m_sendBufferAR[i];
                 }
-
-                m_processingBuffer[0][i] += wetL;
-                m_processingBuffer[1][i] += wetR;
             }
+            profiler.lap(RenderStage::Mixer);
         }
 
         // ========== Final Processing + output ==========
+        // Apply master filter before gain
+        processMasterFilter(m_processingBuffer[0], m_processingBuffer[1], frameCount);
         for (int i = 0; i < frameCount; ++i) {
-            // Apply master filter before gain
             float sampleL = m_processingBuffer[0][i];
             float sampleR = m_processingBuffer[1][i];
-            processMasterFilter(sampleL, sampleR);
 
             // Apply smoothed master gain
             sampleL *= m_masterGainSmoothed;
@@ -1326,34 +1131,31 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
             // Apply master compressor
             processMasterCompressor(sampleL, sampleR);
 
-            // Soft clip
-            m_processingBuffer[0][i] = std::tanh(sampleL);
-            m_processingBuffer[1][i] = std::tanh(sampleR);
-
-            masterPeakL = std::max(masterPeakL, std::abs(m_processingBuffer[0][i]));
-            masterPeakR = std::max(masterPeakR, std::abs(m_processingBuffer[1][i]));
+            m_processingBuffer[0][i] = sampleL;
+            m_processingBuffer[1][i] = sampleR;
         }
+        masterPeakL = std::max(masterPeakL, softClipMeter(m_processingBuffer[0], frameCount));
+        masterPeakR = std::max(masterPeakR, softClipMeter(m_processingBuffer[1], frameCount));
+        profiler.lap(RenderStage::Master);
 
-        // Master capture (recording to file via Swift)
-        if (m_masterCaptureActive.load(std::memory_order_relaxed)) {
-            m_masterCaptureRing.write(m_processingBuffer[0], m_processingBuffer[1], frameCount);
-        }
+        if (updateUi) {
+            // Master capture (recording to file via Swift)
+            if (m_masterCaptureActive.load(std::memory_order_relaxed)) {
+                m_masterCaptureRing.write(m_processingBuffer[0], m_processingBuffer[1], frameCount);
+            }
 
-        // Scope capture: Channel 8 (Master) — mono mix of final output
-        {
+            // Scope capture: Channel 8 (Master) — mono mix of final output
             size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
             for (int i = 0; i < frameCount; ++i) {
                 m_scopeBuffer[8][(wi + i) % kScopeBufferSize] = (m_processingBuffer[0][i] + m_processingBuffer[1][i]) * 0.5f;
             }
-        }
 
-        // Note: Clock scope capture is done per-sample in processClockOutputs()
+            // Note: Clock scope capture is done per-sample in processClockOutputs()
 
-        // Advance scope write index
-        {
-            size_t wi = m_scopeWriteIndex.load(std::memory_order_relaxed);
+            // Advance scope write index
             m_scopeWriteIndex.store((wi + frameCount) % kScopeBufferSize, std::memory_order_release);
         }
+        profiler.lap(RenderStage::ScopeMeters);
 
         for (int ch = 0; ch < numChannels; ++ch) {
             std::memcpy(
@@ -1362,34 +1164,37 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
                 frameCount * sizeof(float)
             );
         }
+        profiler.lap(RenderStage::Master);
     };
 
     int cursorFrame = 0;
-    int eventIndex = 0;
-    while (eventIndex < dueEventCount) {
-        const uint64_t eventSample = dueEvents[eventIndex].sampleTime;
-        const int eventFrame = static_cast<int>(std::min<uint64_t>(numFrames, eventSample - bufferStartSample));
+    uint64_t eventSample = 0;
+    while (timeline.peekDue(bufferEndSample, eventSample)) {
+        const int eventFrame = static_cast<int>(eventSample - bufferStartSample);
 
         if (eventFrame > cursorFrame) {
             renderChunk(cursorFrame, eventFrame - cursorFrame);
             cursorFrame = eventFrame;
         }
 
-        while (eventIndex < dueEventCount && dueEvents[eventIndex].sampleTime == eventSample) {
-            const ScheduledNoteEvent& event = dueEvents[eventIndex];
-            if (event.isNoteOn) {
-                noteOnTarget(static_cast<int>(event.note), static_cast<int>(event.velocity), event.targetMask, event.trackId);
-            } else {
-                noteOffTarget(static_cast<int>(event.note), event.targetMask, event.trackId);
-            }
-            ++eventIndex;
+        // Pops every event at this sample in priority order (params, reel ops, note-offs, triggers, note-ons)
+        TimelineEvent event;
+        while (timeline.popDue(eventSample + 1, event)) {
+            dispatchTimelineEvent(event);
         }
+        profiler.lap(RenderStage::Events);
     }
 
     if (cursorFrame < numFrames) {
         renderChunk(cursorFrame, numFrames - cursorFrame);
     }
 
+    m_currentSampleTime.store(bufferEndSample, std::memory_order_relaxed);
+    if (!updateUi) {
+        profiler.endCallback(numFrames);
+        return;
+    }
+
     // Update channel level meters (with smoothing)
     for (int i = 0; i < kNumMixerChannels; ++i) {
         float current = m_channelLevels[i].load();
@@ -1399,6 +1204,10 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
         } else {
             m_channelLevels[i].store(current * kMeterDecay + target * kMeterAttack);
         }
+
+        const float rms = std::sqrt(channelSumSquares[i] / static_cast<float>(numFrames));
+        const float currentRms = m_channelRmsLevels[i].load();
+        m_channelRmsLevels[i].store(rms > currentRms ? rms : currentRms * kMeterDecay + rms * kMeterAttack);
     }
 
     float currentL = m_masterLevelL.load();
@@ -1407,8 +1216,227 @@ void AudioEngine::process(float** inputBuffers, float** outputBuffers, int numCh
     m_masterLevelR.store(masterPeakR > currentR ? masterPeakR : currentR * kMeterDecay + masterPeakR * kMeterAttack);
 
     m_activeGrains.store(totalActiveGrains);
-    m_currentSampleTime.store(bufferEndSample, std::memory_order_relaxed);
+    profiler.lap(RenderStage::ScopeMeters);
+
+    publishCPULoad(profiler.endCallback(numFrames));
+}
+
+// ========== Parallel voice rendering ==========
+
+void AudioEngine::voiceRenderJob(void* context, int jobIndex) {
+    auto* ctx = static_cast<VoiceRenderContext*>(context);
+    ctx->engine->renderVoiceJob(jobIndex, ctx->frameCount, ctx->renderRings);
+}
+
+void AudioEngine::renderVoiceJob(int jobIndex, int frameCount, bool renderRings) {
+    const uint64_t start = RenderProfiler::readCounter();
+
+    switch (jobIndex) {
+        case JobPlaitsRings: {
+            float* outL = m_channelRenderL[0];
+            float* outR = m_channelRenderR[0];
+            std::memset(outL, 0, frameCount * sizeof(float));
+            std::memset(outR, 0, frameCount * sizeof(float));
+
+            // Voices add straight into the channel buffer, pre-scaled by the
+            // polyphony normalization. Voices that have decayed to silence are
+            // not rendered at all. Voices stay on this one job: Plaits engines
+            // draw from stmlib's global Random, so they cannot run concurrently.
+            // A voice count change ramps the normalization over the block
+            // instead of stepping the level of every sounding note.
+            const int count = m_plaitsVoiceCount.load(std::memory_order_relaxed);
+            const float targetGain = 1.0f / std::sqrt(static_cast<float>(count));
+            const float startGain = m_plaitsPoolGain;
+            const bool ramp = targetGain != startGain;
+            const float voiceGain = ramp ? 1.0f : targetGain;
+            bool silent = true;
+            for (int v = 0; v < kMaxPlaitsVoices; ++v) {
+                if (m_plaitsVoices[v] && !m_plaitsVoices[v]->IsSilent()) {
+                    silent = false;
+                    m_plaitsVoices[v]->RenderAdd(outL, outR, frameCount, voiceGain);
+                }
+            }
+            if (ramp && !silent) {
+                const float step = (targetGain - startGain) / static_cast<float>(frameCount);
+                for (int i = 0; i < frameCount; ++i) {
+                    const float gain = startGain + step * static_cast<float>(i + 1);
+                    outL[i] *= gain;
+                    outR[i] *= gain;
+                }
+            }
+            m_plaitsPoolGain = targetGain;
+            m_channelSilent[0] = silent;
+
+            // Internal-exciter Rings runs here, after Plaits, to keep the shared
+            // stmlib Random sequence identical to serial rendering.
+            m_ringsRenderTicks = 0;
+            if (renderRings) {
+                const uint64_t ringsStart = RenderProfiler::readCounter();
+                renderRingsVoice(frameCount);
+                m_ringsRenderTicks = RenderProfiler::readCounter() - ringsStart;
+            }
+            break;
+        }
+
+        case JobTrack0:
+        case JobTrack1:
+        case JobTrack2:
+        case JobTrack3: {
+            const int trackIndex = jobIndex - JobTrack0;
+            const int ch = trackIndex + 2;
+            std::memset(m_channelRenderL[ch], 0, frameCount * sizeof(float));
+            std::memset(m_channelRenderR[ch], 0, frameCount * sizeof(float));
+            m_trackActiveGrains[trackIndex] = 0;
+            m_channelSilent[ch] = true;
+
+            const bool isLooperTrack = (trackIndex == 1 || trackIndex == 2);
+            if (isLooperTrack) {
+                const int looperIndex = trackIndex - 1;
+                if (looperIndex >= 0 && looperIndex < kNumLooperVoices && m_looperVoices[looperIndex] &&
+                    !m_looperVoices[looperIndex]->IsSilent()) {
+                    m_looperVoices[looperIndex]->Render(m_channelRenderL[ch], m_channelRenderR[ch], frameCount);
+                    m_channelSilent[ch] = false;
+                }
+            } else if (m_granularVoices[trackIndex] && !m_granularVoices[trackIndex]->IsSilent()) {
+                m_granularVoices[trackIndex]->Render(m_channelRenderL[ch], m_channelRenderR[ch], frameCount);
+                m_trackActiveGrains[trackIndex] = static_cast<int>(m_granularVoices[trackIndex]->GetNumActiveGrains());
+                m_channelSilent[ch] = false;
+            }
+            break;
+        }
+
+        case JobDrums: {
+            float* outL = m_channelRenderL[6];
+            float* outR = m_channelRenderR[6];
+            std::memset(outL, 0, frameCount * sizeof(float));
+            std::memset(outR, 0, frameCount * sizeof(float));
+            bool silent = true;
+            if (m_daisyDrumVoice && !m_daisyDrumVoice->IsSilent()) {
+                m_daisyDrumVoice->Render(outL, nullptr, frameCount);
+                // Mono → stereo (duplicate to both channels)
+                std::memcpy(outR, outL, frameCount * sizeof(float));
+                silent = false;
+            }
+
+            // Render drum sequencer voices and sum into the same buffer
+            // Scale lanes by 1/sqrt(4) = 0.5 to prevent clipping when all hit together
+            constexpr float kDrumLaneNorm = 0.5f;
+            m_drumHitCache->Update();
+            for (int lane = 0; lane < kNumDrumSeqLanes; ++lane) {
+                if (m_drumSeqVoices[lane]) {
+                    // Lanes are recorded individually, so a sleeping lane still clears its buffer
+                    float* laneBuffer = m_drumLaneRender[lane];
+                    std::memset(laneBuffer, 0, frameCount * sizeof(float));
+                    if (m_drumSeqVoices[lane]->IsSilent()) continue;
+                    m_drumSeqVoices[lane]->Render(laneBuffer, nullptr, frameCount);
+                    for (int i = 0; i < frameCount; ++i) {
+                        outL[i] += laneBuffer[i] * kDrumLaneNorm;
+                        outR[i] += laneBuffer[i] * kDrumLaneNorm;
+                    }
+                    silent = false;
+                }
+            }
+            m_channelSilent[6] = silent;
+            break;
+        }
+
+        case JobSampler: {
+            float* outL = m_channelRenderL[7];
+            float* outR = m_channelRenderR[7];
+            std::memset(outL, 0, frameCount * sizeof(float));
+            std::memset(outR, 0, frameCount * sizeof(float));
+            m_channelSilent[7] = true;
+            if (m_samplerMode == SamplerMode::WavSampler || m_samplerMode == SamplerMode::Sfz) {
+                // Render handles CheckSwap internally; IsSilent() stays false
+                // while a swap is pending so it is never skipped
+                if (m_wavSamplerVoice && !m_wavSamplerVoice->IsSilent()) {
+                    m_wavSamplerVoice->Render(outL, outR, frameCount);
+                    m_channelSilent[7] = false;
+                }
+            } else {
+                // Same for SoundFont, which outputs silence until one is active
+                if (m_soundFontVoice && !m_soundFontVoice->IsSilent()) {
+                    m_soundFontVoice->Render(outL, outR, frameCount);
+                    m_channelSilent[7] = false;
+                }
+            }
+            break;
+        }
 
+        default:
+            break;
+    }
+
+    m_voiceJobTicks[jobIndex] = RenderProfiler::readCounter() - start;
+}
+
+void AudioEngine::renderRingsVoice(int frameCount) {
+    float* outL = m_channelRenderL[1];
+    float* outR = m_channelRenderR[1];
+    std::memset(outL, 0, frameCount * sizeof(float));
+    std::memset(outR, 0, frameCount * sizeof(float));
+    m_channelSilent[1] = true;
+    if (!m_ringsVoice) return;
+
+    // Mix exciter buffer to mono for Rings input (Part expects mono in)
+    float exciterPeak = 0.0f;
+    if (m_ringsExciterSource >= 0) {
+        for (int i = 0; i < frameCount; ++i) {
+            m_ringsExciterMono[i] = (m_ringsExciterBufferL[i] + m_ringsExciterBufferR[i]) * 0.5f;
+            exciterPeak = std::max(exciterPeak, std::fabs(m_ringsExciterMono[i]));
+        }
+    } else {
+        std::memset(m_ringsExciterMono, 0, frameCount * sizeof(float));
+    }
+
+    // Rings only sleeps while nothing is exciting it either
+    if (exciterPeak <= SilenceDetector::kThreshold && m_ringsVoice->IsSilent()) return;
+    m_ringsVoice->Render(m_ringsExciterMono, outL, outR, frameCount);
+    m_channelSilent[1] = false;
+}
+
+bool AudioEngine::renderVoiceChannels(int frameCount, RenderProfiler& profiler) {
+    // Rings needs the exciter captured from other channels during mixing, so it
+    // can only join the parallel batch when it uses its internal exciter.
+    const bool renderRings = m_ringsExciterSource < 0;
+    VoiceRenderContext context{this, frameCount, renderRings};
+    m_renderWorkers->run(&AudioEngine::voiceRenderJob, &context, kNumVoiceRenderJobs);
+
+    // Per-family CPU time (summed across threads, so it can exceed wall time)
+    profiler.addTicks(RenderStage::Plaits, m_voiceJobTicks[JobPlaitsRings] - m_ringsRenderTicks);
+    profiler.addTicks(RenderStage::Rings, m_ringsRenderTicks);
+    profiler.addTicks(RenderStage::Tracks, m_voiceJobTicks[JobTrack0] + m_voiceJobTicks[JobTrack1]
+                                         + m_voiceJobTicks[JobTrack2] + m_voiceJobTicks[JobTrack3]);
+    profiler.addTicks(RenderStage::Drums, m_voiceJobTicks[JobDrums]);
+    profiler.addTicks(RenderStage::Sampler, m_voiceJobTicks[JobSampler]);
+    profiler.skip();
+    return renderRings;
+}
+
+void AudioEngine::setRenderWorkerCount(int count) {
+    m_renderWorkers->setActiveWorkers(count);
+}
+
+int AudioEngine::getRenderWorkerCount() const {
+    return m_renderWorkers->getActiveWorkers();
+}
+
+void AudioEngine::setPlaitsVoiceCount(int count) {
+    // Voices beyond the new count keep any held note until its note-off
+    m_plaitsVoiceCount.store(std::clamp(count, 1, kMaxPlaitsVoices), std::memory_order_relaxed);
+}
+
+int AudioEngine::getPlaitsVoiceCount() const {
+    return m_plaitsVoiceCount.load(std::memory_order_relaxed);
+}
+
+void AudioEngine::setDrumHitCacheEnabled(bool enabled) {
+    // Hits already playing finish; unused ones are freed on the next drum render
+    m_drumHitCache->SetEnabled(enabled);
+}
+
+bool AudioEngine::isDrumHitCacheEnabled() const {
+    return m_drumHitCache->IsEnabled();
 }
 
 void AudioEngine::processMultiChannel(float** channelBuffers, int numFrames) {
@@ -1416,8 +1444,9 @@ void AudioEngine::processMultiChannel(float** channelBuffers, int numFrames) {
     // Outputs 6 separate stereo channels without mixing or effects
     // All mixing, effects, and routing are handled by Swift-side AVAudioEngine
 
-    if (!m_initialized.load()) {
-        // Not initialized - output silence
+    LiveRenderScope live(*this);
+    if (!m_initialized.load() || !live.entered) {
+        // Not initialized (or an offline render owns the engine) - output silence
         for (int ch = 0; ch < kNumMixerChannels * 2; ++ch) {
             if (channelBuffers[ch]) {
                 std::memset(channelBuffers[ch], 0, numFrames * sizeof(float));
@@ -1442,6 +1471,12 @@ void AudioEngine::processMultiChannel(float** channelBuffers, int numFrames) {
         return;
     }
 
+    RenderProfiler& profiler = *m_multiChannelProfiler;
+    profiler.beginCallback();
+
+    // Apply parameter changes queued by UI/control threads
+    drainParameterCommands();
+
     // Process master clock and update modulation values (still needed for voice modulation)
     processClockOutputs(numFrames);
     applyModulation();
@@ -1449,307 +1484,104 @@ void AudioEngine::processMultiChannel(float** channelBuffers, int numFrames) {
     const uint64_t bufferStartSample = m_currentSampleTime.load(std::memory_order_relaxed);
     const uint64_t bufferEndSample = bufferStartSample + static_cast<uint64_t>(numFrames);
 
-    // Process scheduled note events.
-    // Events can be out-of-order, so collect due events and retain future ones.
-    std::array<ScheduledNoteEvent, kScheduledEventCapacity> dueEvents{};
-    int dueEventCount = 0;
-
-    uint32_t read = m_scheduledReadIndex.load(std::memory_order_relaxed);
-    const uint32_t write = m_scheduledWriteIndex.load(std::memory_order_acquire);
-    std::array<ScheduledNoteEvent, kScheduledEventCapacity> futureEvents{};
-    int futureEventCount = 0;
-
-    while (read != write && (dueEventCount + futureEventCount) < static_cast<int>(kScheduledEventCapacity)) {
-        const ScheduledNoteEvent event = m_scheduledEvents[read];
-
-        if (event.sampleTime < bufferEndSample) {
-            dueEvents[dueEventCount] = event;
-            if (dueEvents[dueEventCount].sampleTime < bufferStartSample) {
-                dueEvents[dueEventCount].sampleTime = bufferStartSample;
-            }
-            ++dueEventCount;
-        } else {
-            futureEvents[futureEventCount] = event;
-            ++futureEventCount;
-        }
-
-        read = (read + 1) % kScheduledEventCapacity;
-    }
-
-    m_scheduledReadIndex.store(read, std::memory_order_release);
-
-    for (int i = 0; i < futureEventCount; ++i) {
-        enqueueScheduledEvent(futureEvents[i]);
-    }
-
-    auto eventComesAfter = [](const ScheduledNoteEvent& lhs, const ScheduledNoteEvent& rhs) -> bool {
-        if (lhs.sampleTime != rhs.sampleTime) {
-            return lhs.sampleTime > rhs.sampleTime;
-        }
-        if (lhs.isNoteOn != rhs.isNoteOn) {
-            return lhs.isNoteOn && !rhs.isNoteOn;
-        }
-        return false;
-    };
-
-    // Insertion sort — no allocations, O(n^2) is fine for small event counts
-    for (int i = 1; i < dueEventCount; ++i) {
-        ScheduledNoteEvent key = dueEvents[i];
-        int j = i - 1;
-        while (j >= 0 && eventComesAfter(dueEvents[j], key)) {
-            dueEvents[j + 1] = dueEvents[j];
-            --j;
-        }
-        dueEvents[j + 1] = key;
-    }
+    // Move newly queued events into the timeline; only events due in this buffer are popped below.
+    EventTimeline& timeline = *m_eventTimeline;
+    timeline.drain(bufferStartSample);
 
     float channelPeaks[kNumMixerChannels] = {0.0f};
+    float channelSumSquares[kNumMixerChannels] = {0.0f};
     int totalActiveGrains = 0;
+    profiler.lap(RenderStage::Events);
 
     // Lambda to render a chunk of audio for all channels
     auto renderChunk = [&](int frameOffset, int frameCount) {
         if (frameCount <= 0) return;
 
-        // ========== Channel 0: Plaits (buffers 0, 1) ==========
-        {
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            for (int v = 0; v < kNumPlaitsVoices; ++v) {
-                if (m_plaitsVoices[v]) {
-                    std::memset(m_tempVoiceL, 0, frameCount * sizeof(float));
-                    std::memset(m_tempVoiceR, 0, frameCount * sizeof(float));
-                    m_plaitsVoices[v]->Render(m_tempVoiceL, m_tempVoiceR, frameCount);
-                    for (int i = 0; i < frameCount; ++i) {
-                        m_voiceBuffer[0][i] += m_tempVoiceL[i];
-                        m_voiceBuffer[1][i] += m_tempVoiceR[i];
-                    }
-                }
-            }
-
-            // Normalize voice sum by configured polyphony.
-            const float kPlaitsVoiceNorm = 1.0f / std::sqrt(static_cast<float>(std::max(1, kNumPlaitsVoices)));
-            for (int i = 0; i < frameCount; ++i) {
-                m_voiceBuffer[0][i] *= kPlaitsVoiceNorm;
-                m_voiceBuffer[1][i] *= kPlaitsVoiceNorm;
-            }
-
-            // Record from Plaits (channel 0) pre-output
-            processRecordingForChannel(0, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Capture for Rings exciter if Plaits is the source (channel 0)
-            if (m_ringsExciterSource == 0) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            // Copy to output buffers (no mixing/effects)
-            if (channelBuffers[0]) {
-                std::memcpy(channelBuffers[0] + frameOffset, m_voiceBuffer[0], frameCount * sizeof(float));
-            }
-            if (channelBuffers[1]) {
-                std::memcpy(channelBuffers[1] + frameOffset, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            // Update metering
-            for (int i = 0; i < frameCount; ++i) {
-                float mono = (m_voiceBuffer[0][i] + m_voiceBuffer[1][i]) * 0.5f;
-                channelPeaks[0] = std::max(channelPeaks[0], std::abs(mono));
-            }
-        }
-
-        // ========== Channels 2-5: Granular/Looper voices (buffers 4-11) ==========
+        // ========== Voice rendering (fork-join across channels) ==========
+        const bool ringsRendered = renderVoiceChannels(frameCount, profiler);
         for (int trackIndex = 0; trackIndex < kNumGranularVoices; ++trackIndex) {
-            int bufferBaseIndex = (trackIndex + 2) * 2;  // 4, 6, 8, 10
-
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            const bool isLooperTrack = (trackIndex == 1 || trackIndex == 2);
-            if (isLooperTrack) {
-                const int looperIndex = trackIndex - 1;
-                if (looperIndex >= 0 && looperIndex < kNumLooperVoices && m_looperVoices[looperIndex]) {
-                    m_looperVoices[looperIndex]->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            } else if (m_granularVoices[trackIndex]) {
-                m_granularVoices[trackIndex]->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                totalActiveGrains += static_cast<int>(m_granularVoices[trackIndex]->GetNumActiveGrains());
-            }
-
-            // Record from track voice (channel trackIndex+2) pre-output
-            processRecordingForChannel(trackIndex + 2, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Capture for Rings exciter (ch maps to exciter source: 2=Gran1, 3=Loop1, 4=Loop2, 5=Gran2)
-            if (m_ringsExciterSource == trackIndex + 2) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            if (channelBuffers[bufferBaseIndex]) {
-                std::memcpy(channelBuffers[bufferBaseIndex] + frameOffset, m_voiceBuffer[0], frameCount * sizeof(float));
-            }
-            if (channelBuffers[bufferBaseIndex + 1]) {
-                std::memcpy(channelBuffers[bufferBaseIndex + 1] + frameOffset, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
-
-            int channelIndex = trackIndex + 2;
-            for (int i = 0; i < frameCount; ++i) {
-                float peak = std::max(std::abs(m_voiceBuffer[0][i]), std::abs(m_voiceBuffer[1][i]));
-                channelPeaks[channelIndex] = std::max(channelPeaks[channelIndex], peak);
-            }
+            totalActiveGrains += m_trackActiveGrains[trackIndex];
         }
 
-        // ========== Channel 6: DaisyDrum (buffers 12, 13) ==========
-        {
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            if (m_daisyDrumVoice) {
-                m_daisyDrumVoice->Render(m_voiceBuffer[0], nullptr, frameCount);
-                // Mono → stereo
-                std::memcpy(m_voiceBuffer[1], m_voiceBuffer[0], frameCount * sizeof(float));
-            }
-
-            // Render drum sequencer voices and sum into the same buffer
-            // Scale lanes by 1/sqrt(4) = 0.5 to prevent clipping when all hit together
-            {
-                constexpr float kDrumLaneNorm = 0.5f;
-                for (int lane = 0; lane < kNumDrumSeqLanes; ++lane) {
-                    if (m_drumSeqVoices[lane]) {
-                        std::memset(m_tempDrumSeq, 0, frameCount * sizeof(float));
-                        m_drumSeqVoices[lane]->Render(m_tempDrumSeq, nullptr, frameCount);
-                        // Record per-lane: channel 7=Kick, 8=SynthKick, 9=Snare, 10=HiHat
-                        processRecordingForChannel(7 + lane, m_tempDrumSeq, m_tempDrumSeq, frameCount);
-                        for (int i = 0; i < frameCount; ++i) {
-                            m_voiceBuffer[0][i] += m_tempDrumSeq[i] * kDrumLaneNorm;
-                            m_voiceBuffer[1][i] += m_tempDrumSeq[i] * kDrumLaneNorm;
-                        }
-                    }
-                }
-            }
-
-            // Record from DaisyDrum + all drum lanes mixed (channel 6) pre-output
-            processRecordingForChannel(6, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
+        // Recording tap, exciter capture, output copy and metering for one channel.
+        // sourceIndex is the recording/exciter source id (matches the channel except Sampler=11).
+        auto outputChannel = [&](int ch, int sourceIndex, const float* bufL, const float* bufR, bool monoMeter) {
+            // Record from this channel pre-output
+            processRecordingForChannel(sourceIndex, bufL, bufR, frameCount);
 
-            // Capture for Rings exciter (channel 6 = Drums)
-            if (m_ringsExciterSource == 6) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
+            // Capture for Rings exciter (Rings itself is never its own exciter)
+            if (ch != 1 && m_ringsExciterSource == sourceIndex) {
+                std::memcpy(m_ringsExciterBufferL, bufL, frameCount * sizeof(float));
+                std::memcpy(m_ringsExciterBufferR, bufR, frameCount * sizeof(float));
             }
 
-            if (channelBuffers[12]) {
-                std::memcpy(channelBuffers[12] + frameOffset, m_voiceBuffer[0], frameCount * sizeof(float));
+            // Copy to output buffers (no mixing/effects)
+            if (channelBuffers[ch * 2]) {
+                std::memcpy(channelBuffers[ch * 2] + frameOffset, bufL, frameCount * sizeof(float));
             }
-            if (channelBuffers[13]) {
-                std::memcpy(channelBuffers[13] + frameOffset, m_voiceBuffer[1], frameCount * sizeof(float));
+            if (channelBuffers[ch * 2 + 1]) {
+                std::memcpy(channelBuffers[ch * 2 + 1] + frameOffset, bufR, frameCount * sizeof(float));
             }
+            profiler.lap(RenderStage::Mixer);
 
-            for (int i = 0; i < frameCount; ++i) {
-                float peak = std::max(std::abs(m_voiceBuffer[0][i]), std::abs(m_voiceBuffer[1][i]));
-                channelPeaks[6] = std::max(channelPeaks[6], peak);
-            }
-        }
-
-        // ========== Channel 7: Sampler (SoundFont or WAV, buffers 14, 15) ==========
-        {
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            if (m_samplerMode == SamplerMode::WavSampler || m_samplerMode == SamplerMode::Sfz) {
-                if (m_wavSamplerVoice) {
-                    // Always call Render — it handles CheckSwap internally
-                    // and outputs silence if no map is active yet
-                    m_wavSamplerVoice->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            } else {
-                if (m_soundFontVoice) {
-                    // Always call Render — it handles CheckSwap internally
-                    // and outputs silence if no SoundFont is active yet
-                    m_soundFontVoice->Render(m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-                }
-            }
-
-            // Record from Sampler (channel 11) pre-output
-            processRecordingForChannel(11, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            // Capture for Rings exciter (source 11 = Sampler)
-            if (m_ringsExciterSource == 11) {
-                std::memcpy(m_ringsExciterBufferL, m_voiceBuffer[0], frameCount * sizeof(float));
-                std::memcpy(m_ringsExciterBufferR, m_voiceBuffer[1], frameCount * sizeof(float));
+            // Update metering (a silent channel contributes nothing)
+            if (!m_channelSilent[ch]) {
+                const float peak = mixStripMeter(bufL, bufR, frameCount, monoMeter, channelSumSquares[ch]);
+                channelPeaks[ch] = std::max(channelPeaks[ch], peak);
             }
+            profiler.lap(RenderStage::ScopeMeters);
+        };
 
-            if (channelBuffers[14]) {
-                std::memcpy(channelBuffers[14] + frameOffset, m_voiceBuffer[0], frameCount * sizeof(float));
-            }
-            if (channelBuffers[15]) {
-                std::memcpy(channelBuffers[15] + frameOffset, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
+        // Channel 0: Plaits (buffers 0, 1)
+        outputChannel(0, 0, m_channelRenderL[0], m_channelRenderR[0], true);
 
-            for (int i = 0; i < frameCount; ++i) {
-                float peak = std::max(std::abs(m_voiceBuffer[0][i]), std::abs(m_voiceBuffer[1][i]));
-                channelPeaks[7] = std::max(channelPeaks[7], peak);
-            }
+        // Channels 2-5: Granular/Looper voices (buffers 4-11)
+        for (int trackIndex = 0; trackIndex < kNumGranularVoices; ++trackIndex) {
+            const int ch = trackIndex + 2;
+            outputChannel(ch, ch, m_channelRenderL[ch], m_channelRenderR[ch], false);
         }
 
-        // ========== Channel 1: Rings (buffers 2, 3 — after all exciter sources) ==========
-        {
-            std::memset(m_voiceBuffer[0], 0, frameCount * sizeof(float));
-            std::memset(m_voiceBuffer[1], 0, frameCount * sizeof(float));
-
-            if (m_ringsVoice) {
-                // Mix exciter buffer to mono for Rings input (Part expects mono in)
-                float exciterMono[kMaxBufferSize];
-                if (m_ringsExciterSource >= 0) {
-                    for (int i = 0; i < frameCount; ++i) {
-                        exciterMono[i] = (m_ringsExciterBufferL[i] + m_ringsExciterBufferR[i]) * 0.5f;
-                    }
-                } else {
-                    std::memset(exciterMono, 0, frameCount * sizeof(float));
-                }
-                m_ringsVoice->Render(exciterMono, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
+        // Channel 6: DaisyDrum (buffers 12, 13)
+        // Record per-lane: channel 7=Kick, 8=SynthKick, 9=Snare, 10=HiHat
+        for (int lane = 0; lane < kNumDrumSeqLanes; ++lane) {
+            if (m_drumSeqVoices[lane]) {
+                processRecordingForChannel(7 + lane, m_drumLaneRender[lane], m_drumLaneRender[lane], frameCount);
             }
+        }
+        outputChannel(6, 6, m_channelRenderL[6], m_channelRenderR[6], false);
 
-            // Record from Rings (channel 1) pre-output
-            processRecordingForChannel(1, m_voiceBuffer[0], m_voiceBuffer[1], frameCount);
-
-            if (channelBuffers[2]) {
-                std::memcpy(channelBuffers[2] + frameOffset, m_voiceBuffer[0], frameCount * sizeof(float));
-            }
-            if (channelBuffers[3]) {
-                std::memcpy(channelBuffers[3] + frameOffset, m_voiceBuffer[1], frameCount * sizeof(float));
-            }
+        // Channel 7: Sampler (SoundFont or WAV, buffers 14, 15)
+        outputChannel(7, 11, m_channelRenderL[7], m_channelRenderR[7], false);
 
-            for (int i = 0; i < frameCount; ++i) {
-                float peak = std::max(std::abs(m_voiceBuffer[0][i]), std::abs(m_voiceBuffer[1][i]));
-                channelPeaks[1] = std::max(channelPeaks[1], peak);
-            }
+        // Channel 1: Rings (buffers 2, 3 — after all exciter sources)
+        if (!ringsRendered) {
+            renderRingsVoice(frameCount);
+            profiler.lap(RenderStage::Rings);
         }
+        outputChannel(1, 1, m_channelRenderL[1], m_channelRenderR[1], false);
 
         // Process external input recording
         processExternalInputRecording(frameCount);
+        profiler.lap(RenderStage::Mixer);
     };
 
     // Process with sample-accurate note events
     int cursorFrame = 0;
-    int eventIndex = 0;
-    while (eventIndex < dueEventCount) {
-        const uint64_t eventSample = dueEvents[eventIndex].sampleTime;
-        const int eventFrame = static_cast<int>(std::min<uint64_t>(numFrames, eventSample - bufferStartSample));
+    uint64_t eventSample = 0;
+    while (timeline.peekDue(bufferEndSample, eventSample)) {
+        const int eventFrame = static_cast<int>(eventSample - bufferStartSample);
 
         if (eventFrame > cursorFrame) {
             renderChunk(cursorFrame, eventFrame - cursorFrame);
             cursorFrame = eventFrame;
         }
 
-        while (eventIndex < dueEventCount && dueEvents[eventIndex].sampleTime == eventSample) {
-            const ScheduledNoteEvent& event = dueEvents[eventIndex];
-            if (event.isNoteOn) {
-                noteOnTarget(static_cast<int>(event.note), static_cast<int>(event.velocity), event.targetMask, event.trackId);
-            } else {
-                noteOffTarget(static_cast<int>(event.note), event.targetMask, event.trackId);
-            }
-            ++eventIndex;
+        // Pops every event at this sample in priority order (params, reel ops, note-offs, triggers, note-ons)
+        TimelineEvent event;
+        while (timeline.popDue(eventSample + 1, event)) {
+            dispatchTimelineEvent(event);
         }
+        profiler.lap(RenderStage::Events);
     }
 
     if (cursorFrame < numFrames) {
@@ -1765,11 +1597,17 @@ void AudioEngine::processMultiChannel(float** channelBuffers, int numFrames) {
         } else {
             m_channelLevels[i].store(current * kMeterDecay + target * kMeterAttack);
         }
+
+        const float rms = std::sqrt(channelSumSquares[i] / static_cast<float>(numFrames));
+        const float currentRms = m_channelRmsLevels[i].load();
+        m_channelRmsLevels[i].store(rms > currentRms ? rms : currentRms * kMeterDecay + rms * kMeterAttack);
     }
 
     m_activeGrains.store(totalActiveGrains);
     m_currentSampleTime.store(bufferEndSample, std::memory_order_relaxed);
+    profiler.lap(RenderStage::ScopeMeters);
 
+    publishCPULoad(profiler.endCallback(numFrames));
 }
 
 void AudioEngine::renderAndReadMultiChannel(
@@ -1782,6 +1620,12 @@ void AudioEngine::renderAndReadMultiChannel(
     if (!left || !right || numFrames <= 0) {
         return;
     }
+    LiveRenderScope live(*this);
+    if (!live.entered) {
+        std::memset(left, 0, numFrames * sizeof(float));
+        std::memset(right, 0, numFrames * sizeof(float));
+        return;
+    }
     if (channelIndex < 0 || channelIndex >= kNumMixerChannelsForRing) {
         std::memset(left, 0, numFrames * sizeof(float));
         std::memset(right, 0, numFrames * sizeof(float));
@@ -1891,6 +1735,12 @@ void AudioEngine::renderAndReadLegacyBus(
     if (!left || !right || numFrames <= 0) {
         return;
     }
+    LiveRenderScope live(*this);
+    if (!live.entered) {
+        std::memset(left, 0, numFrames * sizeof(float));
+        std::memset(right, 0, numFrames * sizeof(float));
+        return;
+    }
     if (busIndex < 0 || busIndex >= kNumLegacyOutputBuses) {
         std::memset(left, 0, numFrames * sizeof(float));
         std::memset(right, 0, numFrames * sizeof(float));
@@ -2003,7 +1853,86 @@ void AudioEngine::renderAndReadLegacyBus(
     }
 }
 
-void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
+void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
+    submitParameter(ParameterCommand{id, voiceIndex, value, parameterPayload(id, value)});
+}
+
+uint64_t AudioEngine::parameterPayload(ParameterID id, float value) {
+    // Only the float form of a start sample can be derived from the value;
+    // a euclidean pattern needs setClockOutputEuclidean()
+    if (id == ParameterID::ClockStartSample && std::isfinite(value) && value > 0.0f) {
+        return static_cast<uint64_t>(value);
+    }
+    return 0;
+}
+
+void AudioEngine::submitParameter(const ParameterCommand& command) {
+    const float value = command.value;
+
+    if (!m_initialized.load()) {
+        // No audio thread yet: apply in place.
+        applyParameter(command);
+        return;
+    }
+
+    // Nothing drains the queue while audio is stopped
+    if (tryApplyParameterDirect(command)) return;
+
+    int mirrorId = 0;
+    int mirrorSlot = 0;
+    const bool mirrored = parameterMirrorIndex(command, mirrorId, mirrorSlot);
+    if (mirrored) {
+        m_parameterMirror[mirrorId][mirrorSlot].store(value, std::memory_order_relaxed);
+        m_parameterPending[mirrorId][mirrorSlot].fetch_add(1, std::memory_order_release);
+    }
+
+    if (!m_parameterCommands->push(command)) {
+        m_droppedParameterCommands.fetch_add(1, std::memory_order_relaxed);
+        if (mirrored) {
+            m_parameterPending[mirrorId][mirrorSlot].fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
+
+bool AudioEngine::tryApplyParameterDirect(const ParameterCommand& command) {
+    if (steadyNanos() - m_lastLiveRenderNanos.load(std::memory_order_relaxed) < kParameterIdleNanos) {
+        return false;
+    }
+    if (m_offlineRenderActive.load()) return false;  // The bounce drains the queue
+
+    std::lock_guard<std::mutex> lock(m_directParameterMutex);
+    // Claim the engine the way a bounce does: a callback that starts now sees
+    // the flag and outputs silence, one already inside keeps the queued path.
+    m_directParameterApply.store(true);
+    const bool idle = m_liveRendersInFlight.load() == 0 && !m_offlineRenderActive.load();
+    if (idle) {
+        drainParameterCommands();  // Keep earlier queued changes in order
+        applyParameter(command);
+    }
+    m_directParameterApply.store(false);
+    return idle;
+}
+
+void AudioEngine::drainParameterCommands() {
+    ParameterCommand command;
+    while (m_parameterCommands->pop(command)) {
+        applyParameter(command);
+        int mirrorId = 0;
+        int mirrorSlot = 0;
+        if (parameterMirrorIndex(command, mirrorId, mirrorSlot)) {
+            m_parameterPending[mirrorId][mirrorSlot].fetch_sub(1, std::memory_order_release);
+        }
+    }
+}
+
+uint64_t AudioEngine::getDroppedParameterCommandCount() const {
+    return m_droppedParameterCommands.load(std::memory_order_relaxed);
+}
+
+void AudioEngine::applyParameter(const ParameterCommand& command) {
+    const ParameterID id = command.id;
+    const int voiceIndex = command.voiceIndex;
+    const float value = command.value;
     float clampedValue = std::max(0.0f, std::min(1.0f, value));
 
     // Clamp voice index for granular voices
@@ -2115,8 +2044,8 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
         case ParameterID::GranularFilterModel:
             if (m_granularVoices[granularVoice]) {
                 const int maxIndex = static_cast<int>(GranularVoice::FilterModel::Count) - 1;
-                int modelIndex = static_cast<int>(clampedValue * static_cast<float>(maxIndex) + 0.5f);
-                m_granularVoices[granularVoice]->SetFilterModelIndex(modelIndex);
+                m_granularVoices[granularVoice]->SetFilterModelIndex(
+                    static_cast<int>(clampedValue * static_cast<float>(maxIndex) + 0.5f));
             }
             break;
 
@@ -2255,7 +2184,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
         case ParameterID::PlaitsModel:
             m_currentEngine = static_cast<int>(value * 23.0f + 0.5f);
             // Apply to all voices
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetEngine(m_currentEngine);
                     m_plaitsVoices[i]->SetSixOpCustomEnabled(m_plaitsSixOpCustomEnabled);
@@ -2277,7 +2206,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
                 harmonicsValue = static_cast<float>(m_plaitsSixOpCustomPatchIndex) / 31.0f;
             }
             m_harmonics = harmonicsValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     if (m_plaitsSixOpCustomEnabled && m_currentEngine >= 2 && m_currentEngine <= 4) {
                         m_plaitsVoices[i]->SetSixOpCustomPatchIndex(m_plaitsSixOpCustomPatchIndex);
@@ -2290,7 +2219,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsTimbre:
             m_timbre = clampedValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetTimbre(clampedValue);
                 }
@@ -2299,7 +2228,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsMorph:
             m_morph = clampedValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetMorph(clampedValue);
                 }
@@ -2317,7 +2246,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
         case ParameterID::PlaitsLevel:
             m_plaitsLevel = clampedValue;
             // Set level on all voices
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetLevel(clampedValue);
                 }
@@ -2333,7 +2262,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsLPGColor:
             m_lpgColor = clampedValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetLPGColor(clampedValue);
                 }
@@ -2342,7 +2271,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsLPGDecay:
             m_lpgDecay = clampedValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetLPGDecay(clampedValue);
                 }
@@ -2351,7 +2280,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsLPGAttack:
             m_lpgAttack = clampedValue;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetLPGAttack(clampedValue);
                 }
@@ -2360,7 +2289,7 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
 
         case ParameterID::PlaitsLPGBypass:
             m_lpgBypass = value > 0.5f;
-            for (int i = 0; i < kNumPlaitsVoices; ++i) {
+            for (int i = 0; i < kMaxPlaitsVoices; ++i) {
                 if (m_plaitsVoices[i]) {
                     m_plaitsVoices[i]->SetLPGBypass(m_lpgBypass);
                 }
@@ -2443,6 +2372,12 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
             }
             break;
 
+        case ParameterID::VoiceSendB:
+            if (voiceIndex >= 0 && voiceIndex < kNumMixerChannels) {
+                m_channelSendB[voiceIndex] = clampedValue;
+            }
+            break;
+
         case ParameterID::VoiceMicroDelay:
             if (voiceIndex >= 0 && voiceIndex < kNumMixerChannels) {
                 const float maxDelaySeconds = 0.05f; // 50ms
@@ -2460,18 +2395,17 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
         case ParameterID::MasterFilterCutoff:
             // Map 0-1 to 20-20000 Hz (logarithmic)
             m_masterFilterCutoff = 20.0f * std::pow(1000.0f, clampedValue);
-            updateMasterFilterParameters();
             break;
 
         case ParameterID::MasterFilterResonance:
             m_masterFilterResonance = clampedValue;
-            updateMasterFilterParameters();
+            if (m_masterFilter) m_masterFilter->SetResonance(m_masterFilterResonance);
             break;
 
         case ParameterID::MasterFilterModel:
             // Map 0-1 to model index (0-9)
             m_masterFilterModel = static_cast<int>(clampedValue * 9.0f + 0.5f);
-            initMasterFilter();  // Recreate filter instances
+            if (m_masterFilter) m_masterFilter->SetModel(m_masterFilterModel);
             break;
 
         // ========== DaisyDrum Parameters ==========
@@ -2615,11 +2549,118 @@ void AudioEngine::setParameter(ParameterID id, int voiceIndex, float value) {
             if (m_masterCompressor) m_masterCompressor->setAutoMakeup(clampedValue > 0.5f);
             break;
 
+        // ========== Drum Sequencer Lanes ==========
+        case ParameterID::DrumSeqLaneLevel:
+            if (voiceIndex >= 0 && voiceIndex < kNumDrumSeqLanes) {
+                m_drumSeqLevel[voiceIndex] = value;
+                if (m_drumSeqVoices[voiceIndex]) {
+                    m_drumSeqVoices[voiceIndex]->SetLevel(value);
+                }
+            }
+            break;
+        case ParameterID::DrumSeqLaneHarmonics:
+            if (voiceIndex >= 0 && voiceIndex < kNumDrumSeqLanes) m_drumSeqHarmonics[voiceIndex] = value;
+            break;
+        case ParameterID::DrumSeqLaneTimbre:
+            if (voiceIndex >= 0 && voiceIndex < kNumDrumSeqLanes) m_drumSeqTimbre[voiceIndex] = value;
+            break;
+        case ParameterID::DrumSeqLaneMorph:
+            if (voiceIndex >= 0 && voiceIndex < kNumDrumSeqLanes) m_drumSeqMorph[voiceIndex] = value;
+            break;
+
+        // ========== Master Clock ==========
+        case ParameterID::ClockBPM:
+            m_clockBPM.store(std::clamp(value, 10.0f, 330.0f));
+            break;
+        case ParameterID::ClockSwing:
+            m_clockSwing = clampedValue;
+            break;
+        case ParameterID::ClockRunning:
+            if (value > 0.5f && !m_clockRunning.load()) {
+                // Starting clock - record start time and reset phases + euclidean counters
+                resetClockPhases(m_currentSampleTime.load(std::memory_order_relaxed));
+            }
+            m_clockRunning.store(value > 0.5f);
+            break;
+        case ParameterID::ClockStartSample:
+            resetClockPhases(command.payload);
+            break;
+
+        case ParameterID::ClockOutputMode:
+        case ParameterID::ClockOutputWaveform:
+        case ParameterID::ClockOutputDivision:
+        case ParameterID::ClockOutputLevel:
+        case ParameterID::ClockOutputOffset:
+        case ParameterID::ClockOutputPhase:
+        case ParameterID::ClockOutputWidth:
+        case ParameterID::ClockOutputDestination:
+        case ParameterID::ClockOutputModAmount:
+        case ParameterID::ClockOutputMuted:
+        case ParameterID::ClockOutputSlowMode:
+        case ParameterID::ClockOutputEuclidean:
+            if (voiceIndex >= 0 && voiceIndex < kNumClockOutputs) {
+                applyClockOutputParameter(id, m_clockOutputs[voiceIndex], value, command.payload);
+            }
+            break;
+
         default:
             break;
     }
 }
 
+bool AudioEngine::parameterReadsBackNormalized(ParameterID id) {
+    // The IDs getParameter() has a 0-1 readback for. Clock, mixer and
+    // dedicated-setter IDs carry BPM, indices or setter units and read back
+    // as 0, so a pending mirror would disagree with the settled value.
+    switch (id) {
+        case ParameterID::GranularSpeed: case ParameterID::GranularPitch:
+        case ParameterID::GranularSize: case ParameterID::GranularDensity:
+        case ParameterID::GranularJitter: case ParameterID::GranularSpread:
+        case ParameterID::GranularPan: case ParameterID::GranularFilterCutoff:
+        case ParameterID::GranularFilterResonance: case ParameterID::GranularGain:
+        case ParameterID::GranularSend: case ParameterID::GranularEnvelope:
+        case ParameterID::GranularDecay: case ParameterID::GranularFilterModel:
+        case ParameterID::GranularReverse: case ParameterID::GranularMorph:
+        case ParameterID::RingsModel: case ParameterID::RingsStructure:
+        case ParameterID::RingsBrightness: case ParameterID::RingsDamping:
+        case ParameterID::RingsPosition: case ParameterID::RingsLevel:
+        case ParameterID::RingsPolyphony: case ParameterID::RingsChord:
+        case ParameterID::RingsFM: case ParameterID::RingsExciterSource:
+        case ParameterID::PlaitsModel: case ParameterID::PlaitsHarmonics:
+        case ParameterID::PlaitsTimbre: case ParameterID::PlaitsMorph:
+        case ParameterID::PlaitsFrequency: case ParameterID::PlaitsLevel:
+        case ParameterID::PlaitsLPGColor: case ParameterID::PlaitsLPGDecay:
+        case ParameterID::PlaitsLPGAttack: case ParameterID::PlaitsLPGBypass:
+        case ParameterID::DelayTime: case ParameterID::DelayFeedback:
+        case ParameterID::DelayMix: case ParameterID::DelayHeadMode:
+        case ParameterID::DelayWow: case ParameterID::DelayFlutter:
+        case ParameterID::DelayTone: case ParameterID::DelaySync:
+        case ParameterID::DelayTempo: case ParameterID::DelaySubdivision:
+        case ParameterID::ReverbSize: case ParameterID::ReverbDamping:
+        case ParameterID::ReverbMix: case ParameterID::MasterGain:
+        case ParameterID::MasterFilterCutoff: case ParameterID::MasterFilterResonance:
+        case ParameterID::MasterFilterModel:
+        case ParameterID::DaisyDrumEngine: case ParameterID::DaisyDrumHarmonics:
+        case ParameterID::DaisyDrumTimbre: case ParameterID::DaisyDrumMorph:
+        case ParameterID::DaisyDrumLevel: case ParameterID::DaisyDrumNote:
+        case ParameterID::LooperRate: case ParameterID::LooperReverse:
+        case ParameterID::LooperLoopStart: case ParameterID::LooperLoopEnd:
+        case ParameterID::SamplerPreset: case ParameterID::SamplerAttack:
+        case ParameterID::SamplerDecay: case ParameterID::SamplerSustain:
+        case ParameterID::SamplerRelease: case ParameterID::SamplerFilterCutoff:
+        case ParameterID::SamplerFilterResonance: case ParameterID::SamplerTuning:
+        case ParameterID::SamplerLevel: case ParameterID::SamplerMode:
+        case ParameterID::MasterCompThreshold: case ParameterID::MasterCompRatio:
+        case ParameterID::MasterCompAttack: case ParameterID::MasterCompRelease:
+        case ParameterID::MasterCompKnee: case ParameterID::MasterCompMakeup:
+        case ParameterID::MasterCompMix: case ParameterID::MasterCompEnabled:
+        case ParameterID::MasterCompLimiter: case ParameterID::MasterCompAutoMakeup:
+            return true;
+        default:
+            return false;
+    }
+}
+
 float AudioEngine::getParameter(ParameterID id, int voiceIndex) const {
     const int granularVoice = std::max(0, std::min(voiceIndex, kNumGranularVoices - 1));
 
@@ -2627,6 +2668,14 @@ float AudioEngine::getParameter(ParameterID id, int voiceIndex) const {
         return std::max(0.0f, std::min(1.0f, x));
     };
 
+    // A change still in the queue reads back as the value that was set
+    int mirrorId = 0;
+    int mirrorSlot = 0;
+    if (parameterMirrorIndex(ParameterCommand{id, voiceIndex, 0.0f, 0}, mirrorId, mirrorSlot)
+        && m_parameterPending[mirrorId][mirrorSlot].load(std::memory_order_acquire) > 0) {
+        return clamp01(m_parameterMirror[mirrorId][mirrorSlot].load(std::memory_order_relaxed));
+    }
+
     switch (id) {
         case ParameterID::GranularSpeed:
             if (m_granularVoices[granularVoice]) {
@@ -2942,6 +2991,49 @@ const char* AudioEngine::getWavSamplerInstrumentName() const {
     return "";
 }
 
+void AudioEngine::setSamplerStreamingEnabled(bool enabled) {
+    if (m_wavSamplerVoice) {
+        m_wavSamplerVoice->SetStreamingEnabled(enabled);
+    }
+}
+
+bool AudioEngine::isSamplerStreamingEnabled() const {
+    return m_wavSamplerVoice && m_wavSamplerVoice->IsStreamingEnabled();
+}
+
+uint64_t AudioEngine::getSamplerStreamStarvationCount() const {
+    return m_wavSamplerVoice ? m_wavSamplerVoice->GetStreamStarvationCount() : 0;
+}
+
+void AudioEngine::setSamplerCompactStorageEnabled(bool enabled) {
+    if (m_soundFontVoice) {
+        m_soundFontVoice->SetCompactStorageEnabled(enabled);
+    }
+    if (m_wavSamplerVoice) {
+        m_wavSamplerVoice->SetCompactStorageEnabled(enabled);
+    }
+}
+
+bool AudioEngine::isSamplerCompactStorageEnabled() const {
+    return m_wavSamplerVoice && m_wavSamplerVoice->IsCompactStorageEnabled();
+}
+
+void AudioEngine::setSamplerCacheDirectory(const char* path) {
+    if (m_wavSamplerVoice) {
+        m_wavSamplerVoice->SetInstrumentCacheDirectory(path);
+    }
+}
+
+float AudioEngine::getSamplerLoadProgress() const {
+    return m_wavSamplerVoice ? m_wavSamplerVoice->GetLoadProgress() : 0.0f;
+}
+
+void AudioEngine::cancelSamplerLoad() {
+    if (m_wavSamplerVoice) {
+        m_wavSamplerVoice->CancelLoad();
+    }
+}
+
 void AudioEngine::setSamplerMode(SamplerMode mode) {
     m_samplerMode = mode;
     if (m_wavSamplerVoice) {
@@ -2964,29 +3056,26 @@ void AudioEngine::triggerDrumSeqLane(int laneIndex, bool state) {
 
 void AudioEngine::setDrumSeqLaneLevel(int laneIndex, float level) {
     if (laneIndex < 0 || laneIndex >= kNumDrumSeqLanes) return;
-    m_drumSeqLevel[laneIndex] = level;
-    if (m_drumSeqVoices[laneIndex]) {
-        m_drumSeqVoices[laneIndex]->SetLevel(level);
-    }
+    setParameter(ParameterID::DrumSeqLaneLevel, laneIndex, level);
 }
 
 void AudioEngine::setDrumSeqLaneHarmonics(int laneIndex, float value) {
     if (laneIndex < 0 || laneIndex >= kNumDrumSeqLanes) return;
-    m_drumSeqHarmonics[laneIndex] = value;
+    setParameter(ParameterID::DrumSeqLaneHarmonics, laneIndex, value);
 }
 
 void AudioEngine::setDrumSeqLaneTimbre(int laneIndex, float value) {
     if (laneIndex < 0 || laneIndex >= kNumDrumSeqLanes) return;
-    m_drumSeqTimbre[laneIndex] = value;
+    setParameter(ParameterID::DrumSeqLaneTimbre, laneIndex, value);
 }
 
 void AudioEngine::setDrumSeqLaneMorph(int laneIndex, float value) {
     if (laneIndex < 0 || laneIndex >= kNumDrumSeqLanes) return;
-    m_drumSeqMorph[laneIndex] = value;
+    setParameter(ParameterID::DrumSeqLaneMorph, laneIndex, value);
 }
 
 void AudioEngine::loadUserWavetable(const float* data, int numSamples, int frameSize) {
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_plaitsVoices[i]) {
             m_plaitsVoices[i]->LoadUserWavetable(data, numSamples, frameSize);
         }
@@ -2999,7 +3088,7 @@ bool AudioEngine::loadPlaitsSixOpCustomBank(const uint8_t* data, int numBytes) {
     }
 
     bool loaded = false;
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_plaitsVoices[i]) {
             loaded = m_plaitsVoices[i]->LoadSixOpCustomBank(
                 data,
@@ -3013,7 +3102,7 @@ bool AudioEngine::loadPlaitsSixOpCustomBank(const uint8_t* data, int numBytes) {
 
 void AudioEngine::setPlaitsSixOpCustomMode(bool enabled) {
     m_plaitsSixOpCustomEnabled = enabled;
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_plaitsVoices[i]) {
             m_plaitsVoices[i]->SetSixOpCustomEnabled(enabled);
         }
@@ -3024,7 +3113,7 @@ void AudioEngine::setPlaitsSixOpCustomPatch(int patchIndex) {
     m_plaitsSixOpCustomPatchIndex = std::clamp(patchIndex, 0, 31);
     const float normalizedPatch = static_cast<float>(m_plaitsSixOpCustomPatchIndex) / 31.0f;
     m_harmonics = normalizedPatch;
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_plaitsVoices[i]) {
             m_plaitsVoices[i]->SetSixOpCustomPatchIndex(m_plaitsSixOpCustomPatchIndex);
             m_plaitsVoices[i]->SetHarmonics(normalizedPatch);
@@ -3033,52 +3122,66 @@ void AudioEngine::setPlaitsSixOpCustomPatch(int patchIndex) {
 }
 
 bool AudioEngine::loadAudioFile(const char* filePath, int reelIndex) {
-    (void)filePath;
-    (void)reelIndex;
-    return false;
+    if (reelIndex < 0 || reelIndex >= 32 || !filePath) return false;
+
+    // Create buffer if it doesn't exist
+    if (!m_reelBuffers[reelIndex]) {
+        m_reelBuffers[reelIndex] = std::make_unique<ReelBuffer>(m_reelPagePool.get());
+    }
+
+    // Decoding continues on the loader thread; the reel's length grows as chunks land
+    if (!m_reelLoader->load(filePath, reelIndex, m_reelBuffers[reelIndex].get())) {
+        return false;
+    }
+
+    assignReelToVoices(reelIndex);
+    return true;
+}
+
+float AudioEngine::getReelLoadProgress(int reelIndex) const {
+    return m_reelLoader->getProgress(reelIndex);
 }
 
 bool AudioEngine::loadAudioData(int reelIndex, const float* leftChannel, const float* rightChannel, size_t numSamples, float sampleRate) {
     if (reelIndex < 0 || reelIndex >= 32) return false;
     if (!leftChannel || numSamples == 0) return false;
 
+    m_reelLoader->cancel(reelIndex);
+
     // Create buffer if it doesn't exist
     if (!m_reelBuffers[reelIndex]) {
-        m_reelBuffers[reelIndex] = std::make_unique<ReelBuffer>();
+        m_reelBuffers[reelIndex] = std::make_unique<ReelBuffer>(m_reelPagePool.get());
     }
 
     auto& buffer = m_reelBuffers[reelIndex];
 
-    // Clear existing content
-    buffer->Clear();
-
-    // Copy audio data (limit to max buffer size)
+    // Replace existing content (limited to max buffer size; also fills the guard bands)
     size_t samplesToLoad = std::min(numSamples, buffer->GetMaxLength());
-
-    for (size_t i = 0; i < samplesToLoad; ++i) {
-        buffer->SetSample(0, i, leftChannel[i]);
-        buffer->SetSample(1, i, rightChannel ? rightChannel[i] : leftChannel[i]);
-    }
-
-    buffer->SetLength(samplesToLoad);
+    buffer->Load(leftChannel, rightChannel, samplesToLoad);
     buffer->SetSampleRate(sampleRate);
 
     // Add a default splice covering the entire buffer
     buffer->AddSplice(0, static_cast<uint32_t>(samplesToLoad));
 
+    assignReelToVoices(reelIndex);
+    return true;
+}
+
+void AudioEngine::assignReelToVoices(int reelIndex) {
+    ReelBuffer* buffer = m_reelBuffers[reelIndex].get();
+
     // Assign to track voices if this is reel 0-3
     if (reelIndex < kNumGranularVoices && m_granularVoices[reelIndex]) {
-        m_granularVoices[reelIndex]->SetBuffer(buffer.get());
+        m_granularVoices[reelIndex]->SetBuffer(buffer);
     }
     if ((reelIndex == 1 || reelIndex == 2) && m_looperVoices[reelIndex - 1]) {
-        m_looperVoices[reelIndex - 1]->SetBuffer(buffer.get());
+        m_looperVoices[reelIndex - 1]->SetBuffer(buffer);
     }
-
-    return true;
 }
 
 void AudioEngine::clearReel(int reelIndex) {
     if (reelIndex < 0 || reelIndex >= 32) return;
+    m_reelLoader->cancel(reelIndex);
     if (m_reelBuffers[reelIndex]) {
         m_reelBuffers[reelIndex]->Clear();
     }
@@ -3104,12 +3207,27 @@ size_t AudioEngine::copyReelData(int reelIndex, float* leftOut, float* rightOut,
     size_t toCopy = std::min(length, maxSamples);
     if (toCopy == 0) return 0;
 
-    const float* srcL = m_reelBuffers[reelIndex]->GetBufferPointer(0);
-    const float* srcR = m_reelBuffers[reelIndex]->GetBufferPointer(1);
-    std::memcpy(leftOut, srcL, toCopy * sizeof(float));
-    std::memcpy(rightOut, srcR, toCopy * sizeof(float));
+    return m_reelBuffers[reelIndex]->CopyOut(0, toCopy, leftOut, rightOut);
+}
+
+size_t AudioEngine::getReelMemoryUsage(int reelIndex) const {
+    if (reelIndex < 0 || reelIndex >= 32) return 0;
+    if (!m_reelBuffers[reelIndex]) return 0;
+    return m_reelBuffers[reelIndex]->GetMemoryUsage();
+}
+
+size_t AudioEngine::getTotalReelMemoryUsage() const {
+    size_t bytes = m_reelPagePool ? m_reelPagePool->GetBytesInUse() : 0;
+    for (int i = 0; i < 32; ++i) {
+        if (m_reelBuffers[i]) bytes += sizeof(ReelBuffer);
+    }
+    return bytes;
+}
 
-    return toCopy;
+uint64_t AudioEngine::getReelDroppedRecordFrames(int reelIndex) const {
+    if (reelIndex < 0 || reelIndex >= 32) return 0;
+    if (!m_reelBuffers[reelIndex]) return 0;
+    return m_reelBuffers[reelIndex]->GetDroppedRecordFrames();
 }
 
 void AudioEngine::getWaveformOverview(int reelIndex, float* output, size_t outputSize) const {
@@ -3170,11 +3288,42 @@ int AudioEngine::getActiveGrainCount() const {
     return m_activeGrains.load();
 }
 
+void AudioEngine::publishCPULoad(float callbackLoad) {
+    // One-pole smoothing over ~10 callbacks so the UI readout doesn't flicker;
+    // spikes are still visible via the profiler's max/p99.
+    constexpr float kLoadSmoothing = 0.1f;
+    const float current = m_cpuLoad.load(std::memory_order_relaxed);
+    m_cpuLoad.store(current + (callbackLoad - current) * kLoadSmoothing, std::memory_order_relaxed);
+}
+
+bool AudioEngine::getRenderStageStats(int path, int stage, RenderStageStats& out) const {
+    const RenderProfiler* profiler = (path == static_cast<int>(RenderPath::MultiChannel))
+        ? m_multiChannelProfiler.get() : m_renderProfiler.get();
+    return profiler && profiler->getStats(stage, out);
+}
+
+uint64_t AudioEngine::getDeadlineMissCount(int path) const {
+    const RenderProfiler* profiler = (path == static_cast<int>(RenderPath::MultiChannel))
+        ? m_multiChannelProfiler.get() : m_renderProfiler.get();
+    return profiler ? profiler->getDeadlineMisses() : 0;
+}
+
+void AudioEngine::resetRenderProfiler() {
+    m_renderProfiler->reset();
+    m_multiChannelProfiler->reset();
+    m_cpuLoad.store(0.0f, std::memory_order_relaxed);
+}
+
 float AudioEngine::getChannelLevel(int channelIndex) const {
     if (channelIndex < 0 || channelIndex >= kNumMixerChannels) return 0.0f;
     return m_channelLevels[channelIndex].load();
 }
 
+float AudioEngine::getChannelRMSLevel(int channelIndex) const {
+    if (channelIndex < 0 || channelIndex >= kNumMixerChannels) return 0.0f;
+    return m_channelRmsLevels[channelIndex].load();
+}
+
 float AudioEngine::getMasterLevel(int channel) const {
     if (channel == 0) return m_masterLevelL.load();
     if (channel == 1) return m_masterLevelR.load();
@@ -3201,11 +3350,10 @@ void AudioEngine::setChannelSendLevel(int channelIndex, int sendIndex, float lev
         return;
     }
 
-    const float clamped = std::clamp(level, 0.0f, 1.0f);
     if (sendIndex == 0) {
-        m_channelSendA[channelIndex] = clamped;
+        setParameter(ParameterID::VoiceSend, channelIndex, level);
     } else if (sendIndex == 1) {
-        m_channelSendB[channelIndex] = clamped;
+        setParameter(ParameterID::VoiceSendB, channelIndex, level);
     }
 }
 
@@ -3264,29 +3412,16 @@ void AudioEngine::setSendReturnLevel(int sendIndex, float level) {
 // ========== Effects Implementation ==========
 
 void AudioEngine::initEffects() {
-    // Allocate delay buffers
-    m_delayBufferL = new float[kMaxDelayLength];
-    m_delayBufferR = new float[kMaxDelayLength];
-    std::memset(m_delayBufferL, 0, kMaxDelayLength * sizeof(float));
-    std::memset(m_delayBufferR, 0, kMaxDelayLength * sizeof(float));
-    m_delayWritePos = 0;
-    if (m_delaySync) {
-        const float divisionTable[9] = {2.0f, 1.333333f, 1.5f, 1.0f, 0.666667f, 0.75f, 0.5f, 0.333333f, 0.25f};
-        const int divisionIndex = std::clamp(static_cast<int>(m_delaySubdivision * 8.0f + 0.5f), 0, 8);
-        const float beatSeconds = 60.0f / std::max(40.0f, m_delayTempoBPM);
-        m_delayTimeSmoothed = beatSeconds * divisionTable[divisionIndex];
-    } else {
-        m_delayTimeSmoothed = 0.06f + (m_delayTime * m_delayTime) * 0.39f;
-    }
-    m_tapeWowPhase = 0.0f;
-    m_tapeFlutterPhase = 0.0f;
-    m_tapeDrift = 0.0f;
-    m_tapeFeedbackLP = 0.0f;
-    m_tapeFeedbackHPIn = 0.0f;
-    m_tapeFeedbackHPOut = 0.0f;
-    m_tapeToneL = 0.0f;
-    m_tapeToneR = 0.0f;
-    m_tapeNoiseState = 0x12345678u;
+    // Allocate the tape and start the heads at the current repeat time
+    static_assert(kMaxDelayLength == TapeDelay::kMaxDelayLength, "tail hold assumes the tape length");
+    m_tapeDelay = std::make_unique<TapeDelay>(m_sampleRate);
+    m_tapeDelay->reset(delayParams());
+
+    // Freshly cleared lines have no tail to ring out
+    m_delayWetPeak = 0.0f;
+    m_reverbWetPeak = 0.0f;
+    m_delayQuietFrames = kDelayTailHoldFrames;
+    m_reverbQuietFrames = kReverbTailHoldFrames;
 
     // Allocate send buffers
     m_sendBufferAL = new float[kMaxBufferSize];
@@ -3298,48 +3433,12 @@ void AudioEngine::initEffects() {
     std::memset(m_sendBufferBL, 0, kMaxBufferSize * sizeof(float));
     std::memset(m_sendBufferBR, 0, kMaxBufferSize * sizeof(float));
 
-    // Initialize reverb comb filters (Freeverb-style tunings)
-    // These lengths are tuned for 48kHz
-    const size_t combTunings[kNumCombs] = {
-        1557, 1617, 1491, 1422, 1277, 1356, 1188, 1116
-    };
-
-    for (size_t i = 0; i < kNumCombs; ++i) {
-        m_combLengths[i] = combTunings[i];
-        m_combBuffersL[i] = new float[combTunings[i]];
-        m_combBuffersR[i] = new float[combTunings[i]];
-        std::memset(m_combBuffersL[i], 0, combTunings[i] * sizeof(float));
-        std::memset(m_combBuffersR[i], 0, combTunings[i] * sizeof(float));
-        m_combPos[i] = 0;
-        m_combFilters[i] = 0.0f;
-        m_combFiltersR[i] = 0.0f;
-    }
-
-    // Initialize allpass filters
-    const size_t allpassTunings[kNumAllpasses] = {
-        556, 441, 341, 225
-    };
-
-    for (size_t i = 0; i < kNumAllpasses; ++i) {
-        m_allpassLengths[i] = allpassTunings[i];
-        m_allpassBuffersL[i] = new float[allpassTunings[i]];
-        m_allpassBuffersR[i] = new float[allpassTunings[i]];
-        std::memset(m_allpassBuffersL[i], 0, allpassTunings[i] * sizeof(float));
-        std::memset(m_allpassBuffersR[i], 0, allpassTunings[i] * sizeof(float));
-        m_allpassPos[i] = 0;
-    }
+    // Reverb delay lines (Freeverb-style tunings, 48kHz)
+    m_reverb = std::make_unique<Freeverb>(kMaxBufferSize);
 }
 
 void AudioEngine::cleanupEffects() {
-    // Free delay buffers
-    if (m_delayBufferL) {
-        delete[] m_delayBufferL;
-        m_delayBufferL = nullptr;
-    }
-    if (m_delayBufferR) {
-        delete[] m_delayBufferR;
-        m_delayBufferR = nullptr;
-    }
+    m_tapeDelay.reset();
 
     // Free send buffers
     if (m_sendBufferAL) {
@@ -3359,265 +3458,57 @@ void AudioEngine::cleanupEffects() {
         m_sendBufferBR = nullptr;
     }
 
-    // Free reverb buffers
-    for (size_t i = 0; i < kNumCombs; ++i) {
-        if (m_combBuffersL[i]) {
-            delete[] m_combBuffersL[i];
-            m_combBuffersL[i] = nullptr;
-        }
-        if (m_combBuffersR[i]) {
-            delete[] m_combBuffersR[i];
-            m_combBuffersR[i] = nullptr;
-        }
-    }
-
-    for (size_t i = 0; i < kNumAllpasses; ++i) {
-        if (m_allpassBuffersL[i]) {
-            delete[] m_allpassBuffersL[i];
-            m_allpassBuffersL[i] = nullptr;
-        }
-        if (m_allpassBuffersR[i]) {
-            delete[] m_allpassBuffersR[i];
-            m_allpassBuffersR[i] = nullptr;
-        }
-    }
+    m_reverb.reset();
 }
 
-void AudioEngine::processDelay(float& left, float& right) {
-    if (!m_delayBufferL || !m_delayBufferR) return;
-
-    constexpr float kPi = 3.14159265358979323846f;
-    constexpr float kTwoPi = 6.28318530717958647692f;
-    constexpr int kNumHeads = 3;
-    constexpr int kNumHeadModes = 8;
-    constexpr int kNumDivisions = 9;
-
-    // Head spacing roughly follows a fixed multi-head tape layout.
-    const float headRatios[kNumHeads] = {1.0f, 1.42f, 1.95f};
-    const float headGains[kNumHeads] = {0.55f, 0.40f, 0.30f};
-    const float headPans[kNumHeads] = {-0.55f, 0.0f, 0.55f};
-
-    // Classic space-echo head combinations.
-    const float modeMatrix[kNumHeadModes][kNumHeads] = {
-        {1.00f, 0.00f, 0.00f}, // Head 1
-        {0.00f, 1.00f, 0.00f}, // Head 2
-        {0.00f, 0.00f, 1.00f}, // Head 3
-        {0.85f, 0.65f, 0.00f}, // 1 + 2
-        {0.00f, 0.75f, 0.58f}, // 2 + 3
-        {0.80f, 0.00f, 0.58f}, // 1 + 3
-        {0.72f, 0.55f, 0.42f}, // 1 + 2 + 3
-        {0.95f, 0.45f, 0.28f}  // dense stack
-    };
-
-    const int modeIndex = std::clamp(static_cast<int>(m_delayHeadMode * static_cast<float>(kNumHeadModes - 1) + 0.5f), 0, kNumHeadModes - 1);
-
-    float targetHead1Seconds;
-    if (m_delaySync) {
-        // Rhythmic values in quarter-note units.
-        const float divisionTable[kNumDivisions] = {
-            2.0f, 1.333333f, 1.5f, 1.0f, 0.666667f, 0.75f, 0.5f, 0.333333f, 0.25f
-        };
-        const int divisionIndex = std::clamp(static_cast<int>(m_delaySubdivision * static_cast<float>(kNumDivisions - 1) + 0.5f), 0, kNumDivisions - 1);
-        const float beatSeconds = 60.0f / std::max(40.0f, m_delayTempoBPM);
-        targetHead1Seconds = beatSeconds * divisionTable[divisionIndex];
-    } else {
-        // Free repeat-rate mapping: short head ranges ~60ms to ~450ms.
-        const float repeatCurve = m_delayTime * m_delayTime;
-        targetHead1Seconds = 0.06f + repeatCurve * 0.39f;
-    }
-
-    const float maxHead1Seconds = (static_cast<float>(kMaxDelayLength - 4) / static_cast<float>(m_sampleRate)) / headRatios[kNumHeads - 1];
-    targetHead1Seconds = std::clamp(targetHead1Seconds, 0.03f, maxHead1Seconds);
-
-    const float timeSmoothing = m_delaySync ? 0.0028f : 0.0015f;
-    m_delayTimeSmoothed += (targetHead1Seconds - m_delayTimeSmoothed) * timeSmoothing;
-
-    // Tape speed modulation (wow, flutter, and slow random drift).
-    m_tapeWowPhase += kTwoPi * 0.17f / static_cast<float>(m_sampleRate);
-    m_tapeFlutterPhase += kTwoPi * 5.4f / static_cast<float>(m_sampleRate);
-    if (m_tapeWowPhase > kTwoPi) m_tapeWowPhase -= kTwoPi;
-    if (m_tapeFlutterPhase > kTwoPi) m_tapeFlutterPhase -= kTwoPi;
-
-    m_tapeNoiseState = m_tapeNoiseState * 1664525u + 1013904223u;
-    float randomDrift = (static_cast<float>((m_tapeNoiseState >> 8) & 0x00FFFFFF) / 16777216.0f) * 2.0f - 1.0f;
-    m_tapeDrift = m_tapeDrift * 0.99985f + randomDrift * 0.00015f;
-
-    const float wowDepth = 0.0010f + m_delayWow * 0.0070f;
-    const float flutterDepth = 0.00025f + m_delayFlutter * 0.0025f;
-    const float driftDepth = 0.0007f + m_delayWow * 0.0014f;
-    const float speedMod = std::clamp(
-        std::sin(m_tapeWowPhase) * wowDepth +
-        std::sin(m_tapeFlutterPhase) * flutterDepth +
-        m_tapeDrift * driftDepth,
-        -0.02f,
-        0.02f
-    );
-
-    auto readInterpolated = [&](float* buffer, float delaySamples) -> float {
-        float clampedDelay = std::max(1.0f, std::min(delaySamples, static_cast<float>(kMaxDelayLength - 2)));
-        float readPos = static_cast<float>(m_delayWritePos) - clampedDelay;
-        while (readPos < 0.0f) {
-            readPos += static_cast<float>(kMaxDelayLength);
-        }
-
-        int indexA = static_cast<int>(readPos);
-        int indexB = (indexA + 1) % static_cast<int>(kMaxDelayLength);
-        float frac = readPos - static_cast<float>(indexA);
-        return buffer[indexA] + (buffer[indexB] - buffer[indexA]) * frac;
-    };
-
-    float echoL = 0.0f;
-    float echoR = 0.0f;
-    float feedbackSum = 0.0f;
-
-    for (int i = 0; i < kNumHeads; ++i) {
-        const float modeGain = modeMatrix[modeIndex][i];
-        if (modeGain < 0.001f) {
-            continue;
-        }
-
-        float delaySeconds = m_delayTimeSmoothed * headRatios[i] * (1.0f + speedMod);
-        float delaySamples = delaySeconds * static_cast<float>(m_sampleRate);
-
-        float tapL = readInterpolated(m_delayBufferL, delaySamples);
-        float tapR = readInterpolated(m_delayBufferR, delaySamples);
-        float tapMono = (tapL + tapR) * 0.5f;
-        float headOut = tapMono * headGains[i] * modeGain;
-
-        float panAngle = (headPans[i] + 1.0f) * 0.25f * kPi;
-        float panL = std::cos(panAngle);
-        float panR = std::sin(panAngle);
-
-        echoL += headOut * panL;
-        echoR += headOut * panR;
-        feedbackSum += headOut * (i == (kNumHeads - 1) ? 0.85f : 1.0f);
-    }
-
-    // Roll off highs/lows in the feedback path like aging tape.
-    const float feedbackLPCoeff = std::clamp((0.28f + m_delayTone * 0.32f) - m_delayFeedback * 0.12f, 0.08f, 0.80f);
-    m_tapeFeedbackLP += (std::tanh(feedbackSum * (1.1f + m_delayFeedback * 2.2f)) - m_tapeFeedbackLP) * feedbackLPCoeff;
-
-    float feedbackHPCoeff = 1.0f - (kTwoPi * 110.0f / static_cast<float>(m_sampleRate));
-    feedbackHPCoeff = std::max(0.0f, std::min(feedbackHPCoeff, 0.9999f));
-    float feedbackHP = feedbackHPCoeff * (m_tapeFeedbackHPOut + m_tapeFeedbackLP - m_tapeFeedbackHPIn);
-    m_tapeFeedbackHPIn = m_tapeFeedbackLP;
-    m_tapeFeedbackHPOut = feedbackHP;
-
-    // Tape preamp behavior before writing back to the loop.
-    float inputMono = (left + right) * 0.5f;
-    float preampedInput = std::tanh(inputMono * (1.0f + m_delayFeedback * 1.4f));
-
-    m_tapeNoiseState = m_tapeNoiseState * 1664525u + 1013904223u;
-    float hiss = ((static_cast<float>((m_tapeNoiseState >> 8) & 0x00FFFFFF) / 16777216.0f) * 2.0f - 1.0f) * 0.00003f;
-
-    float writeSample = preampedInput + feedbackHP * (m_delayFeedback * 0.92f) + hiss;
-    m_delayBufferL[m_delayWritePos] = writeSample;
-    m_delayBufferR[m_delayWritePos] = writeSample * 0.985f + feedbackHP * 0.02f;
-    m_delayWritePos = (m_delayWritePos + 1) % kMaxDelayLength;
-
-    // Output tone shaping to keep repeats dark and soft.
-    const float outputToneCoeff = std::clamp((0.35f + m_delayTone * 0.35f) - m_delayFeedback * 0.15f, 0.10f, 0.90f);
-    m_tapeToneL += (echoL - m_tapeToneL) * outputToneCoeff;
-    m_tapeToneR += (echoR - m_tapeToneR) * outputToneCoeff;
-
-    float delayedL = std::tanh(m_tapeToneL * 1.25f);
-    float delayedR = std::tanh(m_tapeToneR * 1.25f);
-
-    // Mix dry/wet
-    left = left * (1.0f - m_delayMix) + delayedL * m_delayMix;
-    right = right * (1.0f - m_delayMix) + delayedR * m_delayMix;
+TapeDelayParams AudioEngine::delayParams() const {
+    TapeDelayParams params;
+    params.time = std::clamp(m_delayTime + m_delayTimeMod, 0.0f, 1.0f);
+    params.feedback = std::clamp(m_delayFeedback + m_delayFeedbackMod * 0.95f, 0.0f, 0.95f);
+    params.mix = std::clamp(m_delayMix + m_delayMixMod, 0.0f, 1.0f);
+    params.headMode = m_delayHeadMode;
+    params.wow = std::clamp(m_delayWow + m_delayWowMod, 0.0f, 1.0f);
+    params.flutter = std::clamp(m_delayFlutter + m_delayFlutterMod, 0.0f, 1.0f);
+    params.tone = m_delayTone;
+    params.sync = m_delaySync;
+    params.tempoBPM = m_delayTempoBPM;
+    params.subdivision = m_delaySubdivision;
+    return params;
 }
 
-void AudioEngine::processReverb(float& left, float& right) {
-    // Freeverb-style algorithm
-    float inputL = left;
-    float inputR = right;
-
-    // Calculate feedback based on room size
-    float feedback = m_reverbSize * 0.28f + 0.7f;
-
-    // Calculate damping filter coefficient
-    float damp1 = m_reverbDamping * 0.4f;
-    float damp2 = 1.0f - damp1;
-
-    // Accumulate comb filter outputs
-    float outL = 0.0f;
-    float outR = 0.0f;
-
-    for (size_t i = 0; i < kNumCombs; ++i) {
-        // Left channel comb
-        float combOutL = m_combBuffersL[i][m_combPos[i]];
-
-        // Apply lowpass filter (damping)
-        m_combFilters[i] = combOutL * damp2 + m_combFilters[i] * damp1;
-
-        // Write back with feedback
-        m_combBuffersL[i][m_combPos[i]] = inputL + m_combFilters[i] * feedback;
-
-        outL += combOutL;
-
-        // Right channel comb (slightly offset for stereo, with symmetric damping)
-        size_t rightPos = (m_combPos[i] + 23) % m_combLengths[i];
-        float combOutR = m_combBuffersR[i][rightPos];
-        m_combFiltersR[i] = combOutR * damp2 + m_combFiltersR[i] * damp1;
-        m_combBuffersR[i][rightPos] = inputR + m_combFiltersR[i] * feedback;
-        outR += combOutR;
-
-        // Advance position
-        m_combPos[i] = (m_combPos[i] + 1) % m_combLengths[i];
-    }
-
-    // Process through allpass filters for diffusion
-    for (size_t i = 0; i < kNumAllpasses; ++i) {
-        // Left channel
-        float bufOutL = m_allpassBuffersL[i][m_allpassPos[i]];
-        float allpassOutL = -outL + bufOutL;
-        m_allpassBuffersL[i][m_allpassPos[i]] = outL + bufOutL * 0.5f;
-        outL = allpassOutL;
-
-        // Right channel
-        float bufOutR = m_allpassBuffersR[i][m_allpassPos[i]];
-        float allpassOutR = -outR + bufOutR;
-        m_allpassBuffersR[i][m_allpassPos[i]] = outR + bufOutR * 0.5f;
-        outR = allpassOutR;
-
-        // Advance position
-        m_allpassPos[i] = (m_allpassPos[i] + 1) % m_allpassLengths[i];
-    }
-
-    // Scale output
-    outL *= 0.15f;
-    outR *= 0.15f;
+void AudioEngine::processDelay(float* left, float* right, int numFrames, const TapeDelayParams& params) {
+    if (!m_tapeDelay) return;
+    const float wetPeak = m_tapeDelay->process(left, right, numFrames, params);
+    m_delayWetPeak = std::max(m_delayWetPeak, wetPeak);
+}
 
-    // Mix dry/wet
-    left = left * (1.0f - m_reverbMix) + outL * m_reverbMix;
-    right = right * (1.0f - m_reverbMix) + outR * m_reverbMix;
+void AudioEngine::processReverb(float* left, float* right, int numFrames) {
+    if (!m_reverb) return;
+    const float wetPeak = m_reverb->process(left, right, numFrames, m_reverbSize, m_reverbDamping, m_reverbMix);
+    m_reverbWetPeak = std::max(m_reverbWetPeak, wetPeak);
 }
 
 // ========== Master Clock Implementation ==========
 
 void AudioEngine::setClockBPM(float bpm) {
-    m_clockBPM.store(std::clamp(bpm, 10.0f, 330.0f));
+    setParameter(ParameterID::ClockBPM, 0, bpm);
 }
 
 void AudioEngine::setClockRunning(bool running) {
-    if (running && !m_clockRunning.load()) {
-        // Starting clock - record start time and reset phases + euclidean counters
-        m_clockStartSample = m_currentSampleTime.load(std::memory_order_relaxed);
-        for (int i = 0; i < kNumClockOutputs; ++i) {
-            m_clockOutputs[i].phaseAccumulator = m_clockOutputs[i].phase;
-            m_clockOutputs[i].lastPhaseAccumulator = m_clockOutputs[i].phase;
-            m_clockOutputs[i].euclideanCurrentStep = 0;
-            m_clockOutputs[i].lastProcessedCycle = -1;
-            m_clockOutputs[i].pendingResync.store(false, std::memory_order_relaxed);
-            m_clockOutputs[i].lastTriggerSampleTime = m_clockStartSample;
-        }
-    }
-    m_clockRunning.store(running);
+    setParameter(ParameterID::ClockRunning, 0, running ? 1.0f : 0.0f);
 }
 
 void AudioEngine::setClockStartSample(uint64_t startSample) {
-    // Set the clock start sample explicitly for synchronization with sequencer
+    // Set the clock start sample explicitly for synchronization with sequencer.
+    // A sample time does not fit the command's float, so it rides in the payload.
+    submitParameter(ParameterCommand{ParameterID::ClockStartSample, 0, 0.0f, startSample});
+}
+
+void AudioEngine::setClockSwing(float swing) {
+    setParameter(ParameterID::ClockSwing, 0, swing);
+}
+
+void AudioEngine::resetClockPhases(uint64_t startSample) {
     m_clockStartSample = startSample;
     // Reset all phase accumulators to their initial phase offset and euclidean counters
     for (int i = 0; i < kNumClockOutputs; ++i) {
@@ -3630,10 +3521,6 @@ void AudioEngine::setClockStartSample(uint64_t startSample) {
     }
 }
 
-void AudioEngine::setClockSwing(float swing) {
-    m_clockSwing = std::clamp(swing, 0.0f, 1.0f);
-}
-
 float AudioEngine::getClockBPM() const {
     return m_clockBPM.load();
 }
@@ -3644,69 +3531,119 @@ bool AudioEngine::isClockRunning() const {
 
 void AudioEngine::setClockOutputMode(int outputIndex, int mode) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].mode = mode;
+        setParameter(ParameterID::ClockOutputMode, outputIndex, static_cast<float>(mode));
     }
 }
 
 void AudioEngine::setClockOutputWaveform(int outputIndex, int waveform) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].waveform = std::clamp(waveform, 0,
-            static_cast<int>(ClockWaveform::NumWaveforms) - 1);
+        setParameter(ParameterID::ClockOutputWaveform, outputIndex, static_cast<float>(waveform));
     }
 }
 
 void AudioEngine::setClockOutputDivision(int outputIndex, int division) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].divisionIndex = std::clamp(division, 0, 18);
+        setParameter(ParameterID::ClockOutputDivision, outputIndex, static_cast<float>(division));
     }
 }
 
 void AudioEngine::setClockOutputLevel(int outputIndex, float level) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].level = std::clamp(level, 0.0f, 1.0f);
+        setParameter(ParameterID::ClockOutputLevel, outputIndex, level);
     }
 }
 
 void AudioEngine::setClockOutputOffset(int outputIndex, float offset) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].offset = std::clamp(offset, -1.0f, 1.0f);
+        setParameter(ParameterID::ClockOutputOffset, outputIndex, offset);
     }
 }
 
 void AudioEngine::setClockOutputPhase(int outputIndex, float phase) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].phase = std::clamp(phase, 0.0f, 1.0f);
+        setParameter(ParameterID::ClockOutputPhase, outputIndex, phase);
     }
 }
 
 void AudioEngine::setClockOutputWidth(int outputIndex, float width) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].width = std::clamp(width, 0.0f, 1.0f);
+        setParameter(ParameterID::ClockOutputWidth, outputIndex, width);
     }
 }
 
 void AudioEngine::setClockOutputDestination(int outputIndex, int dest) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].destination = std::clamp(dest, 0,
-            static_cast<int>(ModulationDestination::NumDestinations) - 1);
+        setParameter(ParameterID::ClockOutputDestination, outputIndex, static_cast<float>(dest));
     }
 }
 
 void AudioEngine::setClockOutputModAmount(int outputIndex, float amount) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].modulationAmount = std::clamp(amount, 0.0f, 1.0f);
+        setParameter(ParameterID::ClockOutputModAmount, outputIndex, amount);
     }
 }
 
 void AudioEngine::setClockOutputMuted(int outputIndex, bool muted) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].muted = muted;
+        setParameter(ParameterID::ClockOutputMuted, outputIndex, muted ? 1.0f : 0.0f);
     }
 }
 
 void AudioEngine::setClockOutputSlowMode(int outputIndex, bool slow) {
     if (outputIndex >= 0 && outputIndex < kNumClockOutputs) {
-        m_clockOutputs[outputIndex].slowMode = slow;
+        setParameter(ParameterID::ClockOutputSlowMode, outputIndex, slow ? 1.0f : 0.0f);
+    }
+}
+
+// Audio thread side of the clock output setters; values arrive unclamped
+void AudioEngine::applyClockOutputParameter(ParameterID id, ClockOutputState& out, float value, uint64_t payload) {
+    const int index = static_cast<int>(std::lround(std::isfinite(value) ? value : 0.0f));
+    switch (id) {
+        case ParameterID::ClockOutputMode:
+            out.mode = index;
+            break;
+        case ParameterID::ClockOutputWaveform:
+            out.waveform = std::clamp(index, 0, static_cast<int>(ClockWaveform::NumWaveforms) - 1);
+            break;
+        case ParameterID::ClockOutputDivision:
+            out.divisionIndex = std::clamp(index, 0, 18);
+            break;
+        case ParameterID::ClockOutputLevel:
+            out.level = std::clamp(value, 0.0f, 1.0f);
+            break;
+        case ParameterID::ClockOutputOffset:
+            out.offset = std::clamp(value, -1.0f, 1.0f);
+            break;
+        case ParameterID::ClockOutputPhase:
+            out.phase = std::clamp(value, 0.0f, 1.0f);
+            break;
+        case ParameterID::ClockOutputWidth:
+            out.width = std::clamp(value, 0.0f, 1.0f);
+            break;
+        case ParameterID::ClockOutputDestination:
+            out.destination = std::clamp(index, 0, static_cast<int>(ModulationDestination::NumDestinations) - 1);
+            break;
+        case ParameterID::ClockOutputModAmount:
+            out.modulationAmount = std::clamp(value, 0.0f, 1.0f);
+            break;
+        case ParameterID::ClockOutputMuted:
+            out.muted = value > 0.5f;
+            break;
+        case ParameterID::ClockOutputSlowMode:
+            out.slowMode = value > 0.5f;
+            break;
+        case ParameterID::ClockOutputEuclidean: {
+            out.euclideanEnabled = (payload >> 40) & 1;
+            out.euclideanSteps = std::clamp(static_cast<int>((payload >> 32) & 0xFF), 1, 32);
+            for (int i = 0; i < 32; ++i) {
+                out.euclideanPattern[i] = (payload >> i) & 1;
+            }
+            // Reset step counter when pattern changes
+            out.euclideanCurrentStep = 0;
+            break;
+        }
+        default:
+            break;
     }
 }
 
@@ -3735,19 +3672,14 @@ void AudioEngine::setClockOutputEuclidean(int outputIndex, bool enabled, int ste
                                            const bool* pattern, int patternLength) {
     if (outputIndex < 0 || outputIndex >= kNumClockOutputs) return;
 
-    auto& out = m_clockOutputs[outputIndex];
-    out.euclideanEnabled = enabled;
-    out.euclideanSteps = std::clamp(steps, 1, 32);
-
-    // Copy pattern array
-    out.euclideanPattern.fill(false);
-    const int copyLen = std::min(patternLength, 32);
+    // The whole pattern goes in the command's payload word, so each queued
+    // request applies its own pattern
+    uint64_t request = (enabled ? uint64_t(1) << 40 : 0) | (static_cast<uint64_t>(std::clamp(steps, 1, 32)) << 32);
+    const int copyLen = pattern ? std::min(patternLength, 32) : 0;
     for (int i = 0; i < copyLen; ++i) {
-        out.euclideanPattern[i] = pattern[i];
+        if (pattern[i]) request |= uint64_t(1) << i;
     }
-
-    // Reset step counter when pattern changes
-    out.euclideanCurrentStep = 0;
+    submitParameter(ParameterCommand{ParameterID::ClockOutputEuclidean, outputIndex, 0.0f, request});
 }
 
 int AudioEngine::getClockOutputEuclideanStep(int outputIndex) const {
@@ -3882,6 +3814,7 @@ void AudioEngine::processClockOutputs(int numFrames) {
     }
 
     const size_t scopeWi = m_scopeWriteIndex.load(std::memory_order_relaxed);
+    const bool captureScope = !m_offlineRenderActive.load(std::memory_order_relaxed);
 
     // Process each clock output
     for (int i = 0; i < kNumClockOutputs; ++i) {
@@ -3891,7 +3824,7 @@ void AudioEngine::processClockOutputs(int numFrames) {
             out.currentValue = 0.0f;
             m_clockOutputValues[i].store(0.0f);
             // Zero scope buffer for muted outputs
-            for (int s = 0; s < numFrames; ++s) {
+            for (int s = 0; captureScope && s < numFrames; ++s) {
                 m_scopeBuffer[9 + i][(scopeWi + s) % kScopeBufferSize] = 0.0f;
             }
             continue;
@@ -3981,7 +3914,7 @@ void AudioEngine::processClockOutputs(int numFrames) {
         // For S&H/Random, repeat the final value (state-dependent).
         const bool isStateless = out.waveform != static_cast<int>(ClockWaveform::Random) &&
                                   out.waveform != static_cast<int>(ClockWaveform::SampleHold);
-        if (isStateless) {
+        if (captureScope && isStateless) {
             for (int s = 0; s < numFrames; ++s) {
                 // Compute continuous cycle position for this sample
                 const double sampleCycles = startCycles + cyclesPerSample * static_cast<double>(s);
@@ -4020,7 +3953,7 @@ void AudioEngine::processClockOutputs(int numFrames) {
                 m_scopeBuffer[9 + i][(scopeWi + s) % kScopeBufferSize] =
                     std::clamp(raw * out.level + out.offset, -1.0f, 1.0f);
             }
-        } else {
+        } else if (captureScope) {
             // S&H and Random: repeat the final computed value
             for (int s = 0; s < numFrames; ++s) {
                 m_scopeBuffer[9 + i][(scopeWi + s) % kScopeBufferSize] = finalValue;
@@ -4067,24 +4000,23 @@ void AudioEngine::processClockOutputs(int numFrames) {
 
                     if (shouldFire) {
                         // Schedule NoteOn
-                        ScheduledNoteEvent onEvent;
+                        TimelineEvent onEvent{};
                         onEvent.sampleTime = triggerSample;
+                        onEvent.type = TimelineEventType::NoteOn;
                         onEvent.note = static_cast<uint8_t>(note);
                         onEvent.velocity = static_cast<uint8_t>(velocity);
-                        onEvent.isNoteOn = true;
                         onEvent.targetMask = mask;
                         onEvent.trackId = 0;
-                        enqueueScheduledEvent(onEvent);
+                        m_eventTimeline->push(onEvent);
 
                         // Schedule NoteOff (gate release)
-                        ScheduledNoteEvent offEvent;
+                        TimelineEvent offEvent{};
                         offEvent.sampleTime = triggerSample + gateSamples;
+                        offEvent.type = TimelineEventType::NoteOff;
                         offEvent.note = static_cast<uint8_t>(note);
-                        offEvent.velocity = 0;
-                        offEvent.isNoteOn = false;
                         offEvent.targetMask = mask;
                         offEvent.trackId = 0;
-                        enqueueScheduledEvent(offEvent);
+                        m_eventTimeline->push(offEvent);
                     }
 
                     out.lastTriggerSampleTime = triggerSample;
@@ -4108,7 +4040,7 @@ void AudioEngine::applyModulation() {
     float timbreMod = m_modulationValues[static_cast<int>(ModulationDestination::PlaitsTimbre)];
     float morphMod = m_modulationValues[static_cast<int>(ModulationDestination::PlaitsMorph)];
 
-    for (int i = 0; i < kNumPlaitsVoices; ++i) {
+    for (int i = 0; i < kMaxPlaitsVoices; ++i) {
         if (m_plaitsVoices[i]) {
             m_plaitsVoices[i]->SetHarmonicsModAmount(harmonicsMod);
             m_plaitsVoices[i]->SetTimbreModAmount(timbreMod);
@@ -4149,81 +4081,39 @@ void AudioEngine::applyModulation() {
         m_daisyDrumVoice->SetMorphMod(m_modulationValues[static_cast<int>(ModulationDestination::DaisyDrumMorph)]);
     }
 
-    // Note: Delay modulation would be applied similarly
-    // but requires additional state tracking for smooth modulation
+    // Delay modulation - TapeDelay ramps to these at control rate across the block
+    m_delayTimeMod = m_modulationValues[static_cast<int>(ModulationDestination::DelayTime)];
+    m_delayFeedbackMod = m_modulationValues[static_cast<int>(ModulationDestination::DelayFeedback)];
+    m_delayMixMod = m_modulationValues[static_cast<int>(ModulationDestination::DelayMix)];
+    m_delayWowMod = m_modulationValues[static_cast<int>(ModulationDestination::DelayWow)];
+    m_delayFlutterMod = m_modulationValues[static_cast<int>(ModulationDestination::DelayFlutter)];
 }
 
 // ========== Master Filter Implementation ==========
 
 void AudioEngine::initMasterFilter() {
-    // Create filter instances based on selected model
-    auto createFilter = [this](int model) -> std::unique_ptr<LadderFilterBase> {
-        switch (model) {
-            case 0: return std::make_unique<StilsonMoog>(static_cast<float>(m_sampleRate));
-            case 1: return std::make_unique<MicrotrackerMoog>(static_cast<float>(m_sampleRate));
-            case 2: return std::make_unique<KrajeskiMoog>(static_cast<float>(m_sampleRate));
-            case 3: return std::make_unique<MusicDSPMoog>(static_cast<float>(m_sampleRate));
-            case 4: return std::make_unique<OberheimVariationMoog>(static_cast<float>(m_sampleRate));
-            case 5: return std::make_unique<ImprovedMoog>(static_cast<float>(m_sampleRate));
-            case 6: return std::make_unique<RKSimulationMoog>(static_cast<float>(m_sampleRate));
-            case 7: return std::make_unique<HyperionMoog>(static_cast<float>(m_sampleRate));
-            case 8: return std::make_unique<DaisyLadderMoog>(static_cast<float>(m_sampleRate));
-            case 9: return std::make_unique<CytomicSvfMoog>(static_cast<float>(m_sampleRate));
-            default: return std::make_unique<HyperionMoog>(static_cast<float>(m_sampleRate));
-        }
-    };
-
-    m_masterFilterL = createFilter(m_masterFilterModel);
-    m_masterFilterR = createFilter(m_masterFilterModel);
-
-    updateMasterFilterParameters();
-}
-
-void AudioEngine::updateMasterFilterParameters() {
-    if (!m_masterFilterL || !m_masterFilterR) return;
-
-    // Model-specific stability limits (same as GranularVoice)
-    float cutoffLimit = 0.45f;
-    float resonanceMax = 1.0f;
-
-    switch (m_masterFilterModel) {
-        case 0:  cutoffLimit = 0.45f; resonanceMax = 0.95f; break;  // Stilson
-        case 1:  cutoffLimit = 0.45f; resonanceMax = 0.92f; break;  // Microtracker
-        case 2:  cutoffLimit = 0.45f; resonanceMax = 0.93f; break;  // Krajeski
-        case 3:  cutoffLimit = 0.42f; resonanceMax = 0.88f; break;  // MusicDSP
-        case 4:  cutoffLimit = 0.40f; resonanceMax = 0.86f; break;  // OberheimVariation
-        case 5:  cutoffLimit = 0.40f; resonanceMax = 0.82f; break;  // Improved
-        case 6:  cutoffLimit = 0.35f; resonanceMax = 0.55f; break;  // RKSimulation
-        case 7:  cutoffLimit = 0.42f; resonanceMax = 0.88f; break;  // Hyperion
-        case 8:  cutoffLimit = 0.45f; resonanceMax = 0.95f; break;  // DaisyLadder
-        case 9:  cutoffLimit = 0.49f; resonanceMax = 1.0f;  break;  // CytomicSVF
-        default: break;
-    }
-
-    const float nyquist = static_cast<float>(m_sampleRate) * 0.5f;
-    const float safeCutoff = std::max(20.0f, std::min(m_masterFilterCutoff, nyquist * cutoffLimit));
-    const float safeResonance = std::max(0.0f, std::min(m_masterFilterResonance, resonanceMax));
-
-    m_masterFilterL->SetCutoff(safeCutoff);
-    m_masterFilterR->SetCutoff(safeCutoff);
-    m_masterFilterL->SetResonance(safeResonance);
-    m_masterFilterR->SetResonance(safeResonance);
+    // Builds every model up front (not real-time safe); model changes then crossfade
+    m_masterFilter = std::make_unique<LadderFilterBank>(static_cast<float>(m_sampleRate), m_masterFilterModel);
+    m_masterFilter->SetResonance(m_masterFilterResonance);
 }
 
-void AudioEngine::processMasterFilter(float& left, float& right) {
-    if (!m_masterFilterL || !m_masterFilterR) return;
+void AudioEngine::processMasterFilter(float* left, float* right, int numFrames) {
+    if (!m_masterFilter) return;
 
     // Apply soft saturation before filter to prevent extreme peaks
-    left = std::tanh(left * 0.5f) * 2.0f;
-    right = std::tanh(right * 0.5f) * 2.0f;
+    for (int i = 0; i < numFrames; ++i) {
+        left[i] = fastmath::tanh(left[i] * 0.5f) * 2.0f;
+        right[i] = fastmath::tanh(right[i] * 0.5f) * 2.0f;
+    }
 
-    // Process through filters (single sample at a time)
-    m_masterFilterL->Process(&left, 1);
-    m_masterFilterR->Process(&right, 1);
+    // Both channels in one pass; the cutoff ramps from the previous buffer's value
+    if (!m_masterFilter->Process(left, right, static_cast<uint32_t>(numFrames), m_masterFilterCutoff)) return;
 
     // Snap to zero to prevent denormals
-    if (std::fabs(left) < 1.0e-20f) left = 0.0f;
-    if (std::fabs(right) < 1.0e-20f) right = 0.0f;
+    for (int i = 0; i < numFrames; ++i) {
+        if (std::fabs(left[i]) < 1.0e-20f) left[i] = 0.0f;
+        if (std::fabs(right[i]) < 1.0e-20f) right[i] = 0.0f;
+    }
 }
 
 // MARK: - Master Compressor
@@ -4419,6 +4309,127 @@ int AudioEngine::readMasterCaptureBuffer(float* left, float* right, int maxFrame
     return m_masterCaptureRing.read(left, right, maxFrames);
 }
 
+// MARK: - Offline Render
+
+namespace {
+
+// Interleave a stereo block into WAV sample bytes (little-endian PCM 16/24 or float 32)
+void encodeWavFrames(const float* left, const float* right, int numFrames, int bitsPerSample, uint8_t* out) {
+    if (bitsPerSample == 32) {
+        float* dst = reinterpret_cast<float*>(out);
+        for (int i = 0; i < numFrames; ++i) {
+            dst[2 * i] = left[i];
+            dst[2 * i + 1] = right[i];
+        }
+        return;
+    }
+
+    const float scale = bitsPerSample == 16 ? 32767.0f : 8388607.0f;
+    const int bytes = bitsPerSample / 8;
+    for (int i = 0; i < numFrames; ++i) {
+        for (const float sample : {left[i], right[i]}) {
+            const int32_t value = static_cast<int32_t>(std::lrint(std::clamp(sample, -1.0f, 1.0f) * scale));
+            for (int b = 0; b < bytes; ++b) {
+                *out++ = static_cast<uint8_t>(value >> (8 * b));
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool AudioEngine::renderOffline(const char* wavPath, uint64_t numFrames, int bitsPerSample,
+                                OfflineBlockCallback callback, void* context) {
+    if (!wavPath || numFrames == 0 || !m_initialized.load()) return false;
+    if (bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32) return false;
+    // The processing thread renders on its own schedule; it has to be stopped first
+    if (m_multiChannelProcessingActive.load(std::memory_order_acquire)) return false;
+
+    bool expected = false;
+    if (!m_offlineRenderActive.compare_exchange_strong(expected, true)) return false;  // One bounce at a time
+
+    // Let live callbacks that started before the flag was raised finish
+    while (m_liveRendersInFlight.load() != 0) {
+        std::this_thread::yield();
+    }
+    // ...and a control thread applying parameters while audio was stopped
+    { std::lock_guard<std::mutex> lock(m_directParameterMutex); }
+    m_offlineRenderCancelled.store(false, std::memory_order_relaxed);
+    m_offlineRenderProgress.store(0.0f, std::memory_order_relaxed);
+    // A bounce must not depend on which background hit renders have finished:
+    // drum lanes synthesize every hit, as with the cache off. Likewise it must
+    // not outrun the sampler's disk streaming.
+    m_drumHitCache->SetBypassed(true);
+    if (m_wavSamplerVoice) m_wavSamplerVoice->SetOfflineRendering(true);
+
+    drwav_data_format format{};
+    format.container = drwav_container_riff;
+    format.format = bitsPerSample == 32 ? DR_WAVE_FORMAT_IEEE_FLOAT : DR_WAVE_FORMAT_PCM;
+    format.channels = 2;
+    format.sampleRate = static_cast<drwav_uint32>(m_sampleRate);
+    format.bitsPerSample = static_cast<drwav_uint32>(bitsPerSample);
+
+    drwav wav;
+    if (!drwav_init_file_write(&wav, wavPath, &format, nullptr)) {
+        m_drumHitCache->SetBypassed(false);
+        if (m_wavSamplerVoice) m_wavSamplerVoice->SetOfflineRendering(false);
+        m_offlineRenderActive.store(false, std::memory_order_release);
+        return false;
+    }
+
+    std::vector<float> left(kMaxBufferSize);
+    std::vector<float> right(kMaxBufferSize);
+    std::vector<uint8_t> encoded(static_cast<size_t>(kMaxBufferSize) * 2 * (bitsPerSample / 8));
+    float* outputs[2] = {left.data(), right.data()};
+
+    // Blocks run back to back on the engine's own sample clock, so scheduled
+    // events land on the same samples they would in real time.
+    bool completed = true;
+    uint64_t rendered = 0;
+    while (rendered < numFrames) {
+        if (m_offlineRenderCancelled.load(std::memory_order_relaxed)) {
+            completed = false;
+            break;
+        }
+
+        const int blockFrames = static_cast<int>(std::min<uint64_t>(kMaxBufferSize, numFrames - rendered));
+        if (callback) {
+            callback(context, m_currentSampleTime.load(std::memory_order_relaxed), blockFrames);
+        }
+        processBlock(nullptr, outputs, 2, blockFrames);
+
+        encodeWavFrames(left.data(), right.data(), blockFrames, bitsPerSample, encoded.data());
+        if (drwav_write_pcm_frames(&wav, static_cast<drwav_uint64>(blockFrames), encoded.data()) != static_cast<drwav_uint64>(blockFrames)) {
+            completed = false;
+            break;
+        }
+        rendered += static_cast<uint64_t>(blockFrames);
+        m_offlineRenderProgress.store(static_cast<float>(static_cast<double>(rendered) / static_cast<double>(numFrames)),
+                                      std::memory_order_relaxed);
+    }
+
+    drwav_uninit(&wav);
+    if (!completed) {
+        std::remove(wavPath);  // Don't leave a truncated bounce behind
+    }
+    m_drumHitCache->SetBypassed(false);
+    if (m_wavSamplerVoice) m_wavSamplerVoice->SetOfflineRendering(false);
+    m_offlineRenderActive.store(false, std::memory_order_release);
+    return completed;
+}
+
+void AudioEngine::cancelOfflineRender() {
+    m_offlineRenderCancelled.store(true, std::memory_order_relaxed);
+}
+
+bool AudioEngine::isOfflineRenderActive() const {
+    return m_offlineRenderActive.load(std::memory_order_acquire);
+}
+
+float AudioEngine::getOfflineRenderProgress() const {
+    return m_offlineRenderProgress.load(std::memory_order_relaxed);
+}
+
 // MARK: - Multi-Channel Processing Thread
 
 void AudioEngine::startMultiChannelProcessing() {
@@ -4495,7 +4506,7 @@ void AudioEngine::startRecording(int reelIndex, int mode, int sourceType, int so
 
     // Create reel buffer if needed
     if (!m_reelBuffers[reelIndex]) {
-        m_reelBuffers[reelIndex] = std::make_unique<ReelBuffer>();
+        m_reelBuffers[reelIndex] = std::make_unique<ReelBuffer>(m_reelPagePool.get());
     }
 
     auto& reel = m_reelBuffers[reelIndex];
@@ -4597,9 +4608,7 @@ void AudioEngine::processRecordingForChannel(int channelIndex, const float* srcL
         auto& reel = m_reelBuffers[targetReel];
         if (!reel || !reel->IsRecording()) continue;
 
-        for (int i = 0; i < numFrames; ++i) {
-            reel->RecordSampleWithFeedback(srcLeft[i], srcRight[i]);
-        }
+        reel->RecordBlockWithFeedback(srcLeft, srcRight, static_cast<size_t>(numFrames));
     }
 }
 
@@ -4618,9 +4627,7 @@ void AudioEngine::processExternalInputRecording(int numFrames) {
         auto& reel = m_reelBuffers[targetReel];
         if (!reel || !reel->IsRecording()) continue;
 
-        for (int i = 0; i < framesToProcess; ++i) {
-            reel->RecordSampleWithFeedback(m_externalInputL[i], m_externalInputR[i]);
-        }
+        reel->RecordBlockWithFeedback(m_externalInputL, m_externalInputR, static_cast<size_t>(framesToProcess));
     }
 }
 
@@ -7,6 +7,7 @@
 
 #include "AudioEngineBridge.h"
 #include "AudioEngine.h"
+#include "RenderProfiler.h"
 
 using namespace Grainulator;
 
@@ -123,6 +124,71 @@ float AudioEngine_GetCPULoad(AudioEngineHandle handle) {
     return static_cast<AudioEngine*>(handle)->getCPULoad();
 }
 
+uint64_t AudioEngine_GetDroppedParameterCommandCount(AudioEngineHandle handle) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getDroppedParameterCommandCount();
+}
+
+int AudioEngine_GetRenderStageCount(void) {
+    return kNumRenderStages;
+}
+
+const char* AudioEngine_GetRenderStageName(int stage) {
+    return renderStageName(stage);
+}
+
+bool AudioEngine_GetRenderStageStats(AudioEngineHandle handle, int path, int stage,
+                                     float* meanLoad, float* p99Load, float* maxLoad, float* meanNsPerSample) {
+    if (!handle) return false;
+    RenderStageStats stats{};
+    if (!static_cast<AudioEngine*>(handle)->getRenderStageStats(path, stage, stats)) return false;
+    if (meanLoad) *meanLoad = stats.meanLoad;
+    if (p99Load) *p99Load = stats.p99Load;
+    if (maxLoad) *maxLoad = stats.maxLoad;
+    if (meanNsPerSample) *meanNsPerSample = stats.meanNsPerSample;
+    return true;
+}
+
+uint64_t AudioEngine_GetDeadlineMissCount(AudioEngineHandle handle, int path) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getDeadlineMissCount(path);
+}
+
+void AudioEngine_ResetRenderProfiler(AudioEngineHandle handle) {
+    if (!handle) return;
+    static_cast<AudioEngine*>(handle)->resetRenderProfiler();
+}
+
+void AudioEngine_SetRenderWorkerCount(AudioEngineHandle handle, int count) {
+    if (!handle) return;
+    static_cast<AudioEngine*>(handle)->setRenderWorkerCount(count);
+}
+
+int AudioEngine_GetRenderWorkerCount(AudioEngineHandle handle) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getRenderWorkerCount();
+}
+
+void AudioEngine_SetPlaitsVoiceCount(AudioEngineHandle handle, int count) {
+    if (!handle) return;
+    static_cast<AudioEngine*>(handle)->setPlaitsVoiceCount(count);
+}
+
+int AudioEngine_GetPlaitsVoiceCount(AudioEngineHandle handle) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getPlaitsVoiceCount();
+}
+
+void AudioEngine_SetDrumHitCacheEnabled(AudioEngineHandle handle, bool enabled) {
+    if (!handle) return;
+    static_cast<AudioEngine*>(handle)->setDrumHitCacheEnabled(enabled);
+}
+
+bool AudioEngine_IsDrumHitCacheEnabled(AudioEngineHandle handle) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->isDrumHitCacheEnabled();
+}
+
 void AudioEngine_TriggerPlaits(AudioEngineHandle handle, bool state) {
     if (handle) {
         static_cast<AudioEngine*>(handle)->triggerPlaits(state);
@@ -199,6 +265,29 @@ void AudioEngine_ClearScheduledNotes(AudioEngineHandle handle) {
     }
 }
 
+void AudioEngine_ScheduleParameter(AudioEngineHandle handle, int parameterId, int voiceIndex, float value, uint64_t sampleTime) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->scheduleParameter(
+            static_cast<AudioEngine::ParameterID>(parameterId),
+            voiceIndex,
+            value,
+            sampleTime
+        );
+    }
+}
+
+void AudioEngine_ScheduleTrigger(AudioEngineHandle handle, int trigger, int laneIndex, bool state, uint64_t sampleTime) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->scheduleTrigger(trigger, laneIndex, state, sampleTime);
+    }
+}
+
+void AudioEngine_ScheduleReelOperation(AudioEngineHandle handle, int operation, int index, float value, uint64_t sampleTime) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->scheduleReelOperation(operation, index, value, sampleTime);
+    }
+}
+
 uint64_t AudioEngine_GetCurrentSampleTime(AudioEngineHandle handle) {
     if (!handle) return 0;
     return static_cast<AudioEngine*>(handle)->getCurrentSampleTime();
@@ -211,6 +300,16 @@ bool AudioEngine_LoadAudioData(AudioEngineHandle handle, int reelIndex, const fl
     return static_cast<AudioEngine*>(handle)->loadAudioData(reelIndex, leftChannel, rightChannel, numSamples, sampleRate);
 }
 
+bool AudioEngine_LoadAudioFile(AudioEngineHandle handle, int reelIndex, const char* filePath) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->loadAudioFile(filePath, reelIndex);
+}
+
+float AudioEngine_GetReelLoadProgress(AudioEngineHandle handle, int reelIndex) {
+    if (!handle) return 1.0f;
+    return static_cast<AudioEngine*>(handle)->getReelLoadProgress(reelIndex);
+}
+
 void AudioEngine_ClearReel(AudioEngineHandle handle, int reelIndex) {
     if (handle) {
         static_cast<AudioEngine*>(handle)->clearReel(reelIndex);
@@ -222,6 +321,21 @@ size_t AudioEngine_GetReelLength(AudioEngineHandle handle, int reelIndex) {
     return static_cast<AudioEngine*>(handle)->getReelLength(reelIndex);
 }
 
+size_t AudioEngine_GetReelMemoryUsage(AudioEngineHandle handle, int reelIndex) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getReelMemoryUsage(reelIndex);
+}
+
+size_t AudioEngine_GetTotalReelMemoryUsage(AudioEngineHandle handle) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getTotalReelMemoryUsage();
+}
+
+uint64_t AudioEngine_GetReelDroppedRecordFrames(AudioEngineHandle handle, int reelIndex) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getReelDroppedRecordFrames(reelIndex);
+}
+
 float AudioEngine_GetReelSampleRate(AudioEngineHandle handle, int reelIndex) {
     if (!handle) return 48000.0f;
     return static_cast<AudioEngine*>(handle)->getReelSampleRate(reelIndex);
@@ -267,6 +381,11 @@ float AudioEngine_GetChannelLevel(AudioEngineHandle handle, int channelIndex) {
     return static_cast<AudioEngine*>(handle)->getChannelLevel(channelIndex);
 }
 
+float AudioEngine_GetChannelRMSLevel(AudioEngineHandle handle, int channelIndex) {
+    if (!handle) return 0.0f;
+    return static_cast<AudioEngine*>(handle)->getChannelRMSLevel(channelIndex);
+}
+
 float AudioEngine_GetMasterLevel(AudioEngineHandle handle, int channel) {
     if (!handle) return 0.0f;
     return static_cast<AudioEngine*>(handle)->getMasterLevel(channel);
@@ -299,6 +418,12 @@ void AudioEngine_SetClockRunning(AudioEngineHandle handle, bool running) {
     }
 }
 
+void AudioEngine_ScheduleClockStartSample(AudioEngineHandle handle, uint64_t startSample, uint64_t sampleTime) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->scheduleClockStartSample(startSample, sampleTime);
+    }
+}
+
 void AudioEngine_SetClockStartSample(AudioEngineHandle handle, uint64_t startSample) {
     if (handle) {
         static_cast<AudioEngine*>(handle)->setClockStartSample(startSample);
@@ -634,6 +759,50 @@ const char* AudioEngine_GetWavSamplerInstrumentName(AudioEngineHandle handle) {
     return static_cast<AudioEngine*>(handle)->getWavSamplerInstrumentName();
 }
 
+void AudioEngine_SetSamplerStreamingEnabled(AudioEngineHandle handle, bool enabled) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->setSamplerStreamingEnabled(enabled);
+    }
+}
+
+bool AudioEngine_IsSamplerStreamingEnabled(AudioEngineHandle handle) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->isSamplerStreamingEnabled();
+}
+
+uint64_t AudioEngine_GetSamplerStreamStarvationCount(AudioEngineHandle handle) {
+    if (!handle) return 0;
+    return static_cast<AudioEngine*>(handle)->getSamplerStreamStarvationCount();
+}
+
+void AudioEngine_SetSamplerCompactStorageEnabled(AudioEngineHandle handle, bool enabled) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->setSamplerCompactStorageEnabled(enabled);
+    }
+}
+
+bool AudioEngine_IsSamplerCompactStorageEnabled(AudioEngineHandle handle) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->isSamplerCompactStorageEnabled();
+}
+
+void AudioEngine_SetSamplerCacheDirectory(AudioEngineHandle handle, const char* path) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->setSamplerCacheDirectory(path);
+    }
+}
+
+float AudioEngine_GetSamplerLoadProgress(AudioEngineHandle handle) {
+    if (!handle) return 0.0f;
+    return static_cast<AudioEngine*>(handle)->getSamplerLoadProgress();
+}
+
+void AudioEngine_CancelSamplerLoad(AudioEngineHandle handle) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->cancelSamplerLoad();
+    }
+}
+
 void AudioEngine_SetSamplerMode(AudioEngineHandle handle, int mode) {
     if (handle) {
         AudioEngine::SamplerMode m;
@@ -670,6 +839,30 @@ int AudioEngine_ReadMasterCaptureBuffer(AudioEngineHandle handle, float* left, f
     return static_cast<AudioEngine*>(handle)->readMasterCaptureBuffer(left, right, maxFrames);
 }
 
+// ========== Offline Render ==========
+
+bool AudioEngine_RenderOffline(AudioEngineHandle handle, const char* wavPath, uint64_t numFrames, int bitsPerSample,
+                               AudioEngine_OfflineBlockCallback callback, void* context) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->renderOffline(wavPath, numFrames, bitsPerSample, callback, context);
+}
+
+void AudioEngine_CancelOfflineRender(AudioEngineHandle handle) {
+    if (handle) {
+        static_cast<AudioEngine*>(handle)->cancelOfflineRender();
+    }
+}
+
+bool AudioEngine_IsOfflineRenderActive(AudioEngineHandle handle) {
+    if (!handle) return false;
+    return static_cast<AudioEngine*>(handle)->isOfflineRenderActive();
+}
+
+float AudioEngine_GetOfflineRenderProgress(AudioEngineHandle handle) {
+    if (!handle) return 0.0f;
+    return static_cast<AudioEngine*>(handle)->getOfflineRenderProgress();
+}
+
 float AudioEngine_GetCompressorGainReduction(AudioEngineHandle handle) {
     if (!handle) return 0.0f;
     return static_cast<AudioEngine*>(handle)->getCompressorGainReductionDb();
@@ -47,6 +47,30 @@ void AudioEngine_SetSendReturnLevel(AudioEngineHandle handle, int sendIndex, flo
 
 // Performance metrics
 float AudioEngine_GetCPULoad(AudioEngineHandle handle);
+uint64_t AudioEngine_GetDroppedParameterCommandCount(AudioEngineHandle handle);
+
+// Render profiler
+// path: 0=AudioEngine_Process, 1=multi-channel render
+// stage: 0..AudioEngine_GetRenderStageCount()-1 (last stage is the whole callback)
+// Loads are fractions of the callback deadline (1.0 = full budget); max is the peak since reset.
+int AudioEngine_GetRenderStageCount(void);
+const char* AudioEngine_GetRenderStageName(int stage);
+bool AudioEngine_GetRenderStageStats(AudioEngineHandle handle, int path, int stage,
+                                     float* meanLoad, float* p99Load, float* maxLoad, float* meanNsPerSample);
+uint64_t AudioEngine_GetDeadlineMissCount(AudioEngineHandle handle, int path);
+void AudioEngine_ResetRenderProfiler(AudioEngineHandle handle);
+
+// Parallel voice rendering (0 = render all voices on the audio thread)
+void AudioEngine_SetRenderWorkerCount(AudioEngineHandle handle, int count);
+int AudioEngine_GetRenderWorkerCount(AudioEngineHandle handle);
+
+// Plaits polyphony (1-16 voices available to new notes)
+void AudioEngine_SetPlaitsVoiceCount(AudioEngineHandle handle, int count);
+int AudioEngine_GetPlaitsVoiceCount(AudioEngineHandle handle);
+
+// Pre-rendered hits for the drum sequencer lanes (on by default)
+void AudioEngine_SetDrumHitCacheEnabled(AudioEngineHandle handle, bool enabled);
+bool AudioEngine_IsDrumHitCacheEnabled(AudioEngineHandle handle);
 
 // Trigger control
 void AudioEngine_TriggerPlaits(AudioEngineHandle handle, bool state);
@@ -63,12 +87,24 @@ void AudioEngine_ScheduleNoteOffTarget(AudioEngineHandle handle, int note, uint6
 void AudioEngine_ScheduleNoteOnTargetTagged(AudioEngineHandle handle, int note, int velocity, uint64_t sampleTime, uint8_t targetMask, uint8_t trackId);
 void AudioEngine_ScheduleNoteOffTargetTagged(AudioEngineHandle handle, int note, uint64_t sampleTime, uint8_t targetMask, uint8_t trackId);
 void AudioEngine_ClearScheduledNotes(AudioEngineHandle handle);
+void AudioEngine_ScheduleParameter(AudioEngineHandle handle, int parameterId, int voiceIndex, float value, uint64_t sampleTime);
+void AudioEngine_ScheduleClockStartSample(AudioEngineHandle handle, uint64_t startSample, uint64_t sampleTime);
+void AudioEngine_ScheduleTrigger(AudioEngineHandle handle, int trigger, int laneIndex, bool state, uint64_t sampleTime);
+void AudioEngine_ScheduleReelOperation(AudioEngineHandle handle, int operation, int index, float value, uint64_t sampleTime);
 uint64_t AudioEngine_GetCurrentSampleTime(AudioEngineHandle handle);
 
 // Granular buffer management
 bool AudioEngine_LoadAudioData(AudioEngineHandle handle, int reelIndex, const float* leftChannel, const float* rightChannel, size_t numSamples, float sampleRate);
+// Streams a WAV/AIFF file into a reel on a background thread. Returns false if
+// the file can't be opened (fall back to decoding it and AudioEngine_LoadAudioData).
+bool AudioEngine_LoadAudioFile(AudioEngineHandle handle, int reelIndex, const char* filePath);
+// 0-1 while loading, 1 when idle/complete, -1 if the last load failed
+float AudioEngine_GetReelLoadProgress(AudioEngineHandle handle, int reelIndex);
 void AudioEngine_ClearReel(AudioEngineHandle handle, int reelIndex);
 size_t AudioEngine_GetReelLength(AudioEngineHandle handle, int reelIndex);
+size_t AudioEngine_GetReelMemoryUsage(AudioEngineHandle handle, int reelIndex);
+size_t AudioEngine_GetTotalReelMemoryUsage(AudioEngineHandle handle);
+uint64_t AudioEngine_GetReelDroppedRecordFrames(AudioEngineHandle handle, int reelIndex);
 void AudioEngine_GetWaveformOverview(AudioEngineHandle handle, int reelIndex, float* output, size_t outputSize);
 void AudioEngine_SetGranularPlaying(AudioEngineHandle handle, int voiceIndex, bool playing);
 void AudioEngine_SetGranularPosition(AudioEngineHandle handle, int voiceIndex, float position);
@@ -77,6 +113,7 @@ float AudioEngine_GetGranularPosition(AudioEngineHandle handle, int voiceIndex);
 
 // Level metering
 float AudioEngine_GetChannelLevel(AudioEngineHandle handle, int channelIndex);
+float AudioEngine_GetChannelRMSLevel(AudioEngineHandle handle, int channelIndex);
 float AudioEngine_GetMasterLevel(AudioEngineHandle handle, int channel);
 
 // Scope buffer access (for oscilloscope visualization)
@@ -116,6 +153,14 @@ bool AudioEngine_LoadWavSampler(AudioEngineHandle handle, const char* dirPath);
 bool AudioEngine_LoadSfzFile(AudioEngineHandle handle, const char* sfzPath);
 void AudioEngine_UnloadWavSampler(AudioEngineHandle handle);
 const char* AudioEngine_GetWavSamplerInstrumentName(AudioEngineHandle handle);
+void AudioEngine_SetSamplerStreamingEnabled(AudioEngineHandle handle, bool enabled);
+bool AudioEngine_IsSamplerStreamingEnabled(AudioEngineHandle handle);
+uint64_t AudioEngine_GetSamplerStreamStarvationCount(AudioEngineHandle handle);
+void AudioEngine_SetSamplerCompactStorageEnabled(AudioEngineHandle handle, bool enabled);
+bool AudioEngine_IsSamplerCompactStorageEnabled(AudioEngineHandle handle);
+void AudioEngine_SetSamplerCacheDirectory(AudioEngineHandle handle, const char* path);
+float AudioEngine_GetSamplerLoadProgress(AudioEngineHandle handle);
+void AudioEngine_CancelSamplerLoad(AudioEngineHandle handle);
 void AudioEngine_SetSamplerMode(AudioEngineHandle handle, int mode);
 
 // Master output capture (for file recording)
@@ -124,6 +169,18 @@ void AudioEngine_StopMasterCapture(AudioEngineHandle handle);
 bool AudioEngine_IsMasterCaptureActive(AudioEngineHandle handle);
 int AudioEngine_ReadMasterCaptureBuffer(AudioEngineHandle handle, float* left, float* right, int maxFrames);
 
+// Offline bounce: renders numFrames of the master mix faster than real time into a
+// WAV file (bitsPerSample 16/24 PCM or 32 float). Blocks until done, so call it off
+// the main thread; live render calls output silence meanwhile. The optional callback
+// runs before each block with its start on the engine sample clock, for scheduling
+// that block's events.
+typedef void (*AudioEngine_OfflineBlockCallback)(void* context, uint64_t blockStartSample, int numFrames);
+bool AudioEngine_RenderOffline(AudioEngineHandle handle, const char* wavPath, uint64_t numFrames, int bitsPerSample,
+                               AudioEngine_OfflineBlockCallback callback, void* context);
+void AudioEngine_CancelOfflineRender(AudioEngineHandle handle);
+bool AudioEngine_IsOfflineRenderActive(AudioEngineHandle handle);
+float AudioEngine_GetOfflineRenderProgress(AudioEngineHandle handle);
+
 #ifdef __cplusplus
 }
 #endif
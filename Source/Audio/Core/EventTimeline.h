@@ -0,0 +1,206 @@
+//
+//  EventTimeline.h
+//  Grainulator
+//
+//  Sample-timestamped event timeline for the audio thread.
+//  Producers (UI, sequencer, MIDI) push into a bounded lock-free MPSC queue;
+//  the audio thread drains it once per callback into a fixed-capacity binary
+//  min-heap and pops only the events that fall inside the current buffer.
+//  No allocation or locking after construction.
+//
+
+#ifndef EVENTTIMELINE_H
+#define EVENTTIMELINE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "MpscQueue.h"
+
+namespace Grainulator {
+
+/// Event kinds. Order doubles as the same-sample dispatch priority: parameter
+/// and reel changes land before notes, and note-offs before note-ons so 100%
+/// gate lengths still produce a deterministic retrigger edge.
+enum class TimelineEventType : uint8_t {
+    Parameter = 0,      // id = ParameterID, index = voice, value
+    ReelOperation,      // id = ReelOperation, index = voice/reel, value
+    NoteOff,            // note, targetMask, trackId
+    Trigger,            // id = TimelineTrigger, index = lane, value = gate (0/1)
+    NoteOn              // note, velocity, targetMask, trackId
+};
+
+enum class TimelineTrigger : int32_t {
+    Plaits = 0,
+    DaisyDrum,
+    DrumSeqLane
+};
+
+enum class ReelOperation : int32_t {
+    Play = 0,           // Start granular/looper playback on voice `index`
+    Stop,               // Stop playback on voice `index`
+    Seek,               // Jump voice `index` to normalized position `value`
+    StopRecording       // Stop recording into reel `index`
+};
+
+struct TimelineEvent {
+    uint64_t sampleTime;
+    TimelineEventType type;
+    uint8_t note;
+    uint8_t velocity;
+    uint8_t targetMask;
+    uint8_t trackId;    // 0 = keyboard/untagged, 1+ = sequencer track
+    int32_t id;
+    int32_t index;
+    float value;
+    uint64_t payload;   // Parameter events: ParameterCommand::payload
+};
+
+class EventTimeline {
+public:
+    static constexpr uint32_t kCapacity = 4096;  // Per queue and per heap; power of two
+
+    EventTimeline() { reset(); }
+
+    /// Drops everything. Only call while the audio thread is not consuming.
+    void reset() {
+        m_queue.reset();
+        m_heapSize = 0;
+        m_nextOrder = 0;
+        m_consumerEpoch = m_clearEpoch.load(std::memory_order_relaxed);
+        m_dropped.store(0, std::memory_order_relaxed);
+    }
+
+    // ---- Any thread ----
+
+    /// Lock-free multi-producer push. Returns false (and drops the event) when full.
+    bool push(const TimelineEvent& event) {
+        const QueuedEvent queued{event, m_clearEpoch.load(std::memory_order_acquire)};
+        if (!m_queue.push(queued)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /// Discards every event pushed before this call. The audio thread applies it
+    /// on its next drain.
+    void clear() {
+        m_clearEpoch.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    // ---- Audio thread ----
+
+    /// Moves queued events into the time-ordered heap. Events already in the
+    /// past are clamped to `nowSample` so they fire at the start of this buffer.
+    void drain(uint64_t nowSample) {
+        syncEpoch();
+        QueuedEvent queued;
+        while (m_queue.pop(queued)) {
+            if (queued.epoch != m_consumerEpoch) {
+                syncEpoch();
+                if (queued.epoch != m_consumerEpoch) {
+                    continue;  // Pushed before a clear()
+                }
+            }
+            TimelineEvent event = queued.event;
+            if (event.sampleTime < nowSample) {
+                event.sampleTime = nowSample;
+            }
+            heapPush(event);
+        }
+    }
+
+    /// True if the earliest pending event is before `endSample`; returns its time.
+    bool peekDue(uint64_t endSample, uint64_t& sampleTime) const {
+        if (m_heapSize == 0 || m_heap[0].event.sampleTime >= endSample) {
+            return false;
+        }
+        sampleTime = m_heap[0].event.sampleTime;
+        return true;
+    }
+
+    /// Pops the earliest event if it is before `endSample`.
+    bool popDue(uint64_t endSample, TimelineEvent& out) {
+        if (m_heapSize == 0 || m_heap[0].event.sampleTime >= endSample) {
+            return false;
+        }
+        out = m_heap[0].event;
+        m_heap[0] = m_heap[--m_heapSize];
+        siftDown(0);
+        return true;
+    }
+
+    uint32_t getPendingCount() const { return m_heapSize; }
+
+private:
+    struct QueuedEvent {
+        TimelineEvent event;
+        uint32_t epoch;  // clear() generation at push time
+    };
+
+    struct HeapEntry {
+        TimelineEvent event;
+        uint64_t order;  // Arrival order; keeps same-sample, same-type events FIFO
+    };
+
+    static bool before(const HeapEntry& a, const HeapEntry& b) {
+        if (a.event.sampleTime != b.event.sampleTime) return a.event.sampleTime < b.event.sampleTime;
+        if (a.event.type != b.event.type) return a.event.type < b.event.type;
+        return a.order < b.order;
+    }
+
+    void syncEpoch() {
+        const uint32_t epoch = m_clearEpoch.load(std::memory_order_acquire);
+        if (epoch != m_consumerEpoch) {
+            m_consumerEpoch = epoch;
+            m_heapSize = 0;
+        }
+    }
+
+    void heapPush(const TimelineEvent& event) {
+        if (m_heapSize >= kCapacity) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        uint32_t i = m_heapSize++;
+        m_heap[i] = HeapEntry{event, m_nextOrder++};
+        while (i > 0) {
+            const uint32_t parent = (i - 1) >> 1;
+            if (!before(m_heap[i], m_heap[parent])) break;
+            std::swap(m_heap[i], m_heap[parent]);
+            i = parent;
+        }
+    }
+
+    void siftDown(uint32_t i) {
+        for (;;) {
+            const uint32_t left = 2 * i + 1;
+            if (left >= m_heapSize) break;
+            uint32_t smallest = left;
+            const uint32_t right = left + 1;
+            if (right < m_heapSize && before(m_heap[right], m_heap[left])) smallest = right;
+            if (!before(m_heap[smallest], m_heap[i])) break;
+            std::swap(m_heap[i], m_heap[smallest]);
+            i = smallest;
+        }
+    }
+
+    MpscQueue<QueuedEvent, kCapacity> m_queue;
+    std::atomic<uint32_t> m_clearEpoch{0};
+    std::atomic<uint64_t> m_dropped{0};
+
+    // Audio-thread heap
+    std::array<HeapEntry, kCapacity> m_heap;
+    uint32_t m_heapSize = 0;
+    uint64_t m_nextOrder = 0;
+    uint32_t m_consumerEpoch = 0;
+};
+
+} // namespace Grainulator
+
+#endif // EVENTTIMELINE_H
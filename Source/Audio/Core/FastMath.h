@@ -0,0 +1,259 @@
+//
+//  FastMath.h
+//  Grainulator
+//
+//  Approximations of the transcendentals used in per-sample DSP paths, as
+//  scalar functions and SimdOps.h vectors. The fastmath:: entry points follow
+//  GRAINULATOR_FASTMATH: 1 (default) uses the approximations, 0 forwards to
+//  libm so a build can be checked against exact math. fastmath::approx:: is
+//  always the approximation (Tools/fastmath_check.cpp measures it).
+//
+//  Error bounds, checked by Tools/fastmath_check.cpp:
+//    tanh   |err| < 1e-4 absolute, exactly +-1 limits, odd, monotonic
+//    exp2   relative error < 3e-7 for x in [-126, 126] (clamped outside, NaN to -126)
+//    exp    relative error < 3e-7 for x in [-87, 87] (clamped outside, NaN to -87)
+//    log2   |err| < 3e-7 absolute for x in [1/16, 16], within 1 ulp beyond
+//    pow    relative error < 2e-6 for x in [0.01, 100], y in [-4, 4]
+//    sin    |err| < 5e-7 absolute for |x| < 1000 (valid for |x| < 3200)
+//    cos    |err| < 5e-7 absolute for |x| < 1000 (valid for |x| < 3200)
+//
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "SimdOps.h"
+
+#ifndef GRAINULATOR_FASTMATH
+#define GRAINULATOR_FASTMATH 1
+#endif
+
+namespace Grainulator {
+namespace fastmath {
+namespace approx {
+
+// Cody-Waite split of pi: k * kPiA is exact for |k| < 2^11
+constexpr float kPiA = 3.140625f;
+constexpr float kPiB = 9.675025939941406e-4f;
+constexpr float kPiC = 1.509958025280866e-7f;
+constexpr float kInvPi = 0.318309873f;
+constexpr float kLog2E = 1.44269502f;
+constexpr float kSqrt2 = 1.41421354f;
+constexpr float kLn2Hi = 0.693145752f;   // ln 2 with the low 12 bits cleared
+constexpr float kLn2Lo = 1.42860677e-6f;
+
+// Offset that keeps the argument positive so truncation acts as floor
+constexpr float kFloorBias = 1024.0f;
+
+/// Rational (7,6) Pade approximant of tanh, clamped where it reaches 1.
+template <typename T>
+inline T tanh(T x) {
+    x = x < T(-4.97) ? T(-4.97) : (x > T(4.97) ? T(4.97) : x);
+    const T x2 = x * x;
+    return x * (T(135135) + x2 * (T(17325) + x2 * (T(378) + x2)))
+             / (T(135135) + x2 * (T(62370) + x2 * (T(3150) + x2 * T(28))));
+}
+
+// 2^g for g in [-0.5, 0.5] (Taylor to g^6, relative error < 1.2e-7)
+inline float exp2Poly(float g) {
+    return 1.0f + g * (0.693147181f + g * (0.240226507f + g * (0.0555041087f
+         + g * (0.00961812911f + g * (0.00133335581f + g * 0.000154035304f)))));
+}
+
+// Clamps x to [lo, hi]. NaN fails the first compare and becomes lo rather
+// than reaching a float-to-int conversion, which is undefined for NaN.
+inline float clampOrLow(float x, float lo, float hi) {
+    x = x > lo ? x : lo;
+    return x < hi ? x : hi;
+}
+
+inline float exp2(float x) {
+    x = clampOrLow(x, -126.0f, 126.0f);
+    const int n = static_cast<int>(x + 127.0f) - 127;  // floor(x)
+    const float g = x - static_cast<float>(n) - 0.5f;
+    const uint32_t bits = static_cast<uint32_t>(n + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return exp2Poly(g) * kSqrt2 * scale;
+}
+
+// exp(x) = 2^n e^r with ln2 split so r = x - n ln2 keeps full precision
+inline float exp(float x) {
+    x = clampOrLow(x, -87.0f, 87.0f);
+    const int n = static_cast<int>(x * kLog2E + 127.5f) - 127;  // round(x / ln2)
+    const float nf = static_cast<float>(n);
+    const float r = (x - nf * kLn2Hi) - nf * kLn2Lo;
+    const uint32_t bits = static_cast<uint32_t>(n + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return exp2Poly(r * kLog2E) * scale;
+}
+
+/// x must be positive and normal.
+inline float log2(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int e = static_cast<int>((bits >> 23) & 0xFF) - 127;
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+    if (m > kSqrt2) {
+        m *= 0.5f;
+        ++e;
+    }
+    // ln(m) = 2 atanh(s), |s| <= 0.172
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+    const float lnm = 2.0f * s * (1.0f + s2 * (0.333333333f + s2 * (0.2f + s2 * (0.142857143f + s2 * 0.111111111f))));
+    return static_cast<float>(e) + lnm * kLog2E;
+}
+
+/// x >= 0; pow(0, y) is 0.
+inline float pow(float x, float y) {
+    return x > 0.0f ? exp2(y * log2(x)) : 0.0f;
+}
+
+// sin(r) for |r| <= pi/2 (Taylor to r^11, error < 6e-8)
+inline float sinPoly(float r) {
+    const float r2 = r * r;
+    return r * (1.0f + r2 * (-0.166666667f + r2 * (0.00833333333f + r2 * (-1.98412698e-4f
+         + r2 * (2.75573192e-6f - r2 * 2.50521084e-8f)))));
+}
+
+// sin(x + shift * pi/2) for shift 0 or 1: reduce by whole half-turns k so
+// |r| <= pi/2, then sin = (-1)^k sin(r)
+inline float sinShifted(float x, float shift) {
+    const float q = x * kInvPi + 0.5f * shift;
+    const int k = static_cast<int>(q + 0.5f + kFloorBias) - static_cast<int>(kFloorBias);
+    const float kf = static_cast<float>(k) - 0.5f * shift;
+    const float r = ((x - kf * kPiA) - kf * kPiB) - kf * kPiC;
+    const float s = sinPoly(r);
+    return (k & 1) ? -s : s;
+}
+
+inline float sin(float x) { return sinShifted(x, 0.0f); }
+inline float cos(float x) { return sinShifted(x, 1.0f); }
+
+// ---- 4-lane versions (same algorithms, same bounds) ----
+
+inline simd::f4 tanh(simd::f4 x) {
+    using namespace simd;
+    x = min(max(x, set1(-4.97f)), set1(4.97f));
+    const f4 x2 = mul(x, x);
+    const f4 num = add(set1(135135.0f), mul(x2, add(set1(17325.0f), mul(x2, add(set1(378.0f), x2)))));
+    const f4 den = add(set1(135135.0f), mul(x2, add(set1(62370.0f), mul(x2, add(set1(3150.0f), mul(x2, set1(28.0f)))))));
+    return div(mul(x, num), den);
+}
+
+inline simd::f4 exp2(simd::f4 x) {
+    using namespace simd;
+    x = min(max(x, set1(-126.0f)), set1(126.0f));
+    const f4 n = sub(truncate(add(x, set1(127.0f))), set1(127.0f));
+    const f4 g = sub(sub(x, n), set1(0.5f));
+    f4 p = set1(0.000154035304f);
+    p = add(mul(p, g), set1(0.00133335581f));
+    p = add(mul(p, g), set1(0.00961812911f));
+    p = add(mul(p, g), set1(0.0555041087f));
+    p = add(mul(p, g), set1(0.240226507f));
+    p = add(mul(p, g), set1(0.693147181f));
+    p = add(mul(p, g), set1(1.0f));
+    return mul(mul(p, set1(kSqrt2)), pow2i(n));
+}
+
+inline simd::f4 exp(simd::f4 x) {
+    using namespace simd;
+    x = min(max(x, set1(-87.0f)), set1(87.0f));
+    const f4 n = sub(truncate(add(mul(x, set1(kLog2E)), set1(127.5f))), set1(127.0f));
+    const f4 r = sub(sub(x, mul(n, set1(kLn2Hi))), mul(n, set1(kLn2Lo)));
+    const f4 g = mul(r, set1(kLog2E));
+    f4 p = set1(0.000154035304f);
+    p = add(mul(p, g), set1(0.00133335581f));
+    p = add(mul(p, g), set1(0.00961812911f));
+    p = add(mul(p, g), set1(0.0555041087f));
+    p = add(mul(p, g), set1(0.240226507f));
+    p = add(mul(p, g), set1(0.693147181f));
+    p = add(mul(p, g), set1(1.0f));
+    return mul(p, pow2i(n));
+}
+
+inline simd::f4 sinShifted(simd::f4 x, float shift) {
+    using namespace simd;
+    const f4 bias = set1(kFloorBias);
+    const f4 q = add(mul(x, set1(kInvPi)), set1(0.5f * shift));
+    const f4 k = sub(truncate(add(add(q, set1(0.5f)), bias)), bias);
+    const f4 kf = sub(k, set1(0.5f * shift));
+    f4 r = sub(x, mul(kf, set1(kPiA)));
+    r = sub(r, mul(kf, set1(kPiB)));
+    r = sub(r, mul(kf, set1(kPiC)));
+
+    const f4 r2 = mul(r, r);
+    f4 p = set1(-2.50521084e-8f);
+    p = add(mul(p, r2), set1(2.75573192e-6f));
+    p = add(mul(p, r2), set1(-1.98412698e-4f));
+    p = add(mul(p, r2), set1(0.00833333333f));
+    p = add(mul(p, r2), set1(-0.166666667f));
+    p = add(mul(p, r2), set1(1.0f));
+    p = mul(p, r);
+
+    // (-1)^k from the parity of k: half - floor(half) is 0 or 0.5
+    const f4 half = mul(k, set1(0.5f));
+    const f4 parity = sub(half, sub(truncate(add(half, bias)), bias));
+    return mul(p, sub(set1(1.0f), mul(parity, set1(4.0f))));
+}
+
+inline simd::f4 sin(simd::f4 x) { return sinShifted(x, 0.0f); }
+inline simd::f4 cos(simd::f4 x) { return sinShifted(x, 1.0f); }
+
+} // namespace approx
+
+#if GRAINULATOR_FASTMATH
+
+template <typename T>
+inline T tanh(T x) { return approx::tanh(x); }
+inline float exp2(float x) { return approx::exp2(x); }
+inline float exp(float x) { return approx::exp(x); }
+inline float log2(float x) { return approx::log2(x); }
+inline float pow(float x, float y) { return approx::pow(x, y); }
+inline float sin(float x) { return approx::sin(x); }
+inline float cos(float x) { return approx::cos(x); }
+inline simd::f4 tanh(simd::f4 x) { return approx::tanh(x); }
+inline simd::f4 exp2(simd::f4 x) { return approx::exp2(x); }
+inline simd::f4 exp(simd::f4 x) { return approx::exp(x); }
+inline simd::f4 sin(simd::f4 x) { return approx::sin(x); }
+inline simd::f4 cos(simd::f4 x) { return approx::cos(x); }
+
+#else
+
+namespace detail {
+template <typename Fn>
+inline simd::f4 perLane(simd::f4 x, Fn fn) {
+    float v[simd::kWidth];
+    simd::store(v, x);
+    for (float& lane : v) lane = fn(lane);
+    return simd::load(v);
+}
+} // namespace detail
+
+template <typename T>
+inline T tanh(T x) { return std::tanh(x); }
+inline float exp2(float x) { return std::exp2(x); }
+inline float exp(float x) { return std::exp(x); }
+inline float log2(float x) { return std::log2(x); }
+inline float pow(float x, float y) { return std::pow(x, y); }
+inline float sin(float x) { return std::sin(x); }
+inline float cos(float x) { return std::cos(x); }
+inline simd::f4 tanh(simd::f4 x) { return detail::perLane(x, [](float v) { return std::tanh(v); }); }
+inline simd::f4 exp2(simd::f4 x) { return detail::perLane(x, [](float v) { return std::exp2(v); }); }
+inline simd::f4 exp(simd::f4 x) { return detail::perLane(x, [](float v) { return std::exp(v); }); }
+inline simd::f4 sin(simd::f4 x) { return detail::perLane(x, [](float v) { return std::sin(v); }); }
+inline simd::f4 cos(simd::f4 x) { return detail::perLane(x, [](float v) { return std::cos(v); }); }
+
+#endif
+
+} // namespace fastmath
+} // namespace Grainulator
+
+#endif // FASTMATH_H
@@ -0,0 +1,208 @@
+//
+//  Freeverb.cpp
+//  Grainulator
+//
+//  Block-based Freeverb-style reverb (see Freeverb.h).
+//
+
+#include "Freeverb.h"
+#include "SimdOps.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Grainulator {
+
+namespace {
+
+// Copies count samples starting at ring[pos] (pos already masked), wrapping once
+void readRing(const float* ring, size_t ringSize, size_t pos, float* dst, int count) {
+    const size_t first = std::min(static_cast<size_t>(count), ringSize - pos);
+    std::memcpy(dst, ring + pos, first * sizeof(float));
+    std::memcpy(dst + first, ring, (static_cast<size_t>(count) - first) * sizeof(float));
+}
+
+void writeRing(float* ring, size_t ringSize, size_t pos, const float* src, int count) {
+    const size_t first = std::min(static_cast<size_t>(count), ringSize - pos);
+    std::memcpy(ring + pos, src, first * sizeof(float));
+    std::memcpy(ring, src + first, (static_cast<size_t>(count) - first) * sizeof(float));
+}
+
+} // namespace
+
+Freeverb::Freeverb(int maxFrames)
+    : m_maxFrames(maxFrames)
+    , m_combRingL(kCombRingSize * kNumCombs)
+    , m_combRingR(kCombRingSize * kNumCombs)
+    , m_combWrite(0)
+    , m_allpassWrite(0)
+    , m_wetL(static_cast<size_t>(maxFrames))
+    , m_wetR(static_cast<size_t>(maxFrames))
+    , m_delayed(kMaxAllpassTuning)
+    , m_feedback(kMaxAllpassTuning)
+{
+    for (int i = 0; i < kNumAllpasses; ++i) {
+        m_allpassRingL[i].resize(kAllpassRingSize);
+        m_allpassRingR[i].resize(kAllpassRingSize);
+    }
+    reset();
+}
+
+void Freeverb::reset() {
+    std::fill(m_combRingL.begin(), m_combRingL.end(), 0.0f);
+    std::fill(m_combRingR.begin(), m_combRingR.end(), 0.0f);
+    std::fill(m_combFilterL, m_combFilterL + kNumCombs, 0.0f);
+    std::fill(m_combFilterR, m_combFilterR + kNumCombs, 0.0f);
+    for (int i = 0; i < kNumAllpasses; ++i) {
+        std::fill(m_allpassRingL[i].begin(), m_allpassRingL[i].end(), 0.0f);
+        std::fill(m_allpassRingR[i].begin(), m_allpassRingR[i].end(), 0.0f);
+    }
+    m_combWrite = 0;
+    m_allpassWrite = 0;
+}
+
+float Freeverb::process(float* left, float* right, int numFrames, float size, float damping, float mix) {
+    using namespace simd;
+
+    const float feedback = size * 0.28f + 0.7f;
+    const float damp1 = damping * 0.4f;
+    const float damp2 = 1.0f - damp1;
+
+    float peak = 0.0f;
+    for (int offset = 0; offset < numFrames; offset += m_maxFrames) {
+        float* blockL = left + offset;
+        float* blockR = right + offset;
+        const int n = std::min(m_maxFrames, numFrames - offset);
+
+        processCombs(blockL, blockR, n, feedback, damp1, damp2);
+        for (int i = 0; i < kNumAllpasses; ++i) {
+            processAllpass(m_allpassRingL[i].data(), m_wetL.data(), n, kAllpassTunings[i]);
+            processAllpass(m_allpassRingR[i].data(), m_wetR.data(), n, kAllpassTunings[i]);
+        }
+        m_allpassWrite += static_cast<size_t>(n);
+
+        // Scale, meter and mix dry/wet
+        const f4 scale = set1(0.15f);
+        const f4 wetGain = set1(mix);
+        const f4 dryGain = set1(1.0f - mix);
+        f4 peakV = set1(0.0f);
+        int i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            const f4 wetL = mul(load(m_wetL.data() + i), scale);
+            const f4 wetR = mul(load(m_wetR.data() + i), scale);
+            peakV = max(peakV, max(abs(wetL), abs(wetR)));
+            store(blockL + i, add(mul(load(blockL + i), dryGain), mul(wetL, wetGain)));
+            store(blockR + i, add(mul(load(blockR + i), dryGain), mul(wetR, wetGain)));
+        }
+        peak = std::max(peak, hmax(peakV));
+        for (; i < n; ++i) {
+            const float wetL = m_wetL[i] * 0.15f;
+            const float wetR = m_wetR[i] * 0.15f;
+            peak = std::max(peak, std::max(std::fabs(wetL), std::fabs(wetR)));
+            blockL[i] = blockL[i] * (1.0f - mix) + wetL * mix;
+            blockR[i] = blockR[i] * (1.0f - mix) + wetR * mix;
+        }
+    }
+    return peak;
+}
+
+void Freeverb::processCombs(const float* inL, const float* inR, int numFrames,
+                            float feedback, float damp1, float damp2) {
+    using namespace simd;
+    static_assert(kNumCombs == 2 * kWidth, "combs are processed as two vectors");
+
+    const f4 fb = set1(feedback);
+    const f4 d1 = set1(damp1);
+    const f4 d2 = set1(damp2);
+    f4 filtL0 = load(m_combFilterL);
+    f4 filtL1 = load(m_combFilterL + kWidth);
+    f4 filtR0 = load(m_combFilterR);
+    f4 filtR1 = load(m_combFilterR + kWidth);
+
+    float* ringL = m_combRingL.data();
+    float* ringR = m_combRingR.data();
+    size_t w = m_combWrite;
+    float lanes[kNumCombs];
+
+    for (int n = 0; n < numFrames; ++n, ++w) {
+        // Lane c reads comb c's own delay back from the ring
+        size_t read[kNumCombs];
+        for (int c = 0; c < kNumCombs; ++c) {
+            read[c] = ((w - static_cast<size_t>(kCombTunings[c])) & kCombRingMask) * kNumCombs + c;
+        }
+        const f4 outL0 = setr(ringL[read[0]], ringL[read[1]], ringL[read[2]], ringL[read[3]]);
+        const f4 outL1 = setr(ringL[read[4]], ringL[read[5]], ringL[read[6]], ringL[read[7]]);
+        const f4 outR0 = setr(ringR[read[0]], ringR[read[1]], ringR[read[2]], ringR[read[3]]);
+        const f4 outR1 = setr(ringR[read[4]], ringR[read[5]], ringR[read[6]], ringR[read[7]]);
+
+        // Damping lowpass, then write input + feedback as this sample's row
+        filtL0 = add(mul(outL0, d2), mul(filtL0, d1));
+        filtL1 = add(mul(outL1, d2), mul(filtL1, d1));
+        filtR0 = add(mul(outR0, d2), mul(filtR0, d1));
+        filtR1 = add(mul(outR1, d2), mul(filtR1, d1));
+
+        float* rowL = ringL + (w & kCombRingMask) * kNumCombs;
+        float* rowR = ringR + (w & kCombRingMask) * kNumCombs;
+        const f4 xL = set1(inL[n]);
+        const f4 xR = set1(inR[n]);
+        store(rowL, add(xL, mul(filtL0, fb)));
+        store(rowL + kWidth, add(xL, mul(filtL1, fb)));
+        store(rowR, add(xR, mul(filtR0, fb)));
+        store(rowR + kWidth, add(xR, mul(filtR1, fb)));
+
+        // Summed in comb order rather than as a tree, which would reassociate
+        // the adds and change the output in the last bits
+        store(lanes, outL0);
+        store(lanes + kWidth, outL1);
+        float sumL = 0.0f;
+        for (int c = 0; c < kNumCombs; ++c) sumL += lanes[c];
+        store(lanes, outR0);
+        store(lanes + kWidth, outR1);
+        float sumR = 0.0f;
+        for (int c = 0; c < kNumCombs; ++c) sumR += lanes[c];
+
+        m_wetL[n] = sumL;
+        m_wetR[n] = sumR;
+    }
+
+    store(m_combFilterL, filtL0);
+    store(m_combFilterL + kWidth, filtL1);
+    store(m_combFilterR, filtR0);
+    store(m_combFilterR + kWidth, filtR1);
+    m_combWrite = w;
+}
+
+void Freeverb::processAllpass(float* ring, float* signal, int numFrames, int delay) {
+    using namespace simd;
+
+    const f4 half = set1(0.5f);
+    float* delayed = m_delayed.data();
+    float* feedback = m_feedback.data();
+
+    // A chunk no longer than the delay only reads history written before it,
+    // so it can be copied out up front and processed as plain arrays
+    for (int offset = 0; offset < numFrames; offset += delay) {
+        const int n = std::min(delay, numFrames - offset);
+        const size_t start = m_allpassWrite + static_cast<size_t>(offset);
+        float* x = signal + offset;
+
+        readRing(ring, kAllpassRingSize, (start - static_cast<size_t>(delay)) & kAllpassRingMask, delayed, n);
+
+        int i = 0;
+        for (; i + kWidth <= n; i += kWidth) {
+            const f4 in = load(x + i);
+            const f4 bufOut = load(delayed + i);
+            store(feedback + i, add(in, mul(bufOut, half)));
+            store(x + i, sub(bufOut, in));
+        }
+        for (; i < n; ++i) {
+            const float bufOut = delayed[i];
+            feedback[i] = x[i] + bufOut * 0.5f;
+            x[i] = -x[i] + bufOut;
+        }
+
+        writeRing(ring, kAllpassRingSize, start & kAllpassRingMask, feedback, n);
+    }
+}
+
+} // namespace Grainulator
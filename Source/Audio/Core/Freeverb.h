@@ -0,0 +1,73 @@
+//
+//  Freeverb.h
+//  Grainulator
+//
+//  Freeverb-style reverb on send A: 8 parallel damped combs per channel into
+//  4 series allpasses, processed a block at a time. The 8 combs run as SIMD
+//  lanes over an interleaved power-of-two ring, so every delay read and the
+//  per-sample write are mask-indexed with no modulo. The allpasses run over
+//  the block in chunks no longer than their delay, which turns each chunk into
+//  a contiguous vector pass over history copied out of the ring.
+//
+//  Storage is allocated once in the constructor; process() is allocation-free.
+//
+
+#ifndef FREEVERB_H
+#define FREEVERB_H
+
+#include <cstddef>
+#include <vector>
+
+namespace Grainulator {
+
+class Freeverb {
+public:
+    static constexpr int kNumCombs = 8;
+    static constexpr int kNumAllpasses = 4;
+
+    // Tunings for 48kHz
+    static constexpr int kCombTunings[kNumCombs] = {1557, 1617, 1491, 1422, 1277, 1356, 1188, 1116};
+    static constexpr int kAllpassTunings[kNumAllpasses] = {556, 441, 341, 225};
+
+    explicit Freeverb(int maxFrames);
+
+    /// Clears the delay lines and damping state.
+    void reset();
+
+    /// Mixes the reverb into left/right in place (size, damping, mix 0-1).
+    /// Returns the peak of the scaled wet signal, for tail tracking.
+    float process(float* left, float* right, int numFrames, float size, float damping, float mix);
+
+private:
+    static constexpr size_t kCombRingSize = 2048;     // > longest comb
+    static constexpr size_t kCombRingMask = kCombRingSize - 1;
+    static constexpr size_t kAllpassRingSize = 1024;  // > longest allpass
+    static constexpr size_t kAllpassRingMask = kAllpassRingSize - 1;
+    static constexpr int kMaxAllpassTuning = 556;
+
+    void processCombs(const float* inL, const float* inR, int numFrames, float feedback, float damp1, float damp2);
+    void processAllpass(float* ring, float* signal, int numFrames, int delay);
+
+    int m_maxFrames;
+
+    // Comb rings: row r holds sample r of all 8 combs, so a write is one row
+    std::vector<float> m_combRingL;
+    std::vector<float> m_combRingR;
+    float m_combFilterL[kNumCombs];
+    float m_combFilterR[kNumCombs];
+    size_t m_combWrite;
+
+    std::vector<float> m_allpassRingL[kNumAllpasses];
+    std::vector<float> m_allpassRingR[kNumAllpasses];
+    size_t m_allpassWrite;
+
+    // Block scratch
+    std::vector<float> m_wetL;
+    std::vector<float> m_wetR;
+    std::vector<float> m_delayed;
+    std::vector<float> m_feedback;
+};
+
+} // namespace Grainulator
+
+#endif // FREEVERB_H
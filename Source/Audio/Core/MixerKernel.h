@@ -0,0 +1,274 @@
+//
+//  MixerKernel.h
+//  Grainulator
+//
+//  Block-based channel strip for the mixer: ramped gain and constant-power
+//  pan with peak/RMS, micro-delay by block copy, and main/send accumulation.
+//  Each stage is one pass over the block, vectorized via SimdOps.h.
+//
+
+#ifndef MIXERKERNEL_H
+#define MIXERKERNEL_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "FastMath.h"
+#include "SimdOps.h"
+
+namespace Grainulator {
+
+/// Linear per-block ramp: sample i uses start + step * (i + 1), so the last
+/// sample lands exactly on the target and the next block continues from it.
+struct LinearRamp {
+    float start;
+    float step;
+
+    static LinearRamp between(float from, float to, int numFrames) {
+        return LinearRamp{from, numFrames > 0 ? (to - from) / static_cast<float>(numFrames) : 0.0f};
+    }
+
+    float at(int i) const { return start + step * static_cast<float>(i + 1); }
+};
+
+/// Constant-power pan law used by the mixer (pan -1..1).
+inline void mixerPanGains(float pan, float& left, float& right) {
+    const float angle = (pan + 1.0f) * 0.25f * 3.14159265f;
+    left = std::cos(angle);
+    right = std::sin(angle);
+}
+
+/// Gain + pan stage. Mono channels sum L/R before panning.
+/// Returns the peak of the post-gain (pre-pan) signal and adds its mean-square
+/// contribution per frame to sumSquares.
+inline float mixStripGainPan(const float* inL, const float* inR, float* outL, float* outR, int numFrames,
+                             LinearRamp gain, LinearRamp panL, LinearRamp panR, bool monoSum,
+                             float& sumSquares) {
+    using namespace simd;
+    f4 peak = set1(0.0f);
+    f4 squares = set1(0.0f);
+    const f4 half = set1(0.5f);
+
+    const f4 ramp4 = setr(1.0f, 2.0f, 3.0f, 4.0f);
+    const f4 four = set1(4.0f);
+    f4 index = ramp4;
+    const f4 gainStart = set1(gain.start), gainStep = set1(gain.step);
+    const f4 panLStart = set1(panL.start), panLStep = set1(panL.step);
+    const f4 panRStart = set1(panR.start), panRStep = set1(panR.step);
+
+    int i = 0;
+    for (; i + kWidth <= numFrames; i += kWidth) {
+        const f4 g = madd(gainStep, index, gainStart);
+        const f4 pl = madd(panLStep, index, panLStart);
+        const f4 pr = madd(panRStep, index, panRStart);
+        index = add(index, four);
+
+        const f4 l = load(inL + i);
+        const f4 r = load(inR + i);
+        if (monoSum) {
+            const f4 mono = mul(mul(add(l, r), half), g);
+            store(outL + i, mul(mono, pl));
+            store(outR + i, mul(mono, pr));
+            peak = max(peak, abs(mono));
+            squares = madd(mono, mono, squares);
+        } else {
+            const f4 sl = mul(l, g);
+            const f4 sr = mul(r, g);
+            store(outL + i, mul(sl, pl));
+            store(outR + i, mul(sr, pr));
+            peak = max(peak, max(abs(sl), abs(sr)));
+            squares = madd(add(mul(sl, sl), mul(sr, sr)), half, squares);
+        }
+    }
+
+    float peakScalar = hmax(peak);
+    float squaresScalar = hsum(squares);
+    for (; i < numFrames; ++i) {
+        const float g = gain.at(i);
+        const float pl = panL.at(i);
+        const float pr = panR.at(i);
+        if (monoSum) {
+            const float mono = (inL[i] + inR[i]) * 0.5f * g;
+            outL[i] = mono * pl;
+            outR[i] = mono * pr;
+            peakScalar = std::max(peakScalar, std::fabs(mono));
+            squaresScalar += mono * mono;
+        } else {
+            const float sl = inL[i] * g;
+            const float sr = inR[i] * g;
+            outL[i] = sl * pl;
+            outR[i] = sr * pr;
+            peakScalar = std::max(peakScalar, std::max(std::fabs(sl), std::fabs(sr)));
+            squaresScalar += (sl * sl + sr * sr) * 0.5f;
+        }
+    }
+    sumSquares += squaresScalar;
+    return peakScalar;
+}
+
+/// Peak/RMS of an unprocessed stereo block (multi-channel output metering).
+inline float mixStripMeter(const float* inL, const float* inR, int numFrames, bool monoSum, float& sumSquares) {
+    using namespace simd;
+    f4 peak = set1(0.0f);
+    f4 squares = set1(0.0f);
+    const f4 half = set1(0.5f);
+
+    int i = 0;
+    for (; i + kWidth <= numFrames; i += kWidth) {
+        const f4 l = load(inL + i);
+        const f4 r = load(inR + i);
+        if (monoSum) {
+            const f4 mono = mul(add(l, r), half);
+            peak = max(peak, abs(mono));
+            squares = madd(mono, mono, squares);
+        } else {
+            peak = max(peak, max(abs(l), abs(r)));
+            squares = madd(add(mul(l, l), mul(r, r)), half, squares);
+        }
+    }
+
+    float peakScalar = hmax(peak);
+    float squaresScalar = hsum(squares);
+    for (; i < numFrames; ++i) {
+        if (monoSum) {
+            const float mono = (inL[i] + inR[i]) * 0.5f;
+            peakScalar = std::max(peakScalar, std::fabs(mono));
+            squaresScalar += mono * mono;
+        } else {
+            peakScalar = std::max(peakScalar, std::max(std::fabs(inL[i]), std::fabs(inR[i])));
+            squaresScalar += (inL[i] * inL[i] + inR[i] * inR[i]) * 0.5f;
+        }
+    }
+    sumSquares += squaresScalar;
+    return peakScalar;
+}
+
+/// Per-channel micro-delay over a circular buffer of bufferLength samples
+/// (bufferLength > delay). Equivalent to writing then reading one sample at a
+/// time: the first `delay` outputs come from history, the rest straight from
+/// the input, then the block is appended to the history.
+inline void mixStripMicroDelay(const float* inL, const float* inR, float* outL, float* outR, int numFrames,
+                               float* historyL, float* historyR, int bufferLength, int delay, int& writePos) {
+    delay = std::clamp(delay, 0, bufferLength - 1);
+
+    // Outputs [0, fromHistory) read samples written before this block
+    const int fromHistory = std::min(delay, numFrames);
+    int readPos = writePos - delay;
+    if (readPos < 0) readPos += bufferLength;
+    for (int done = 0; done < fromHistory;) {
+        const int run = std::min(fromHistory - done, bufferLength - readPos);
+        std::memcpy(outL + done, historyL + readPos, run * sizeof(float));
+        std::memcpy(outR + done, historyR + readPos, run * sizeof(float));
+        done += run;
+        readPos = 0;
+    }
+
+    // Outputs [delay, numFrames) are this block's input shifted by delay
+    if (numFrames > delay) {
+        std::memcpy(outL + delay, inL, (numFrames - delay) * sizeof(float));
+        std::memcpy(outR + delay, inR, (numFrames - delay) * sizeof(float));
+    }
+
+    // Append the block (only the newest bufferLength samples can ever be read)
+    int skip = std::max(0, numFrames - bufferLength);
+    int pos = (writePos + skip) % bufferLength;
+    for (int done = skip; done < numFrames;) {
+        const int run = std::min(numFrames - done, bufferLength - pos);
+        std::memcpy(historyL + pos, inL + done, run * sizeof(float));
+        std::memcpy(historyR + pos, inR + done, run * sizeof(float));
+        done += run;
+        pos += run;
+        if (pos >= bufferLength) pos = 0;
+    }
+    writePos = pos;
+}
+
+/// Destination buffers for mixStripAccumulate. mainL/mainR may be null (muted).
+struct MixStripTargets {
+    float* mainL;
+    float* mainR;
+    float* sendAL;
+    float* sendAR;
+    float* sendBL;
+    float* sendBR;
+    float* busAL;   // Send-bus taps for the legacy output buses
+    float* busAR;
+    float* busBL;
+    float* busBR;
+};
+
+/// Adds the channel into the main bus (if audible) and both send buses with ramped levels.
+inline void mixStripAccumulate(const float* inL, const float* inR, int numFrames,
+                               LinearRamp sendA, LinearRamp sendB, const MixStripTargets& t) {
+    using namespace simd;
+    const f4 ramp4 = setr(1.0f, 2.0f, 3.0f, 4.0f);
+    const f4 four = set1(4.0f);
+    f4 index = ramp4;
+    const f4 aStart = set1(sendA.start), aStep = set1(sendA.step);
+    const f4 bStart = set1(sendB.start), bStep = set1(sendB.step);
+
+    int i = 0;
+    for (; i + kWidth <= numFrames; i += kWidth) {
+        const f4 a = madd(aStep, index, aStart);
+        const f4 b = madd(bStep, index, bStart);
+        index = add(index, four);
+
+        const f4 l = load(inL + i);
+        const f4 r = load(inR + i);
+        if (t.mainL) {
+            store(t.mainL + i, add(load(t.mainL + i), l));
+            store(t.mainR + i, add(load(t.mainR + i), r));
+        }
+        const f4 al = mul(l, a), ar = mul(r, a);
+        const f4 bl = mul(l, b), br = mul(r, b);
+        store(t.sendAL + i, add(load(t.sendAL + i), al));
+        store(t.sendAR + i, add(load(t.sendAR + i), ar));
+        store(t.sendBL + i, add(load(t.sendBL + i), bl));
+        store(t.sendBR + i, add(load(t.sendBR + i), br));
+        store(t.busAL + i, add(load(t.busAL + i), al));
+        store(t.busAR + i, add(load(t.busAR + i), ar));
+        store(t.busBL + i, add(load(t.busBL + i), bl));
+        store(t.busBR + i, add(load(t.busBR + i), br));
+    }
+    for (; i < numFrames; ++i) {
+        const float a = sendA.at(i);
+        const float b = sendB.at(i);
+        if (t.mainL) {
+            t.mainL[i] += inL[i];
+            t.mainR[i] += inR[i];
+        }
+        const float al = inL[i] * a, ar = inR[i] * a;
+        const float bl = inL[i] * b, br = inR[i] * b;
+        t.sendAL[i] += al;
+        t.sendAR[i] += ar;
+        t.sendBL[i] += bl;
+        t.sendBR[i] += br;
+        t.busAL[i] += al;
+        t.busAR[i] += ar;
+        t.busBL[i] += bl;
+        t.busBR[i] += br;
+    }
+}
+
+/// Master soft clip (tanh) in place. Returns the peak of the clipped block.
+inline float softClipMeter(float* buffer, int numFrames) {
+    using namespace simd;
+    f4 peakV = set1(0.0f);
+    int i = 0;
+    for (; i + kWidth <= numFrames; i += kWidth) {
+        const f4 y = fastmath::tanh(load(buffer + i));
+        peakV = max(peakV, abs(y));
+        store(buffer + i, y);
+    }
+    float peak = hmax(peakV);
+    for (; i < numFrames; ++i) {
+        buffer[i] = fastmath::tanh(buffer[i]);
+        peak = std::max(peak, std::fabs(buffer[i]));
+    }
+    return peak;
+}
+
+} // namespace Grainulator
+
+#endif // MIXERKERNEL_H
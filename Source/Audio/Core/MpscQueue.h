@@ -0,0 +1,85 @@
+//
+//  MpscQueue.h
+//  Grainulator
+//
+//  Bounded lock-free multi-producer / single-consumer queue (Vyukov-style,
+//  one sequence number per cell). push() never blocks and fails when full;
+//  pop() is wait-free for the single consumer. No allocation after construction.
+//
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Grainulator {
+
+template <typename T, uint32_t Capacity>
+class MpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscQueue() { reset(); }
+
+    /// Drops everything. Only call while no producer or consumer is active.
+    void reset() {
+        for (uint32_t i = 0; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_enqueuePos.store(0, std::memory_order_relaxed);
+        m_dequeuePos = 0;
+    }
+
+    /// Any thread. Returns false when the queue is full.
+    bool push(const T& value) {
+        uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & kMask];
+            const uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer thread only. Returns false when empty.
+    bool pop(T& out) {
+        Cell& cell = m_cells[m_dequeuePos & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            return false;
+        }
+        out = cell.value;
+        cell.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+        ++m_dequeuePos;
+        return true;
+    }
+
+private:
+    static constexpr uint64_t kMask = Capacity - 1;
+
+    struct Cell {
+        std::atomic<uint64_t> sequence{0};
+        T value{};
+    };
+
+    std::array<Cell, Capacity> m_cells;
+    alignas(64) std::atomic<uint64_t> m_enqueuePos{0};
+    alignas(64) uint64_t m_dequeuePos = 0;
+};
+
+} // namespace Grainulator
+
+#endif // MPSCQUEUE_H
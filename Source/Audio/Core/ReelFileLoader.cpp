@@ -0,0 +1,172 @@
+//
+//  ReelFileLoader.cpp
+//  Grainulator
+//
+//  Streams audio files into reels on a background thread.
+//
+
+#include "ReelFileLoader.h"
+#include "ReelBuffer.h"
+#include "dr_wav.h"
+#include <algorithm>
+#include <vector>
+
+namespace Grainulator {
+
+struct ReelFileLoader::Job {
+    drwav wav;
+    bool open = false;
+    int reelIndex = 0;
+    ReelBuffer* reel = nullptr;
+    uint32_t generation = 0;
+
+    ~Job() {
+        if (open) drwav_uninit(&wav);
+    }
+};
+
+ReelFileLoader::ReelFileLoader() : m_stopping(false) {
+    for (int i = 0; i < kMaxReels; ++i) {
+        m_generation[i].store(0, std::memory_order_relaxed);
+        m_progress[i].store(1.0f, std::memory_order_relaxed);
+    }
+}
+
+ReelFileLoader::~ReelFileLoader() {
+    stop();
+}
+
+bool ReelFileLoader::load(const char* filePath, int reelIndex, ReelBuffer* reel) {
+    if (!filePath || !reel || reelIndex < 0 || reelIndex >= kMaxReels) return false;
+
+    // Parse the header now so the caller can fall back to another decoder
+    auto job = std::make_unique<Job>();
+    job->open = drwav_init_file(&job->wav, filePath, nullptr);
+    if (!job->open || job->wav.channels == 0 || job->wav.sampleRate == 0) return false;
+    job->reelIndex = reelIndex;
+    job->reel = reel;
+
+    // Supersede whatever is loading into this reel
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        job->generation = m_generation[reelIndex].fetch_add(1, std::memory_order_acq_rel) + 1;
+        m_progress[reelIndex].store(0.0f, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (!m_thread.joinable()) {
+        m_stopping = false;
+        m_thread = std::thread(&ReelFileLoader::run, this);
+    }
+    m_queue.push_back(std::move(job));
+    m_queueCondition.notify_one();
+    return true;
+}
+
+void ReelFileLoader::cancel(int reelIndex) {
+    if (reelIndex < 0 || reelIndex >= kMaxReels) return;
+    m_generation[reelIndex].fetch_add(1, std::memory_order_acq_rel);
+
+    // Wait out a chunk that may be mid-write
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    m_progress[reelIndex].store(1.0f, std::memory_order_relaxed);
+}
+
+void ReelFileLoader::stop() {
+    for (int i = 0; i < kMaxReels; ++i) {
+        cancel(i);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopping = true;
+        m_queueCondition.notify_one();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_queue.clear();
+}
+
+float ReelFileLoader::getProgress(int reelIndex) const {
+    if (reelIndex < 0 || reelIndex >= kMaxReels) return 1.0f;
+    return m_progress[reelIndex].load(std::memory_order_relaxed);
+}
+
+bool ReelFileLoader::isLoading(int reelIndex) const {
+    const float progress = getProgress(reelIndex);
+    return progress >= 0.0f && progress < 1.0f;
+}
+
+// ========== Loader Thread ==========
+
+void ReelFileLoader::run() {
+    for (;;) {
+        std::unique_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping) return;
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        if (isCurrent(*job)) {
+            decode(*job);
+        }
+    }
+}
+
+bool ReelFileLoader::isCurrent(const Job& job) const {
+    return m_generation[job.reelIndex].load(std::memory_order_acquire) == job.generation;
+}
+
+void ReelFileLoader::decode(Job& job) {
+    const size_t channels = job.wav.channels;
+    const size_t totalFrames = static_cast<size_t>(job.wav.totalPCMFrameCount);
+    const size_t framesToLoad = std::min(totalFrames, ReelBuffer::kMaxSamples);
+    std::atomic<float>& progress = m_progress[job.reelIndex];
+
+    std::vector<float> interleaved(kChunkFrames * channels);
+    std::vector<float> left(kChunkFrames);
+    std::vector<float> right(kChunkFrames);
+
+    // Every write into the reel happens under m_writeMutex and only while the
+    // job is current, so cancel() returning means the reel is left alone.
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        if (!isCurrent(job)) return;
+        job.reel->Clear();
+        job.reel->SetSampleRate(static_cast<float>(job.wav.sampleRate));
+    }
+
+    size_t loaded = 0;
+    while (loaded < framesToLoad) {
+        const size_t request = std::min(kChunkFrames, framesToLoad - loaded);
+        const size_t frames = static_cast<size_t>(
+            drwav_read_pcm_frames_f32(&job.wav, request, interleaved.data()));
+        if (frames == 0) break;
+
+        // Mono goes in as-is (the reel duplicates it); extra channels are dropped
+        const float* src = interleaved.data();
+        for (size_t i = 0; i < frames; ++i, src += channels) {
+            left[i] = src[0];
+            if (channels > 1) right[i] = src[1];
+        }
+
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        if (!isCurrent(job)) return;
+        const size_t appended = job.reel->Append(left.data(), channels > 1 ? right.data() : nullptr, frames);
+        loaded += appended;
+        progress.store(static_cast<float>(loaded) / static_cast<float>(framesToLoad), std::memory_order_relaxed);
+        if (appended < frames) break;  // Reel full or out of page memory
+    }
+
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+    if (!isCurrent(job)) return;
+    if (loaded > 0) {
+        // Add a default splice covering the entire buffer
+        job.reel->AddSplice(0, static_cast<uint32_t>(loaded));
+    }
+    progress.store(loaded > 0 ? 1.0f : -1.0f, std::memory_order_relaxed);
+}
+
+} // namespace Grainulator
@@ -0,0 +1,75 @@
+//
+//  ReelFileLoader.h
+//  Grainulator
+//
+//  Background decoder that streams audio files into reels. Files are opened
+//  on the caller's thread (so unreadable files fail immediately) and decoded
+//  chunk by chunk on a single loader thread; each chunk is appended to the
+//  reel and published, so the reel plays while it is still loading.
+//  Formats are whatever the bundled dr_wav reads (WAV/RF64/W64 and AIFF).
+//
+
+#ifndef REELFILELOADER_H
+#define REELFILELOADER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Grainulator {
+
+class ReelBuffer;
+
+class ReelFileLoader {
+public:
+    static constexpr int kMaxReels = 32;
+    static constexpr size_t kChunkFrames = 65536;  // One reel page per chunk
+
+    ReelFileLoader();
+    ~ReelFileLoader();
+
+    /// Opens filePath and queues it to replace the contents of reel. Returns
+    /// false if the file cannot be opened or decoded. Any load already running
+    /// into reelIndex is cancelled. Not real-time safe.
+    bool load(const char* filePath, int reelIndex, ReelBuffer* reel);
+
+    /// Cancels any queued or running load into reelIndex and returns once the
+    /// loader is no longer writing to that reel. Not real-time safe.
+    void cancel(int reelIndex);
+    /// Cancels every load and joins the loader thread.
+    void stop();
+
+    /// 0..1 while loading, 1 when idle or complete, -1 if the last load failed
+    float getProgress(int reelIndex) const;
+    bool isLoading(int reelIndex) const;
+
+private:
+    struct Job;
+
+    void run();
+    void decode(Job& job);
+    bool isCurrent(const Job& job) const;
+
+    std::thread m_thread;
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::deque<std::unique_ptr<Job>> m_queue;
+    bool m_stopping;
+
+    std::mutex m_writeMutex;  // Held while a chunk is written into a reel
+
+    // Bumped to invalidate queued and running jobs for a reel
+    std::atomic<uint32_t> m_generation[kMaxReels];
+    std::atomic<float> m_progress[kMaxReels];
+
+    ReelFileLoader(const ReelFileLoader&) = delete;
+    ReelFileLoader& operator=(const ReelFileLoader&) = delete;
+};
+
+} // namespace Grainulator
+
+#endif // REELFILELOADER_H
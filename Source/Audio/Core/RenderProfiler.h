@@ -0,0 +1,228 @@
+//
+//  RenderProfiler.h
+//  Grainulator
+//
+//  Per-stage DSP load measurement for the render callbacks.
+//  The audio thread laps a monotonic cycle counter between render stages;
+//  UI threads read rolling statistics (mean, p99, max, deadline misses)
+//  without locks.
+//
+
+#ifndef RENDERPROFILER_H
+#define RENDERPROFILER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>  // __rdtsc
+#endif
+
+namespace Grainulator {
+
+enum class RenderStage : int {
+    Events = 0,     // Clock, modulation, scheduled-event dispatch
+    Plaits,
+    Rings,
+    Tracks,         // Granular + looper voices (channels 2-5)
+    Drums,          // DaisyDrum + drum sequencer lanes
+    Sampler,        // SoundFont / WAV sampler
+    Mixer,          // Inserts, recording taps, gain/pan/sends
+    Delay,
+    Reverb,
+    Master,         // Master filter, gain, compressor, soft clip
+    ScopeMeters,    // Scope writes, master capture, level meters
+    Total,          // Whole callback
+    Count
+};
+
+constexpr int kNumRenderStages = static_cast<int>(RenderStage::Count);
+
+inline const char* renderStageName(int stage) {
+    static const char* const kNames[kNumRenderStages] = {
+        "Events", "Plaits", "Rings", "Tracks", "Drums", "Sampler",
+        "Mixer", "Delay", "Reverb", "Master", "ScopeMeters", "Total"
+    };
+    return (stage >= 0 && stage < kNumRenderStages) ? kNames[stage] : "";
+}
+
+struct RenderStageStats {
+    float meanLoad;          // Fraction of the callback deadline (1.0 = full budget)
+    float p99Load;
+    float maxLoad;           // Peak since last reset
+    float meanNsPerSample;
+    uint64_t callbacks;      // Callbacks measured since last reset
+    uint64_t deadlineMisses; // Callbacks whose total time exceeded the deadline
+};
+
+class RenderProfiler {
+public:
+    static constexpr int kWindowSize = 512;  // Rolling window (callbacks) for mean/p99
+
+    RenderProfiler() { calibrate(); reset(); }
+
+    /// Monotonic cycle counter (TSC on x86, generic timer on ARM64).
+    static inline uint64_t readCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /// Clears all statistics. Not real-time safe with respect to a running callback;
+    /// readers may see a partially reset window for one callback.
+    void reset() {
+        for (auto& stage : m_stages) {
+            for (auto& value : stage.window) {
+                value.store(0.0f, std::memory_order_relaxed);
+            }
+            stage.peak.store(0.0f, std::memory_order_relaxed);
+        }
+        m_deadlineMisses.store(0, std::memory_order_relaxed);
+        m_callbacks.store(0, std::memory_order_release);
+    }
+
+    void setSampleRate(float sampleRate) {
+        m_sampleRate = sampleRate > 0.0f ? sampleRate : 48000.0f;
+    }
+
+    // ---- Audio thread ----
+
+    inline void beginCallback() {
+        m_pending.fill(0);
+        m_callbackStart = readCounter();
+        m_mark = m_callbackStart;
+    }
+
+    /// Attributes the time since the previous lap (or beginCallback) to `stage`.
+    inline void lap(RenderStage stage) {
+        const uint64_t now = readCounter();
+        m_pending[static_cast<int>(stage)] += now - m_mark;
+        m_mark = now;
+    }
+
+    /// Discards time since the previous lap (work that belongs to no stage).
+    inline void skip() { m_mark = readCounter(); }
+
+    /// Adds externally measured ticks (e.g. from a worker thread) to `stage`.
+    inline void addTicks(RenderStage stage, uint64_t ticks) {
+        m_pending[static_cast<int>(stage)] += ticks;
+    }
+
+    /// Publishes this callback's stage times. Returns the total load (fraction of deadline).
+    inline float endCallback(int numFrames) {
+        const uint64_t now = readCounter();
+        m_pending[static_cast<int>(RenderStage::Total)] = now - m_callbackStart;
+
+        const double budgetTicks = static_cast<double>(numFrames) * m_ticksPerSecond / m_sampleRate;
+        const double invBudget = budgetTicks > 0.0 ? 1.0 / budgetTicks : 0.0;
+        const uint64_t count = m_callbacks.load(std::memory_order_relaxed);
+        const size_t slot = static_cast<size_t>(count % kWindowSize);
+
+        float totalLoad = 0.0f;
+        for (int s = 0; s < kNumRenderStages; ++s) {
+            const float load = static_cast<float>(static_cast<double>(m_pending[s]) * invBudget);
+            StageState& stage = m_stages[s];
+            stage.window[slot].store(load, std::memory_order_relaxed);
+            if (load > stage.peak.load(std::memory_order_relaxed)) {
+                stage.peak.store(load, std::memory_order_relaxed);
+            }
+            totalLoad = load;  // Total is the last stage
+        }
+        if (totalLoad > 1.0f) {
+            m_deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_callbacks.store(count + 1, std::memory_order_release);
+        return totalLoad;
+    }
+
+    // ---- Any thread ----
+
+    bool getStats(int stageIndex, RenderStageStats& out) const {
+        if (stageIndex < 0 || stageIndex >= kNumRenderStages) {
+            return false;
+        }
+        const StageState& stage = m_stages[stageIndex];
+        const uint64_t callbacks = m_callbacks.load(std::memory_order_acquire);
+        const int n = static_cast<int>(std::min<uint64_t>(callbacks, kWindowSize));
+
+        std::array<float, kWindowSize> values;
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i) {
+            values[i] = stage.window[i].load(std::memory_order_relaxed);
+            sum += values[i];
+        }
+
+        out.callbacks = callbacks;
+        out.deadlineMisses = m_deadlineMisses.load(std::memory_order_relaxed);
+        out.maxLoad = stage.peak.load(std::memory_order_relaxed);
+        if (n == 0) {
+            out.meanLoad = 0.0f;
+            out.p99Load = 0.0f;
+            out.meanNsPerSample = 0.0f;
+            return true;
+        }
+
+        const int p99Index = (n - 1) * 99 / 100;
+        std::nth_element(values.begin(), values.begin() + p99Index, values.begin() + n);
+        out.meanLoad = static_cast<float>(sum / n);
+        out.p99Load = values[p99Index];
+        out.meanNsPerSample = out.meanLoad * 1.0e9f / m_sampleRate;
+        return true;
+    }
+
+    uint64_t getDeadlineMisses() const {
+        return m_deadlineMisses.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// Measures counter frequency against steady_clock (~2ms busy wait, init only).
+    void calibrate() {
+#if defined(__aarch64__)
+        uint64_t frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        m_ticksPerSecond = static_cast<double>(frequency);
+#elif defined(__x86_64__) || defined(__i386__)
+        using Clock = std::chrono::steady_clock;
+        const auto t0 = Clock::now();
+        const uint64_t c0 = readCounter();
+        while (Clock::now() - t0 < std::chrono::milliseconds(2)) {}
+        const uint64_t c1 = readCounter();
+        const auto t1 = Clock::now();
+        const double seconds = std::chrono::duration<double>(t1 - t0).count();
+        m_ticksPerSecond = seconds > 0.0 ? static_cast<double>(c1 - c0) / seconds : 1.0e9;
+#else
+        m_ticksPerSecond = 1.0e9;
+#endif
+    }
+
+    struct StageState {
+        std::array<std::atomic<float>, kWindowSize> window;
+        std::atomic<float> peak{0.0f};
+    };
+
+    std::array<StageState, kNumRenderStages> m_stages;
+    std::atomic<uint64_t> m_callbacks{0};
+    std::atomic<uint64_t> m_deadlineMisses{0};
+
+    // Audio-thread scratch
+    std::array<uint64_t, kNumRenderStages> m_pending{};
+    uint64_t m_callbackStart = 0;
+    uint64_t m_mark = 0;
+
+    double m_ticksPerSecond = 1.0e9;
+    float m_sampleRate = 48000.0f;
+};
+
+} // namespace Grainulator
+
+#endif // RENDERPROFILER_H
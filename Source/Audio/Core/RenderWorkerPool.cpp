@@ -0,0 +1,220 @@
+//
+//  RenderWorkerPool.cpp
+//  Grainulator
+//
+//  Fork-join worker pool for parallel voice rendering.
+//
+
+#include "RenderWorkerPool.h"
+#include <algorithm>
+#include <chrono>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <mach/mach_time.h>
+#include <mach/thread_policy.h>
+#include <pthread.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>  // _MM_SET_FLUSH_ZERO_MODE
+#include <pmmintrin.h>  // _MM_SET_DENORMALS_ZERO_MODE
+#endif
+
+namespace Grainulator {
+
+namespace {
+
+// Share of the audio period the caller spins before sleeping on the join
+constexpr double kJoinSpinFraction = 0.125;
+#if defined(__APPLE__)
+// Time-constraint shape, as fractions of the period (as Core Audio's IO thread)
+constexpr double kComputationFraction = 0.5;
+constexpr double kConstraintFraction = 1.0;
+#elif defined(__linux__)
+constexpr int kWorkerFifoPriority = 70;  // Below typical audio server threads (JACK/PipeWire: 80-88)
+#endif
+
+inline void cpuRelax() {
+#if defined(__aarch64__) || defined(__arm64__)
+    __builtin_arm_yield();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+inline int64_t nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+// ========== Pool ==========
+
+RenderWorkerPool::RenderWorkerPool() = default;
+
+RenderWorkerPool::~RenderWorkerPool() {
+    stop();
+}
+
+void RenderWorkerPool::start(int numWorkers, double periodSeconds) {
+    if (m_running.load(std::memory_order_acquire)) return;
+
+    m_periodSeconds = std::max(periodSeconds, 0.0);
+    m_spinBudgetNanos = static_cast<int64_t>(m_periodSeconds * kJoinSpinFraction * 1e9);
+    m_realtimeWorkers.store(0, std::memory_order_relaxed);
+    m_numThreads = std::clamp(numWorkers, 0, kMaxWorkers);
+    m_running.store(true, std::memory_order_release);
+    for (int i = 0; i < m_numThreads; ++i) {
+        m_threads[i] = std::thread([this]() { workerLoop(); });
+    }
+    m_activeWorkers.store(m_numThreads, std::memory_order_relaxed);
+}
+
+void RenderWorkerPool::stop() {
+    if (!m_running.load(std::memory_order_acquire)) return;
+
+    m_activeWorkers.store(0, std::memory_order_relaxed);
+    m_running.store(false, std::memory_order_release);
+    for (int i = 0; i < m_numThreads; ++i) {
+        m_wake.post();
+    }
+    for (int i = 0; i < m_numThreads; ++i) {
+        if (m_threads[i].joinable()) {
+            m_threads[i].join();
+        }
+    }
+    m_numThreads = 0;
+}
+
+void RenderWorkerPool::setActiveWorkers(int count) {
+    m_activeWorkers.store(std::clamp(count, 0, m_numThreads), std::memory_order_relaxed);
+}
+
+void RenderWorkerPool::run(JobFn fn, void* context, int numJobs) {
+    if (numJobs <= 0) return;
+
+    const int workers = std::min(m_activeWorkers.load(std::memory_order_relaxed), numJobs - 1);
+    if (workers <= 0 || m_busy.test_and_set(std::memory_order_acquire)) {
+        for (int i = 0; i < numJobs; ++i) {
+            fn(context, i);
+        }
+        return;
+    }
+
+    // Close the previous batch before touching fn/context, then publish the new one.
+    const uint64_t generation = (m_state.load(std::memory_order_relaxed) >> 32) + 1;
+    m_state.store((generation << 32) | kClosed, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_fn.store(fn, std::memory_order_relaxed);
+    m_context.store(context, std::memory_order_relaxed);
+    m_numJobs.store(numJobs, std::memory_order_relaxed);
+    m_completedJobs.store(0, std::memory_order_relaxed);
+    m_state.store(generation << 32, std::memory_order_release);
+
+    for (int i = 0; i < workers; ++i) {
+        m_wake.post();
+    }
+
+    // The caller works too; then waits for jobs still running on workers.
+    while (tryRunOneJob()) {}
+    waitForWorkers(numJobs);
+
+    m_busy.clear(std::memory_order_release);
+}
+
+void RenderWorkerPool::waitForWorkers(int numJobs) {
+    // Jobs on workers usually finish within the spin budget
+    const int64_t deadline = nowNanos() + m_spinBudgetNanos;
+    for (int spins = 0; m_completedJobs.load(std::memory_order_acquire) < numJobs; ++spins) {
+        if ((spins & 63) == 63 && nowNanos() >= deadline) {
+            // A worker was held up: sleep instead of burning the callback's core
+            m_joinWaiting.store(true);
+            if (m_completedJobs.load() < numJobs) {
+                m_joinDone.wait();
+            } else if (!m_joinWaiting.exchange(false)) {
+                m_joinDone.wait();  // The last worker claimed the flag; consume its post
+            }
+            return;
+        }
+        cpuRelax();
+    }
+}
+
+bool RenderWorkerPool::tryRunOneJob() {
+    uint64_t state = m_state.load(std::memory_order_acquire);
+    for (;;) {
+        const uint32_t index = static_cast<uint32_t>(state);
+        if (index == kClosed) return false;
+
+        JobFn fn = m_fn.load(std::memory_order_relaxed);
+        void* context = m_context.load(std::memory_order_relaxed);
+        const int numJobs = m_numJobs.load(std::memory_order_relaxed);
+        if (index >= static_cast<uint32_t>(numJobs)) return false;
+
+        // Pairs with the release fence in run(): if fn/context belong to a newer
+        // batch, the close of this one is visible and the CAS below fails.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_state.compare_exchange_weak(state, state + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+            fn(context, static_cast<int>(index));
+            if (m_completedJobs.fetch_add(1) + 1 == numJobs && m_joinWaiting.exchange(false)) {
+                m_joinDone.post();
+            }
+            return true;
+        }
+    }
+}
+
+void RenderWorkerPool::workerLoop() {
+    // MXCSR is per-thread: match the audio thread's denormal handling.
+#if defined(__x86_64__) || defined(__i386__)
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+    if (promoteToRealtime()) {
+        m_realtimeWorkers.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    for (;;) {
+        m_wake.wait();
+        if (!m_running.load(std::memory_order_acquire)) return;
+        while (tryRunOneJob()) {}
+    }
+}
+
+bool RenderWorkerPool::promoteToRealtime() {
+#if defined(__APPLE__)
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+    if (m_periodSeconds <= 0.0) return false;
+
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    const double ticksPerSecond = 1e9 * static_cast<double>(timebase.denom) / static_cast<double>(timebase.numer);
+    const double periodTicks = m_periodSeconds * ticksPerSecond;
+
+    thread_time_constraint_policy_data_t policy;
+    policy.period = static_cast<uint32_t>(periodTicks);
+    policy.computation = static_cast<uint32_t>(periodTicks * kComputationFraction);
+    policy.constraint = static_cast<uint32_t>(periodTicks * kConstraintFraction);
+    policy.preemptible = 1;
+    return thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_TIME_CONSTRAINT_POLICY,
+                             reinterpret_cast<thread_policy_t>(&policy),
+                             THREAD_TIME_CONSTRAINT_POLICY_COUNT) == KERN_SUCCESS;
+#elif defined(__linux__)
+    // Needs CAP_SYS_NICE or an rtprio limit; otherwise the worker stays on SCHED_OTHER
+    sched_param param{};
+    param.sched_priority = std::clamp(kWorkerFifoPriority, sched_get_priority_min(SCHED_FIFO),
+                                      sched_get_priority_max(SCHED_FIFO));
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace Grainulator
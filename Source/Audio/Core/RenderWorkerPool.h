@@ -0,0 +1,88 @@
+//
+//  RenderWorkerPool.h
+//  Grainulator
+//
+//  Fork-join worker pool for rendering independent voices in parallel.
+//  Threads are spawned once (off the audio thread); run() is allocation-free
+//  and lock-free on the caller side. The calling thread always takes part in
+//  the work, so a batch completes even if no worker wakes in time.
+//
+//  Workers ask for real-time scheduling sized to the audio period (a Mach
+//  time-constraint policy on Apple, SCHED_FIFO on Linux when permitted), so a
+//  job they claim is not starved by ordinary threads. Once the caller runs
+//  out of jobs it spins for a fraction of the period on jobs still running
+//  on workers, then sleeps until the last one signals completion.
+//
+
+#ifndef RENDERWORKERPOOL_H
+#define RENDERWORKERPOOL_H
+
+#include "WakeSemaphore.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace Grainulator {
+
+class RenderWorkerPool {
+public:
+    static constexpr int kMaxWorkers = 7;
+
+    using JobFn = void (*)(void* context, int jobIndex);
+
+    RenderWorkerPool();
+    ~RenderWorkerPool();
+
+    /// Spawns up to kMaxWorkers threads, scheduled for a callback every
+    /// periodSeconds. Not real-time safe.
+    void start(int numWorkers, double periodSeconds);
+    /// Joins all threads. Not real-time safe; no run() may be in flight.
+    void stop();
+
+    /// Limits how many spawned workers take part in run(). Real-time safe.
+    void setActiveWorkers(int count);
+    int getActiveWorkers() const { return m_activeWorkers.load(std::memory_order_relaxed); }
+    int getSpawnedWorkers() const { return m_numThreads; }
+    /// Workers the OS granted real-time scheduling (0 if it was refused)
+    int getRealtimeWorkers() const { return m_realtimeWorkers.load(std::memory_order_relaxed); }
+
+    /// Runs fn(context, i) for i in [0, numJobs) and returns when all jobs are done.
+    /// Runs inline on the caller if no workers are active or another batch is in flight.
+    void run(JobFn fn, void* context, int numJobs);
+
+private:
+    void workerLoop();
+    bool tryRunOneJob();
+    bool promoteToRealtime();
+    void waitForWorkers(int numJobs);
+
+    // Batch state. m_state packs (generation << 32 | next job index); the index is
+    // set to kClosed while a new batch is being published so stale workers from the
+    // previous batch can never claim a job with mismatched fn/context.
+    static constexpr uint32_t kClosed = 0xFFFFFFFFu;
+    std::atomic<uint64_t> m_state{kClosed};
+    std::atomic<JobFn> m_fn{nullptr};
+    std::atomic<void*> m_context{nullptr};
+    std::atomic<int> m_numJobs{0};
+    std::atomic<int> m_completedJobs{0};
+    std::atomic_flag m_busy = ATOMIC_FLAG_INIT;
+
+    std::atomic<bool> m_running{false};
+    std::atomic<int> m_activeWorkers{0};
+    std::atomic<int> m_realtimeWorkers{0};
+    int m_numThreads = 0;
+    double m_periodSeconds = 0.0;
+    int64_t m_spinBudgetNanos = 0;
+    std::thread m_threads[kMaxWorkers];
+    WakeSemaphore m_wake;
+
+    // Join: after the spin budget the caller raises m_joinWaiting and sleeps on
+    // m_joinDone; the worker that completes the last job posts it.
+    std::atomic<bool> m_joinWaiting{false};
+    WakeSemaphore m_joinDone;
+};
+
+} // namespace Grainulator
+
+#endif // RENDERWORKERPOOL_H
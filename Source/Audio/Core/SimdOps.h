@@ -0,0 +1,180 @@
+//
+//  SimdOps.h
+//  Grainulator
+//
+//  Minimal 4-lane float vector wrapper: NEON on ARM, SSE on x86, plain
+//  arrays elsewhere. Only the handful of operations the DSP kernels need.
+//  truncate() rounds toward zero and is valid for |a| < 2^31; pow2i() builds
+//  2^n from the exponent bits for integral n in [-126, 127]. load_s16/s32/s24
+//  convert four integer PCM values to floats, unscaled. transpose() turns
+//  four row vectors into four column vectors.
+//
+
+#ifndef SIMDOPS_H
+#define SIMDOPS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GRAINULATOR_SIMD_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GRAINULATOR_SIMD_SSE 1
+#endif
+
+namespace Grainulator {
+namespace simd {
+
+constexpr int kWidth = 4;
+
+#if defined(GRAINULATOR_SIMD_NEON)
+
+using f4 = float32x4_t;
+
+inline f4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, f4 v) { vst1q_f32(p, v); }
+inline f4 set1(float x) { return vdupq_n_f32(x); }
+inline f4 setr(float a, float b, float c, float d) {
+    const float values[4] = {a, b, c, d};
+    return vld1q_f32(values);
+}
+inline f4 add(f4 a, f4 b) { return vaddq_f32(a, b); }
+inline f4 sub(f4 a, f4 b) { return vsubq_f32(a, b); }
+inline f4 mul(f4 a, f4 b) { return vmulq_f32(a, b); }
+inline f4 madd(f4 a, f4 b, f4 c) { return vmlaq_f32(c, a, b); }  // a * b + c
+inline f4 max(f4 a, f4 b) { return vmaxq_f32(a, b); }
+inline f4 min(f4 a, f4 b) { return vminq_f32(a, b); }
+inline f4 abs(f4 a) { return vabsq_f32(a); }
+inline f4 div(f4 a, f4 b) {
+#if defined(__aarch64__)
+    return vdivq_f32(a, b);
+#else
+    float32x4_t r = vrecpeq_f32(b);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    return vmulq_f32(a, r);
+#endif
+}
+inline f4 truncate(f4 a) { return vcvtq_f32_s32(vcvtq_s32_f32(a)); }
+inline f4 load_s16(const int16_t* p) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(p))); }
+inline f4 load_s32(const int32_t* p) { return vcvtq_f32_s32(vld1q_s32(p)); }
+inline f4 pow2i(f4 n) {
+    return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23));
+}
+inline float hsum(f4 a) {
+#if defined(__aarch64__)
+    return vaddvq_f32(a);
+#else
+    float32x2_t s = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif
+}
+inline float hmax(f4 a) {
+#if defined(__aarch64__)
+    return vmaxvq_f32(a);
+#else
+    float32x2_t m = vmax_f32(vget_low_f32(a), vget_high_f32(a));
+    return vget_lane_f32(vpmax_f32(m, m), 0);
+#endif
+}
+inline void transpose(f4& a, f4& b, f4& c, f4& d) {
+    const float32x4x2_t ab = vtrnq_f32(a, b);   // a0 b0 a2 b2 | a1 b1 a3 b3
+    const float32x4x2_t cd = vtrnq_f32(c, d);
+    a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+    b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+    c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+    d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+
+#elif defined(GRAINULATOR_SIMD_SSE)
+
+using f4 = __m128;
+
+inline f4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, f4 v) { _mm_storeu_ps(p, v); }
+inline f4 set1(float x) { return _mm_set1_ps(x); }
+inline f4 setr(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+inline f4 add(f4 a, f4 b) { return _mm_add_ps(a, b); }
+inline f4 sub(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+inline f4 mul(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+inline f4 madd(f4 a, f4 b, f4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline f4 max(f4 a, f4 b) { return _mm_max_ps(a, b); }
+inline f4 min(f4 a, f4 b) { return _mm_min_ps(a, b); }
+inline f4 abs(f4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline f4 div(f4 a, f4 b) { return _mm_div_ps(a, b); }
+inline f4 truncate(f4 a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+inline f4 load_s16(const int16_t* p) {
+    // Sign-extend by placing each value in the top half of a lane, then shifting down
+    const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+inline f4 load_s32(const int32_t* p) {
+    return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+inline f4 pow2i(f4 n) {
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23));
+}
+inline float hsum(f4 a) {
+    __m128 shuf = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(a, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+}
+inline float hmax(f4 a) {
+    __m128 shuf = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 m = _mm_max_ps(a, shuf);
+    shuf = _mm_movehl_ps(shuf, m);
+    return _mm_cvtss_f32(_mm_max_ss(m, shuf));
+}
+inline void transpose(f4& a, f4& b, f4& c, f4& d) { _MM_TRANSPOSE4_PS(a, b, c, d); }
+
+#else
+
+struct f4 { float v[4]; };
+
+inline f4 load(const float* p) { return f4{{p[0], p[1], p[2], p[3]}}; }
+inline void store(float* p, f4 a) { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+inline f4 set1(float x) { return f4{{x, x, x, x}}; }
+inline f4 setr(float a, float b, float c, float d) { return f4{{a, b, c, d}}; }
+inline f4 add(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+inline f4 sub(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+inline f4 mul(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+inline f4 madd(f4 a, f4 b, f4 c) { for (int i = 0; i < 4; ++i) c.v[i] += a.v[i] * b.v[i]; return c; }
+inline f4 max(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] = std::max(a.v[i], b.v[i]); return a; }
+inline f4 min(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] = std::min(a.v[i], b.v[i]); return a; }
+inline f4 abs(f4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::fabs(a.v[i]); return a; }
+inline f4 div(f4 a, f4 b) { for (int i = 0; i < 4; ++i) a.v[i] /= b.v[i]; return a; }
+inline f4 truncate(f4 a) { for (int i = 0; i < 4; ++i) a.v[i] = std::trunc(a.v[i]); return a; }
+inline f4 load_s16(const int16_t* p) { return f4{{float(p[0]), float(p[1]), float(p[2]), float(p[3])}}; }
+inline f4 load_s32(const int32_t* p) { return f4{{float(p[0]), float(p[1]), float(p[2]), float(p[3])}}; }
+inline f4 pow2i(f4 n) { for (int i = 0; i < 4; ++i) n.v[i] = std::ldexp(1.0f, static_cast<int>(n.v[i])); return n; }
+inline float hsum(f4 a) { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+inline float hmax(f4 a) { return std::max(std::max(a.v[0], a.v[1]), std::max(a.v[2], a.v[3])); }
+inline void transpose(f4& a, f4& b, f4& c, f4& d) {
+    const f4 r[4] = {a, b, c, d};
+    f4* out[4] = {&a, &b, &c, &d};
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) out[i]->v[j] = r[j].v[i];
+    }
+}
+
+#endif
+
+/// Four packed little-endian 24-bit values (12 bytes). There is no byte
+/// shuffle in baseline SSE2, so the lanes are assembled in scalar code.
+inline f4 load_s24(const uint8_t* p) {
+    int32_t lanes[4];
+    for (int i = 0; i < 4; ++i, p += 3) {
+        const uint32_t bits = (uint32_t(p[0]) << 8) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 24);
+        lanes[i] = static_cast<int32_t>(bits) >> 8;
+    }
+    return load_s32(lanes);
+}
+
+} // namespace simd
+} // namespace Grainulator
+
+#endif // SIMDOPS_H
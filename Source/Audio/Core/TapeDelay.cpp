@@ -0,0 +1,244 @@
+//
+//  TapeDelay.cpp
+//  Grainulator
+//
+//  Block-based multi-head tape echo (see TapeDelay.h).
+//
+
+#include "TapeDelay.h"
+#include "FastMath.h"
+#include "SimdOps.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Grainulator {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979323846f;
+constexpr float kTwoPi = 6.28318530717958647692f;
+constexpr int kNumHeadModes = 8;
+constexpr int kNumDivisions = 9;
+constexpr float kWowHz = 0.17f;
+constexpr float kFlutterHz = 5.4f;
+
+// Head spacing roughly follows a fixed multi-head tape layout. Lane 3 of the
+// head vectors is padding and always has zero gain.
+constexpr float kHeadRatios[4] = {1.0f, 1.42f, 1.95f, 1.0f};
+constexpr float kHeadGains[TapeDelay::kNumHeads] = {0.55f, 0.40f, 0.30f};
+constexpr float kHeadPans[TapeDelay::kNumHeads] = {-0.55f, 0.0f, 0.55f};
+constexpr float kHeadFeedback[4] = {1.0f, 1.0f, 0.85f, 0.0f};
+
+// Classic space-echo head combinations.
+constexpr float kModeMatrix[kNumHeadModes][TapeDelay::kNumHeads] = {
+    {1.00f, 0.00f, 0.00f}, // Head 1
+    {0.00f, 1.00f, 0.00f}, // Head 2
+    {0.00f, 0.00f, 1.00f}, // Head 3
+    {0.85f, 0.65f, 0.00f}, // 1 + 2
+    {0.00f, 0.75f, 0.58f}, // 2 + 3
+    {0.80f, 0.00f, 0.58f}, // 1 + 3
+    {0.72f, 0.55f, 0.42f}, // 1 + 2 + 3
+    {0.95f, 0.45f, 0.28f}  // dense stack
+};
+
+// Rhythmic values in quarter-note units.
+constexpr float kDivisionTable[kNumDivisions] = {
+    2.0f, 1.333333f, 1.5f, 1.0f, 0.666667f, 0.75f, 0.5f, 0.333333f, 0.25f
+};
+
+inline float nextNoise(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return (static_cast<float>((state >> 8) & 0x00FFFFFF) / 16777216.0f) * 2.0f - 1.0f;
+}
+
+inline float wrapPhase(float phase) {
+    phase = std::fmod(phase, kTwoPi);
+    return phase < 0.0f ? phase + kTwoPi : phase;
+}
+
+} // namespace
+
+TapeDelay::TapeDelay(double sampleRate)
+    : m_sampleRate(static_cast<float>(sampleRate))
+    , m_bufferL(kRingSize)
+    , m_bufferR(kRingSize)
+{
+    const float wowStep = kTwoPi * kWowHz / m_sampleRate;
+    const float flutterStep = kTwoPi * kFlutterHz / m_sampleRate;
+    m_wowRotSin = std::sin(wowStep);
+    m_wowRotCos = std::cos(wowStep);
+    m_flutterRotSin = std::sin(flutterStep);
+    m_flutterRotCos = std::cos(flutterStep);
+
+    float feedbackHPCoeff = 1.0f - (kTwoPi * 110.0f / m_sampleRate);
+    m_feedbackHPCoeff = std::max(0.0f, std::min(feedbackHPCoeff, 0.9999f));
+
+    reset(Params{});
+}
+
+void TapeDelay::reset(const Params& params) {
+    std::fill(m_bufferL.begin(), m_bufferL.end(), 0.0f);
+    std::fill(m_bufferR.begin(), m_bufferR.end(), 0.0f);
+    m_writePos = 0;
+    m_timeSmoothed = targetHead1Seconds(params);
+    m_wowPhase = 0.0f;
+    m_flutterPhase = 0.0f;
+    m_drift = 0.0f;
+    m_noiseState = 0x12345678u;
+    m_feedbackLP = 0.0f;
+    m_feedbackHPIn = 0.0f;
+    m_feedbackHPOut = 0.0f;
+    m_toneL = 0.0f;
+    m_toneR = 0.0f;
+    m_current = params;
+}
+
+float TapeDelay::targetHead1Seconds(const Params& params) const {
+    float seconds;
+    if (params.sync) {
+        const int divisionIndex = std::clamp(static_cast<int>(params.subdivision * static_cast<float>(kNumDivisions - 1) + 0.5f), 0, kNumDivisions - 1);
+        const float beatSeconds = 60.0f / std::max(40.0f, params.tempoBPM);
+        seconds = beatSeconds * kDivisionTable[divisionIndex];
+    } else {
+        // Free repeat-rate mapping: short head ranges ~60ms to ~450ms.
+        const float repeatCurve = params.time * params.time;
+        seconds = 0.06f + repeatCurve * 0.39f;
+    }
+
+    const float maxHead1Seconds = (static_cast<float>(kMaxDelayLength - 4) / m_sampleRate) / kHeadRatios[kNumHeads - 1];
+    return std::clamp(seconds, 0.03f, maxHead1Seconds);
+}
+
+float TapeDelay::process(float* left, float* right, int numFrames, const Params& params) {
+    using namespace simd;
+    if (numFrames <= 0) return 0.0f;
+
+    // Per-block head constants
+    const int modeIndex = std::clamp(static_cast<int>(params.headMode * static_cast<float>(kNumHeadModes - 1) + 0.5f), 0, kNumHeadModes - 1);
+    float gains[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float pansL[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float pansR[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < kNumHeads; ++i) {
+        const float modeGain = kModeMatrix[modeIndex][i];
+        gains[i] = modeGain < 0.001f ? 0.0f : kHeadGains[i] * modeGain;
+        const float panAngle = (kHeadPans[i] + 1.0f) * 0.25f * kPi;
+        pansL[i] = std::cos(panAngle);
+        pansR[i] = std::sin(panAngle);
+    }
+    const f4 headGain = mul(load(gains), set1(0.5f));  // Folds in the (L + R) / 2 mono sum
+    const f4 headPanL = load(pansL);
+    const f4 headPanR = load(pansR);
+    const f4 headFeedback = load(kHeadFeedback);
+    const f4 headRatio = load(kHeadRatios);
+    const f4 minDelay = set1(1.0f);
+    const f4 maxDelay = set1(static_cast<float>(kMaxDelayLength - 2));
+
+    const float targetSeconds = targetHead1Seconds(params);
+    const float timeSmoothing = params.sync ? 0.0028f : 0.0015f;
+
+    // Resync the recursive oscillators to their phase; they only run for one block
+    float wowSin = std::sin(m_wowPhase), wowCos = std::cos(m_wowPhase);
+    float flutterSin = std::sin(m_flutterPhase), flutterCos = std::cos(m_flutterPhase);
+
+    float* bufferL = m_bufferL.data();
+    float* bufferR = m_bufferR.data();
+    size_t w = m_writePos;
+    float peak = 0.0f;
+
+    for (int start = 0; start < numFrames; start += kControlInterval) {
+        const int count = std::min(kControlInterval, numFrames - start);
+
+        // Control-rate ramp from the previous call's values to this call's
+        const float t = static_cast<float>(start + count) / static_cast<float>(numFrames);
+        const float feedback = m_current.feedback + (params.feedback - m_current.feedback) * t;
+        const float mix = m_current.mix + (params.mix - m_current.mix) * t;
+        const float wow = m_current.wow + (params.wow - m_current.wow) * t;
+        const float flutter = m_current.flutter + (params.flutter - m_current.flutter) * t;
+        const float tone = m_current.tone + (params.tone - m_current.tone) * t;
+
+        const float wowDepth = 0.0010f + wow * 0.0070f;
+        const float flutterDepth = 0.00025f + flutter * 0.0025f;
+        const float driftDepth = 0.0007f + wow * 0.0014f;
+        const float feedbackLPCoeff = std::clamp((0.28f + tone * 0.32f) - feedback * 0.12f, 0.08f, 0.80f);
+        const float feedbackDrive = 1.1f + feedback * 2.2f;
+        const float feedbackGain = feedback * 0.92f;
+        const float preampDrive = 1.0f + feedback * 1.4f;
+        const float outputToneCoeff = std::clamp((0.35f + tone * 0.35f) - feedback * 0.15f, 0.10f, 0.90f);
+        const float dryGain = 1.0f - mix;
+
+        for (int n = start; n < start + count; ++n, ++w) {
+            m_timeSmoothed += (targetSeconds - m_timeSmoothed) * timeSmoothing;
+
+            // Tape speed modulation (wow, flutter, and slow random drift).
+            const float ws = wowSin * m_wowRotCos + wowCos * m_wowRotSin;
+            wowCos = wowCos * m_wowRotCos - wowSin * m_wowRotSin;
+            wowSin = ws;
+            const float fs = flutterSin * m_flutterRotCos + flutterCos * m_flutterRotSin;
+            flutterCos = flutterCos * m_flutterRotCos - flutterSin * m_flutterRotSin;
+            flutterSin = fs;
+            m_drift = m_drift * 0.99985f + nextNoise(m_noiseState) * 0.00015f;
+            const float speedMod = std::clamp(
+                wowSin * wowDepth + flutterSin * flutterDepth + m_drift * driftDepth, -0.02f, 0.02f);
+
+            // Fractional reads for all heads at once
+            const f4 delay = min(max(mul(set1(m_timeSmoothed * (1.0f + speedMod) * m_sampleRate), headRatio), minDelay), maxDelay);
+            float delays[4];
+            float fracs[4];
+            size_t indexA[4];
+            size_t indexB[4];
+            store(delays, delay);
+            for (int h = 0; h < 4; ++h) {
+                const size_t whole = static_cast<size_t>(delays[h]);
+                fracs[h] = delays[h] - static_cast<float>(whole);
+                indexA[h] = (w - whole) & kRingMask;
+                indexB[h] = (w - whole - 1) & kRingMask;
+            }
+            const f4 frac = load(fracs);
+            const f4 aL = setr(bufferL[indexA[0]], bufferL[indexA[1]], bufferL[indexA[2]], bufferL[indexA[3]]);
+            const f4 bL = setr(bufferL[indexB[0]], bufferL[indexB[1]], bufferL[indexB[2]], bufferL[indexB[3]]);
+            const f4 aR = setr(bufferR[indexA[0]], bufferR[indexA[1]], bufferR[indexA[2]], bufferR[indexA[3]]);
+            const f4 bR = setr(bufferR[indexB[0]], bufferR[indexB[1]], bufferR[indexB[2]], bufferR[indexB[3]]);
+            const f4 tapL = add(aL, mul(sub(bL, aL), frac));
+            const f4 tapR = add(aR, mul(sub(bR, aR), frac));
+            const f4 headOut = mul(add(tapL, tapR), headGain);
+
+            const float echoL = hsum(mul(headOut, headPanL));
+            const float echoR = hsum(mul(headOut, headPanR));
+            const float feedbackSum = hsum(mul(headOut, headFeedback));
+
+            // Roll off highs/lows in the feedback path like aging tape.
+            m_feedbackLP += (fastmath::tanh(feedbackSum * feedbackDrive) - m_feedbackLP) * feedbackLPCoeff;
+            const float feedbackHP = m_feedbackHPCoeff * (m_feedbackHPOut + m_feedbackLP - m_feedbackHPIn);
+            m_feedbackHPIn = m_feedbackLP;
+            m_feedbackHPOut = feedbackHP;
+
+            // Tape preamp behavior before writing back to the loop.
+            const float inputMono = (left[n] + right[n]) * 0.5f;
+            const float preampedInput = fastmath::tanh(inputMono * preampDrive);
+            const float hiss = nextNoise(m_noiseState) * 0.00003f;
+
+            const float writeSample = preampedInput + feedbackHP * feedbackGain + hiss;
+            const size_t writeIndex = w & kRingMask;
+            bufferL[writeIndex] = writeSample;
+            bufferR[writeIndex] = writeSample * 0.985f + feedbackHP * 0.02f;
+
+            // Output tone shaping to keep repeats dark and soft.
+            m_toneL += (echoL - m_toneL) * outputToneCoeff;
+            m_toneR += (echoR - m_toneR) * outputToneCoeff;
+            const float delayedL = fastmath::tanh(m_toneL * 1.25f);
+            const float delayedR = fastmath::tanh(m_toneR * 1.25f);
+            peak = std::max(peak, std::max(std::fabs(delayedL), std::fabs(delayedR)));
+
+            left[n] = left[n] * dryGain + delayedL * mix;
+            right[n] = right[n] * dryGain + delayedR * mix;
+        }
+    }
+
+    m_writePos = w & kRingMask;
+    m_wowPhase = wrapPhase(m_wowPhase + kTwoPi * kWowHz / m_sampleRate * static_cast<float>(numFrames));
+    m_flutterPhase = wrapPhase(m_flutterPhase + kTwoPi * kFlutterHz / m_sampleRate * static_cast<float>(numFrames));
+    m_current = params;
+    return peak;
+}
+
+} // namespace Grainulator
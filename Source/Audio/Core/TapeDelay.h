@@ -0,0 +1,87 @@
+//
+//  TapeDelay.h
+//  Grainulator
+//
+//  RE-201 style multi-head tape echo on send A, processed a block at a time.
+//  Wow and flutter come from recursive sine oscillators resynced to their
+//  phase once per block, saturation uses fastmath::tanh, and the three
+//  heads' fractional reads, gains and pans are evaluated as one SIMD vector.
+//  Parameters are ramped at control rate (every kControlInterval samples)
+//  from the values used by the previous call, so modulation does not zipper.
+//
+//  Storage is allocated once in the constructor; process() is allocation-free.
+//
+
+#ifndef TAPEDELAY_H
+#define TAPEDELAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Grainulator {
+
+struct TapeDelayParams {
+    float time = 0.3f;          // 0-1 repeat rate (free mode)
+    float feedback = 0.38f;     // 0-0.95
+    float mix = 0.0f;           // 0-1 dry/wet
+    float headMode = 0.86f;     // 0-1 discrete head combination
+    float wow = 0.5f;           // 0-1 depth
+    float flutter = 0.5f;       // 0-1 depth
+    float tone = 0.45f;         // 0-1 dark->bright
+    bool sync = false;          // tempo sync enable
+    float tempoBPM = 120.0f;
+    float subdivision = 0.375f; // 0-1 discrete subdivision index
+};
+
+class TapeDelay {
+public:
+    using Params = TapeDelayParams;
+
+    static constexpr size_t kMaxDelayLength = 192000;  // 4 seconds @ 48kHz
+    static constexpr int kNumHeads = 3;
+    static constexpr int kControlInterval = 16;
+
+    explicit TapeDelay(double sampleRate);
+
+    /// Clears the tape and jumps the head spacing to the params' time.
+    void reset(const Params& params);
+
+    /// Mixes the echo into left/right in place. Returns the peak of the wet
+    /// signal, for tail tracking.
+    float process(float* left, float* right, int numFrames, const Params& params);
+
+private:
+    static constexpr size_t kRingSize = 262144;  // Power of two > kMaxDelayLength
+    static constexpr size_t kRingMask = kRingSize - 1;
+
+    float targetHead1Seconds(const Params& params) const;
+
+    float m_sampleRate;
+    std::vector<float> m_bufferL;
+    std::vector<float> m_bufferR;
+    size_t m_writePos;
+    float m_timeSmoothed;
+
+    // Wow/flutter: phase is the source of truth, (sin, cos) is rotated per sample
+    float m_wowPhase;
+    float m_flutterPhase;
+    float m_wowRotSin, m_wowRotCos;
+    float m_flutterRotSin, m_flutterRotCos;
+    float m_drift;
+    uint32_t m_noiseState;
+
+    float m_feedbackLP;
+    float m_feedbackHPIn;
+    float m_feedbackHPOut;
+    float m_feedbackHPCoeff;
+    float m_toneL;
+    float m_toneR;
+
+    // Values reached by the previous call; ramps start from here
+    Params m_current;
+};
+
+} // namespace Grainulator
+
+#endif // TAPEDELAY_H
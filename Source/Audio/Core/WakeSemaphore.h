@@ -0,0 +1,53 @@
+//
+//  WakeSemaphore.h
+//  Grainulator
+//
+//  Counting semaphore for waking a sleeping helper thread from the audio
+//  thread. post() never blocks or allocates: a dispatch semaphore on Apple
+//  platforms, a futex-backed POSIX semaphore elsewhere (one atomic op, plus a
+//  wake syscall only when a thread is actually sleeping).
+//
+
+#ifndef WAKESEMAPHORE_H
+#define WAKESEMAPHORE_H
+
+#if defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+namespace Grainulator {
+
+class WakeSemaphore {
+public:
+#if defined(__APPLE__)
+    WakeSemaphore() : m_sem(dispatch_semaphore_create(0)) {}
+    ~WakeSemaphore() { dispatch_release(m_sem); }
+    void post() { dispatch_semaphore_signal(m_sem); }
+    void wait() { dispatch_semaphore_wait(m_sem, DISPATCH_TIME_FOREVER); }
+#else
+    WakeSemaphore() { sem_init(&m_sem, 0, 0); }
+    ~WakeSemaphore() { sem_destroy(&m_sem); }
+    void post() { sem_post(&m_sem); }
+    void wait() {
+        while (sem_wait(&m_sem) != 0) {
+            // Retry on EINTR
+        }
+    }
+#endif
+
+private:
+#if defined(__APPLE__)
+    dispatch_semaphore_t m_sem;
+#else
+    sem_t m_sem;
+#endif
+
+    WakeSemaphore(const WakeSemaphore&) = delete;
+    WakeSemaphore& operator=(const WakeSemaphore&) = delete;
+};
+
+} // namespace Grainulator
+
+#endif // WAKESEMAPHORE_H
@@ -6,6 +6,7 @@
 //
 
 #include "DaisyDrumVoice.h"
+#include "DrumHitCache.h"
 
 #include "DaisySP/Utility/dsp.h"
 #include "DaisySP/Drums/analogbassdrum.h"
@@ -35,6 +36,15 @@ DaisyDrumVoice::DaisyDrumVoice()
     , morph_mod_(0.f)
     , trigger_state_(false)
     , prev_trigger_(false)
+    , params_dirty_(true)
+    , hit_cache_(nullptr)
+    , hit_(nullptr)
+    , hit_pos_(0)
+    , fade_hit_(nullptr)
+    , fade_pos_(0)
+    , fade_remaining_(0)
+    , engine_parked_(false)
+    , engine_fade_remaining_(0)
     , analog_kick_(nullptr)
     , synth_kick_(nullptr)
     , analog_snare_(nullptr)
@@ -56,14 +66,15 @@ DaisyDrumVoice::~DaisyDrumVoice() {
     delete static_cast<DaisyHiHat*>(hihat_);
 }
 
-void DaisyDrumVoice::Init(float sample_rate) {
+void DaisyDrumVoice::Init(float sample_rate, uint32_t noise_seed) {
     sample_rate_ = sample_rate;
+    silence_.Init(sample_rate);
 
     static_cast<daisysp::AnalogBassDrum*>(analog_kick_)->Init(sample_rate);
-    static_cast<daisysp::SyntheticBassDrum*>(synth_kick_)->Init(sample_rate);
-    static_cast<daisysp::AnalogSnareDrum*>(analog_snare_)->Init(sample_rate);
-    static_cast<daisysp::SyntheticSnareDrum*>(synth_snare_)->Init(sample_rate);
-    static_cast<DaisyHiHat*>(hihat_)->Init(sample_rate);
+    static_cast<daisysp::SyntheticBassDrum*>(synth_kick_)->Init(sample_rate, noise_seed);
+    static_cast<daisysp::AnalogSnareDrum*>(analog_snare_)->Init(sample_rate, noise_seed);
+    static_cast<daisysp::SyntheticSnareDrum*>(synth_snare_)->Init(sample_rate, noise_seed);
+    static_cast<DaisyHiHat*>(hihat_)->Init(sample_rate, noise_seed);
 
     // Set default frequencies
     float defaultFreq = daisysp::mtof(note_);
@@ -72,6 +83,7 @@ void DaisyDrumVoice::Init(float sample_rate) {
     static_cast<daisysp::AnalogSnareDrum*>(analog_snare_)->SetFreq(defaultFreq);
     static_cast<daisysp::SyntheticSnareDrum*>(synth_snare_)->SetFreq(defaultFreq);
     static_cast<DaisyHiHat*>(hihat_)->SetFreq(daisysp::mtof(60.f));
+    params_dirty_ = true;
 }
 
 void DaisyDrumVoice::Render(float* out, float* aux, size_t size) {
@@ -79,6 +91,104 @@ void DaisyDrumVoice::Render(float* out, float* aux, size_t size) {
     bool should_trigger = trigger_state_ && !prev_trigger_;
     prev_trigger_ = trigger_state_;
 
+    if (params_dirty_) {
+        PushParameters();
+        params_dirty_ = false;
+    }
+
+    bool engine_trigger = should_trigger;
+    if (should_trigger) {
+        // Modulated hits differ every time: only plain triggers use the cache
+        const bool modulated = harmonics_mod_ != 0.f || timbre_mod_ != 0.f || morph_mod_ != 0.f;
+        const DrumHit* hit = nullptr;
+        if (hit_cache_ && !modulated) {
+            hit = hit_cache_->Acquire({engine_, note_, harmonics_, timbre_, morph_, level_});
+        }
+
+        // Whatever was playing fades out under the new hit
+        if (hit_) {
+            ReleaseHit(fade_hit_);
+            fade_hit_ = hit_;
+            fade_pos_ = hit_pos_;
+            fade_remaining_ = kDeclickFrames;
+        }
+        hit_ = hit;
+        hit_pos_ = 0;
+
+        if (hit) {
+            if (!engine_parked_) {
+                engine_parked_ = true;
+                engine_fade_remaining_ = silence_.IsSilent() ? 0 : kDeclickFrames;
+            }
+            engine_trigger = false;
+        } else {
+            engine_parked_ = false;
+            engine_fade_remaining_ = 0;
+        }
+    }
+
+    // The cached hit was rendered at its key's level; follow later level changes
+    const float hit_gain = (hit_ && hit_->key.level > 0.f) ? level_ / hit_->key.level : 0.f;
+    const float fade_gain = (fade_hit_ && fade_hit_->key.level > 0.f) ? level_ / fade_hit_->key.level : 0.f;
+    constexpr float kFadeStep = 1.f / kDeclickFrames;
+
+    // Process sample-by-sample
+    float peak = 0.f;
+    for (size_t i = 0; i < size; ++i) {
+        float sample = 0.f;
+
+        if (!engine_parked_ || engine_fade_remaining_ > 0) {
+            sample = ProcessEngine((i == 0) && engine_trigger);
+
+            // Silence is judged before the level so a muted drum keeps its tail
+            peak = std::max(peak, std::fabs(sample));
+
+            // Apply level as output gain (accent alone is too subtle)
+            sample *= level_;
+
+            // Hard clamp to ±1.0 — saturation is handled by the master bus tanh
+            sample = std::max(-1.0f, std::min(1.0f, sample));
+
+            if (engine_parked_) {
+                sample *= static_cast<float>(--engine_fade_remaining_) * kFadeStep;
+            }
+        }
+
+        if (hit_ && hit_pos_ < hit_->length) {
+            const float s = hit_->samples[hit_pos_++] * hit_gain;
+            peak = std::max(peak, std::fabs(s));
+            sample += s;
+        }
+        if (fade_hit_ && fade_remaining_ > 0) {
+            const float gain = static_cast<float>(--fade_remaining_) * kFadeStep;
+            if (fade_pos_ < fade_hit_->length) {
+                sample += fade_hit_->samples[fade_pos_++] * fade_gain * gain;
+            }
+        }
+        if (hit_ || fade_hit_) {
+            sample = std::max(-1.0f, std::min(1.0f, sample));
+        }
+
+        if (out) out[i] = sample;
+        if (aux) aux[i] = sample * 0.7f;
+    }
+
+    silence_.ProcessPeak(peak, size);
+
+    if (hit_ && hit_pos_ >= hit_->length) {
+        ReleaseHit(hit_);
+    }
+    if (fade_hit_ && (fade_remaining_ == 0 || fade_pos_ >= fade_hit_->length)) {
+        ReleaseHit(fade_hit_);
+    }
+
+    // Auto-clear trigger after processing
+    if (should_trigger) {
+        trigger_state_ = false;
+    }
+}
+
+void DaisyDrumVoice::PushParameters() {
     // Apply modulation to base parameters
     float h = daisysp::fclamp(harmonics_ + harmonics_mod_, 0.f, 1.f);
     float t = daisysp::fclamp(timbre_ + timbre_mod_, 0.f, 1.f);
@@ -137,68 +247,72 @@ void DaisyDrumVoice::Render(float* out, float* aux, size_t size) {
         default:
             break;
     }
+}
 
-    // Process sample-by-sample
-    for (size_t i = 0; i < size; ++i) {
-        bool trig = (i == 0) && should_trigger;
-        float sample = 0.f;
-
-        switch (engine_) {
-            case AnalogKick:
-                sample = static_cast<daisysp::AnalogBassDrum*>(analog_kick_)->Process(trig);
-                break;
-            case SyntheticKick:
-                sample = static_cast<daisysp::SyntheticBassDrum*>(synth_kick_)->Process(trig);
-                break;
-            case AnalogSnare:
-                sample = static_cast<daisysp::AnalogSnareDrum*>(analog_snare_)->Process(trig);
-                break;
-            case SyntheticSnare:
-                sample = static_cast<daisysp::SyntheticSnareDrum*>(synth_snare_)->Process(trig);
-                break;
-            case HiHat:
-                sample = static_cast<DaisyHiHat*>(hihat_)->Process(trig);
-                break;
-            default:
-                break;
-        }
-
-        // Apply level as output gain (accent alone is too subtle)
-        sample *= level_;
-
-        // Hard clamp to ±1.0 — saturation is handled by the master bus tanh
-        sample = std::max(-1.0f, std::min(1.0f, sample));
-
-        if (out) out[i] = sample;
-        if (aux) aux[i] = sample * 0.7f;
+float DaisyDrumVoice::ProcessEngine(bool trig) {
+    switch (engine_) {
+        case AnalogKick:
+            return static_cast<daisysp::AnalogBassDrum*>(analog_kick_)->Process(trig);
+        case SyntheticKick:
+            return static_cast<daisysp::SyntheticBassDrum*>(synth_kick_)->Process(trig);
+        case AnalogSnare:
+            return static_cast<daisysp::AnalogSnareDrum*>(analog_snare_)->Process(trig);
+        case SyntheticSnare:
+            return static_cast<daisysp::SyntheticSnareDrum*>(synth_snare_)->Process(trig);
+        case HiHat:
+            return static_cast<DaisyHiHat*>(hihat_)->Process(trig);
+        default:
+            return 0.f;
     }
+}
 
-    // Auto-clear trigger after processing
-    if (should_trigger) {
-        trigger_state_ = false;
+void DaisyDrumVoice::ReleaseHit(const DrumHit*& hit) {
+    if (hit && hit_cache_) {
+        hit_cache_->Release(hit);
     }
+    hit = nullptr;
+}
+
+void DaisyDrumVoice::SetHitCache(DrumHitCache* cache) {
+    ReleaseHit(hit_);
+    ReleaseHit(fade_hit_);
+    fade_remaining_ = 0;
+    hit_cache_ = cache;
+}
+
+bool DaisyDrumVoice::IsSilent() const {
+    // prev_trigger_ must be cleared by a render first, or the next rising edge is missed
+    return !trigger_state_ && !prev_trigger_ && silence_.IsSilent() && !hit_ && !fade_hit_;
 }
 
 void DaisyDrumVoice::SetEngine(int engine) {
-    if (engine >= 0 && engine < NumEngines) {
+    if (engine >= 0 && engine < NumEngines && engine != engine_) {
         engine_ = engine;
+        params_dirty_ = true;
     }
 }
 
 void DaisyDrumVoice::SetNote(float note) {
+    params_dirty_ |= note != note_;
     note_ = note;
 }
 
 void DaisyDrumVoice::SetHarmonics(float value) {
-    harmonics_ = daisysp::fclamp(value, 0.f, 1.f);
+    const float v = daisysp::fclamp(value, 0.f, 1.f);
+    params_dirty_ |= v != harmonics_;
+    harmonics_ = v;
 }
 
 void DaisyDrumVoice::SetTimbre(float value) {
-    timbre_ = daisysp::fclamp(value, 0.f, 1.f);
+    const float v = daisysp::fclamp(value, 0.f, 1.f);
+    params_dirty_ |= v != timbre_;
+    timbre_ = v;
 }
 
 void DaisyDrumVoice::SetMorph(float value) {
-    morph_ = daisysp::fclamp(value, 0.f, 1.f);
+    const float v = daisysp::fclamp(value, 0.f, 1.f);
+    params_dirty_ |= v != morph_;
+    morph_ = v;
 }
 
 void DaisyDrumVoice::Trigger(bool state) {
@@ -206,18 +320,23 @@ void DaisyDrumVoice::Trigger(bool state) {
 }
 
 void DaisyDrumVoice::SetLevel(float value) {
-    level_ = daisysp::fclamp(value, 0.f, 1.f);
+    const float v = daisysp::fclamp(value, 0.f, 1.f);
+    params_dirty_ |= v != level_;
+    level_ = v;
 }
 
 void DaisyDrumVoice::SetHarmonicsMod(float amount) {
+    params_dirty_ |= amount != harmonics_mod_;
     harmonics_mod_ = amount;
 }
 
 void DaisyDrumVoice::SetTimbreMod(float amount) {
+    params_dirty_ |= amount != timbre_mod_;
     timbre_mod_ = amount;
 }
 
 void DaisyDrumVoice::SetMorphMod(float amount) {
+    params_dirty_ |= amount != morph_mod_;
     morph_mod_ = amount;
 }
 
@@ -11,9 +11,15 @@
 #define DAISYDRUMVOICE_H
 
 #include <cstddef>
+#include <cstdint>
+
+#include "SilenceDetector.h"
 
 namespace Grainulator {
 
+class DrumHitCache;
+struct DrumHit;
+
 class DaisyDrumVoice {
 public:
     enum Engine {
@@ -28,12 +34,22 @@ class DaisyDrumVoice {
     DaisyDrumVoice();
     ~DaisyDrumVoice();
 
-    void Init(float sample_rate);
+    // Each voice has its own noise generators (seeded here), so voices can
+    // render on different threads without sharing rand()
+    void Init(float sample_rate, uint32_t noise_seed = 1);
 
     // Block-based render (matches PlaitsVoice signature)
     // aux can be nullptr; drums are mono, aux gets an attenuated copy
     void Render(float* out, float* aux, size_t size);
 
+    // True once no trigger is pending and the hit has decayed to silence
+    bool IsSilent() const;
+
+    // Unmodulated triggers play pre-rendered hits from the cache when it has
+    // them (nullptr = always synthesize). Render() must run on the cache's
+    // lane thread. Set to nullptr before the cache stops.
+    void SetHitCache(DrumHitCache* cache);
+
     // Engine selection (0–4)
     void SetEngine(int engine);
     int  GetEngine() const { return engine_; }
@@ -58,6 +74,12 @@ class DaisyDrumVoice {
     void SetMorphMod(float amount);
 
 private:
+    static constexpr int kDeclickFrames = 96;  // 2 ms @ 48kHz
+
+    void PushParameters();
+    float ProcessEngine(bool trig);
+    void ReleaseHit(const DrumHit*& hit);
+
     float sample_rate_;
     int   engine_;
     float note_;
@@ -66,6 +88,19 @@ class DaisyDrumVoice {
     float harmonics_mod_, timbre_mod_, morph_mod_;
     bool  trigger_state_;
     bool  prev_trigger_;
+    bool  params_dirty_;  // Engine setters only run after a parameter changes
+    SilenceDetector silence_;
+
+    // Cached playback. While a hit plays the engine is parked (not processed)
+    // after fading out whatever it was still sounding.
+    DrumHitCache* hit_cache_;
+    const DrumHit* hit_;
+    size_t hit_pos_;
+    const DrumHit* fade_hit_;  // Previous hit, fading out under the new one
+    size_t fade_pos_;
+    int   fade_remaining_;
+    bool  engine_parked_;
+    int   engine_fade_remaining_;
 
     // DaisySP engine instances (void* to avoid header leakage)
     void* analog_kick_;
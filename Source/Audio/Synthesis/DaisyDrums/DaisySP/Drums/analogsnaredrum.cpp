@@ -7,9 +7,10 @@ using namespace daisysp;
 
 static const int kNumModes = 5;
 
-void AnalogSnareDrum::Init(float sample_rate)
+void AnalogSnareDrum::Init(float sample_rate, uint32_t seed)
 {
     sample_rate_ = sample_rate;
+    rng_.Init(seed);
 
     trig_ = false;
 
@@ -183,7 +184,7 @@ float AnalogSnareDrum::Process(bool trigger)
     shell = SoftClip(shell);
 
     // C56 / R194 / Q48 / C54 / R188 / D54
-    float noise = 2.0f * rand() * kRandFrac - 1.0f;
+    float noise = 2.0f * rng_.Process() - 1.0f;
     if(noise < 0.0f)
         noise = 0.0f;
     noise_envelope_ *= noise_envelope_decay;
@@ -11,6 +11,7 @@ license that can be found in the LICENSE file or at
 #define DSY_ANALOG_SNARE_H
 
 #include "Filters/svf.h"
+#include "Utility/dsp.h"
 
 #include <stdint.h>
 #ifdef __cplusplus
@@ -37,8 +38,9 @@ class AnalogSnareDrum
 
     /** Init the module
         \param sample_rate Audio engine sample rate
+        \param seed Noise generator seed (Grainulator addition)
     */
-    void Init(float sample_rate);
+    void Init(float sample_rate, uint32_t seed = 1);
 
     /** Get the next sample
         \param trigger Hit the drum with true. Defaults to false.
@@ -97,6 +99,7 @@ class AnalogSnareDrum
 
     Svf resonator_[kNumModes];
     Svf noise_filter_;
+    NoiseRng rng_;
 
     // Replace the resonators in "free running" (sustain) mode.
     float phase_[kNumModes];
@@ -12,6 +12,7 @@ license that can be found in the LICENSE file or at
 
 #include "Filters/svf.h"
 #include "Synthesis/oscillator.h"
+#include "Utility/dsp.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -122,10 +123,12 @@ class HiHat
 
     /** Initialize the module
         \param sample_rate Audio engine sample rate
+        \param seed Noise generator seed (Grainulator addition)
     */
-    void Init(float sample_rate)
+    void Init(float sample_rate, uint32_t seed = 1)
     {
         sample_rate_ = sample_rate;
+        rng_.Init(seed);
 
         trig_ = false;
 
@@ -189,7 +192,7 @@ class HiHat
         if(noise_clock_ >= 1.0f)
         {
             noise_clock_ -= 1.0f;
-            noise_sample_ = rand() * kRandFrac - 0.5f;
+            noise_sample_ = rng_.Process() - 0.5f;
         }
         out += noisiness_ * (noise_sample_ - out);
 
@@ -271,6 +274,7 @@ class HiHat
     MetallicNoiseSource metallic_noise_;
     Svf                 noise_coloration_svf_;
     Svf                 hpf_;
+    NoiseRng            rng_;
 };
 } // namespace daisysp
 #endif
@@ -24,23 +24,25 @@ float SyntheticBassDrumClick::Process(float in)
     return filter_.Low();
 }
 
-void SyntheticBassDrumAttackNoise::Init()
+void SyntheticBassDrumAttackNoise::Init(uint32_t seed)
 {
+    rng_.Init(seed);
     lp_ = 0.0f;
     hp_ = 0.0f;
 }
 
 float SyntheticBassDrumAttackNoise::Process()
 {
-    float sample = rand() * kRandFrac;
+    float sample = rng_.Process();
     fonepole(lp_, sample, 0.05f);
     fonepole(hp_, lp_, 0.005f);
     return lp_ - hp_;
 }
 
-void SyntheticBassDrum::Init(float sample_rate)
+void SyntheticBassDrum::Init(float sample_rate, uint32_t seed)
 {
     sample_rate_ = sample_rate;
+    rng_.Init(seed);
 
     trig_ = false;
 
@@ -51,6 +53,8 @@ void SyntheticBassDrum::Init(float sample_rate)
     fm_lp_                = 0.0f;
     body_env_lp_          = 0.0f;
     body_env_             = 0.0f;
+    transient_env_        = 0.0f;
+    transient_env_lp_     = 0.0f;
     body_env_pulse_width_ = 0;
     fm_pulse_width_       = 0;
     tone_lp_              = 0.0f;
@@ -66,7 +70,7 @@ void SyntheticBassDrum::Init(float sample_rate)
     SetFmEnvelopeDecay(.3);
 
     click_.Init(sample_rate);
-    noise_.Init();
+    noise_.Init(seed ^ 0x9E3779B9u);
 }
 
 inline float SyntheticBassDrum::DistortedSine(float phase,
@@ -121,7 +125,7 @@ float SyntheticBassDrum::Process(bool trigger)
 
     sustain_gain_ = accent_ * decay_;
 
-    fonepole(phase_noise_, rand() * kRandFrac - 0.5f, 0.002f);
+    fonepole(phase_noise_, rng_.Process() - 0.5f, 0.002f);
 
     float mix = 0.0f;
 
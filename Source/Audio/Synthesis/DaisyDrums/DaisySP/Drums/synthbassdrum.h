@@ -64,8 +64,10 @@ class SyntheticBassDrumAttackNoise
     SyntheticBassDrumAttackNoise() {}
     ~SyntheticBassDrumAttackNoise() {}
 
-    /** Init the module */
-    void Init();
+    /** Init the module
+        \param seed Noise generator seed (Grainulator addition)
+    */
+    void Init(uint32_t seed = 1);
 
     /** Get the next sample. */
     float Process();
@@ -73,6 +75,7 @@ class SyntheticBassDrumAttackNoise
   private:
     float lp_;
     float hp_;
+    NoiseRng rng_;
 };
 
 /**  
@@ -92,8 +95,9 @@ class SyntheticBassDrum
 
     /** Init the module
         \param sample_rate Audio engine sample rate.
+        \param seed Noise generator seed (Grainulator addition)
     */
-    void Init(float sample_rate);
+    void Init(float sample_rate, uint32_t seed = 1);
 
     /** Generates a distorted sine wave */
     inline float DistortedSine(float phase, float phase_noise, float dirtiness);
@@ -177,6 +181,7 @@ class SyntheticBassDrum
 
     SyntheticBassDrumClick       click_;
     SyntheticBassDrumAttackNoise noise_;
+    NoiseRng                     rng_;
 
     int body_env_pulse_width_;
     int fm_pulse_width_;
@@ -5,9 +5,10 @@
 
 using namespace daisysp;
 
-void SyntheticSnareDrum::Init(float sample_rate)
+void SyntheticSnareDrum::Init(float sample_rate, uint32_t seed)
 {
     sample_rate_ = sample_rate;
+    rng_.Init(seed);
 
     phase_[0]        = 0.0f;
     phase_[1]        = 0.0f;
@@ -153,7 +154,7 @@ float SyntheticSnareDrum::Process(bool trigger)
     drum_lp_.Process(drum);
     drum = drum_lp_.Low();
 
-    float noise = rand() * kRandFrac;
+    float noise = rng_.Process();
     snare_lp_.Process(noise);
     float snare = snare_lp_.Low();
     snare_hp_.Process(snare);
@@ -11,6 +11,7 @@ license that can be found in the LICENSE file or at
 #define DSY_SYNTHSD_H
 
 #include "Filters/svf.h"
+#include "Utility/dsp.h"
 
 #include <stdint.h>
 #ifdef __cplusplus
@@ -39,8 +40,9 @@ class SyntheticSnareDrum
 
     /** Init the module
         \param sample_rate Audio engine sample rate
+        \param seed Noise generator seed (Grainulator addition)
     */
-    void Init(float sample_rate);
+    void Init(float sample_rate, uint32_t seed = 1);
 
     /** Get the next sample.
         \param trigger True = hit the drum. This argument is optional.
@@ -98,6 +100,7 @@ class SyntheticSnareDrum
 
     Svf drum_lp_;
     Svf snare_hp_;
+    NoiseRng rng_;
     Svf snare_lp_;
 };
 } // namespace daisysp
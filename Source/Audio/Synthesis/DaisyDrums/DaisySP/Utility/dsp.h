@@ -31,6 +31,27 @@ namespace daisysp
 //Avoids division for random floats. e.g. rand() * kRandFrac
 static constexpr float kRandFrac = 1.f / (float)RAND_MAX;
 
+/** Per-instance noise source used by the drum models in place of rand()
+    (Grainulator addition). rand() is one generator shared by every caller,
+    locked on some C libraries and racy on others, so models rendering on
+    different threads would disturb each other's noise. A 32-bit LCG;
+    Process() returns [0, 1).
+*/
+class NoiseRng
+{
+  public:
+    void Init(uint32_t seed) { state_ = seed; }
+
+    inline float Process()
+    {
+        state_ = state_ * 1664525u + 1013904223u;
+        return static_cast<float>(state_ >> 8) * (1.0f / 16777216.0f);
+    }
+
+  private:
+    uint32_t state_ = 1;
+};
+
 //Convert from semitones to other units. e.g. 2 ^ (kOneTwelfth * x)
 static constexpr float kOneTwelfth = 1.f / 12.f;
 
@@ -0,0 +1,302 @@
+//
+//  DrumHitCache.cpp
+//  Grainulator
+//
+//  Pre-rendered drum hit cache implementation
+//
+
+#include "DrumHitCache.h"
+#include "DaisyDrumVoice.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <xmmintrin.h>  // _MM_SET_FLUSH_ZERO_MODE
+#include <pmmintrin.h>  // _MM_SET_DENORMALS_ZERO_MODE
+#endif
+
+namespace Grainulator {
+
+namespace {
+
+constexpr size_t kRenderBlock = 256;
+constexpr float kTailThreshold = 1e-5f;  // SilenceDetector::kThreshold
+constexpr float kTruncateFadeSeconds = 0.01f;
+
+size_t hitBytes(const DrumHit* hit) {
+    return hit->length * sizeof(float);
+}
+
+} // namespace
+
+DrumHitCache::DrumHitCache()
+    : sample_rate_(48000.f)
+    , enabled_(true)
+    , bypassed_(false)
+    , budget_bytes_(kDefaultBudgetBytes)
+    , num_hits_(0)
+    , clock_(0)
+    , num_recent_misses_(0)
+    , next_recent_miss_(0)
+    , num_pending_(0)
+    , bytes_(0)
+    , num_hits_published_(0)
+    , hit_count_(0)
+    , miss_count_(0)
+    , running_(false)
+    , retired_(nullptr)
+{
+    std::fill(hits_, hits_ + kMaxHits, nullptr);
+}
+
+DrumHitCache::~DrumHitCache() {
+    Stop();
+}
+
+void DrumHitCache::Start(float sample_rate) {
+    if (running_.load(std::memory_order_acquire)) return;
+
+    sample_rate_ = sample_rate;
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread([this]() { RenderLoop(); });
+}
+
+void DrumHitCache::Stop() {
+    if (running_.load(std::memory_order_acquire)) {
+        running_.store(false, std::memory_order_release);
+        wake_.post();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    DrumHit* hit = nullptr;
+    while (finished_.pop(hit)) delete hit;
+    FreeRetired();
+    DrumHitKey key;
+    while (requests_.pop(key)) {}
+    for (int i = 0; i < num_hits_; ++i) {
+        delete hits_[i];
+        hits_[i] = nullptr;
+    }
+    num_hits_ = 0;
+    num_pending_ = 0;
+    num_recent_misses_ = 0;
+    next_recent_miss_ = 0;
+    bytes_.store(0, std::memory_order_relaxed);
+    num_hits_published_.store(0, std::memory_order_relaxed);
+}
+
+// ========== Lane thread ==========
+
+void DrumHitCache::Update() {
+    bool retired = false;
+
+    DrumHit* hit = nullptr;
+    while (finished_.pop(hit)) {
+        RemovePending(hit->key);
+        if (num_hits_ == kMaxHits && !Evict()) {
+            // Every slot is playing: drop the newcomer
+            Retire(hit);
+            retired = true;
+            continue;
+        }
+        hit->last_used = clock_;
+        hits_[num_hits_++] = hit;
+        bytes_.fetch_add(hitBytes(hit), std::memory_order_relaxed);
+    }
+
+    const size_t budget = IsEnabled() ? budget_bytes_.load(std::memory_order_relaxed) : 0;
+    while (bytes_.load(std::memory_order_relaxed) > budget) {
+        if (!Evict()) break;
+        retired = true;
+    }
+
+    num_hits_published_.store(num_hits_, std::memory_order_relaxed);
+    if (retired) {
+        wake_.post();
+    }
+}
+
+bool DrumHitCache::Evict() {
+    int victim = -1;
+    for (int i = 0; i < num_hits_; ++i) {
+        if (hits_[i]->users > 0) continue;
+        if (victim < 0 || hits_[i]->last_used < hits_[victim]->last_used) {
+            victim = i;
+        }
+    }
+    if (victim < 0) return false;
+
+    DrumHit* hit = hits_[victim];
+    Retire(hit);
+
+    bytes_.fetch_sub(hitBytes(hit), std::memory_order_relaxed);
+    hits_[victim] = hits_[--num_hits_];
+    hits_[num_hits_] = nullptr;
+    return true;
+}
+
+void DrumHitCache::Retire(DrumHit* hit) {
+    // Lock-free push; the renderer takes the whole list at once, so there is no ABA
+    DrumHit* head = retired_.load(std::memory_order_relaxed);
+    do {
+        hit->next_retired = head;
+    } while (!retired_.compare_exchange_weak(head, hit, std::memory_order_release,
+                                             std::memory_order_relaxed));
+}
+
+const DrumHit* DrumHitCache::Acquire(const DrumHitKey& key) {
+    if (!IsEnabled() || bypassed_.load(std::memory_order_relaxed)) return nullptr;
+
+    ++clock_;
+    for (int i = 0; i < num_hits_; ++i) {
+        DrumHit* hit = hits_[i];
+        if (hit->key == key) {
+            hit->last_used = clock_;
+            ++hit->users;
+            hit_count_.fetch_add(1, std::memory_order_relaxed);
+            return hit;
+        }
+    }
+    miss_count_.fetch_add(1, std::memory_order_relaxed);
+
+    if (IsPending(key)) return nullptr;
+
+    // Admit a key on its second miss; one-off parameter sets stay live
+    bool seen = false;
+    for (int i = 0; i < num_recent_misses_; ++i) {
+        if (recent_misses_[i] == key) {
+            seen = true;
+            break;
+        }
+    }
+    if (!seen) {
+        recent_misses_[next_recent_miss_] = key;
+        next_recent_miss_ = (next_recent_miss_ + 1) % kRecentMisses;
+        num_recent_misses_ = std::min(num_recent_misses_ + 1, kRecentMisses);
+        return nullptr;
+    }
+
+    if (num_pending_ < kMaxPending && running_.load(std::memory_order_relaxed)
+        && requests_.push(key)) {
+        pending_[num_pending_++] = key;
+        wake_.post();
+    }
+    return nullptr;
+}
+
+void DrumHitCache::Release(const DrumHit* hit) {
+    if (!hit) return;
+    // Only this thread touches users; the hit itself is never const in the table
+    --const_cast<DrumHit*>(hit)->users;
+}
+
+bool DrumHitCache::IsPending(const DrumHitKey& key) const {
+    for (int i = 0; i < num_pending_; ++i) {
+        if (pending_[i] == key) return true;
+    }
+    return false;
+}
+
+void DrumHitCache::RemovePending(const DrumHitKey& key) {
+    for (int i = 0; i < num_pending_; ++i) {
+        if (pending_[i] == key) {
+            pending_[i] = pending_[--num_pending_];
+            return;
+        }
+    }
+}
+
+// ========== Renderer ==========
+
+void DrumHitCache::RenderLoop() {
+    // Same denormal handling as the audio thread, so a cached hit matches a live one
+#if defined(__x86_64__) || defined(__i386__)
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+#if defined(__APPLE__)
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+#endif
+
+    for (;;) {
+        wake_.wait();
+        if (!running_.load(std::memory_order_acquire)) return;
+
+        FreeRetired();
+
+        DrumHitKey key;
+        while (requests_.pop(key)) {
+            if (!running_.load(std::memory_order_acquire)) return;
+            DrumHit* hit = Render(key);
+            // Sized so it cannot fill (one slot per pending key), but never leak
+            if (!finished_.push(hit)) delete hit;
+        }
+    }
+}
+
+void DrumHitCache::FreeRetired() {
+    DrumHit* hit = retired_.exchange(nullptr, std::memory_order_acquire);
+    while (hit) {
+        DrumHit* next = hit->next_retired;
+        delete hit;
+        hit = next;
+    }
+}
+
+DrumHit* DrumHitCache::Render(const DrumHitKey& key) {
+    // Fresh voice per hit: the cached buffer starts from the model's reset state.
+    // Its noise generators are its own, so this thread never touches the lanes'.
+    DaisyDrumVoice voice;
+    voice.Init(sample_rate_);
+    voice.SetEngine(key.engine);
+    voice.SetNote(key.note);
+    voice.SetHarmonics(key.harmonics);
+    voice.SetTimbre(key.timbre);
+    voice.SetMorph(key.morph);
+    voice.SetLevel(key.level);
+    voice.Trigger(true);
+
+    const size_t maxLength = static_cast<size_t>(sample_rate_ * kMaxHitSeconds);
+    std::vector<float> buffer;
+    buffer.reserve(maxLength + kRenderBlock);
+    do {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + kRenderBlock);
+        voice.Render(buffer.data() + offset, nullptr, kRenderBlock);
+    } while (!voice.IsSilent() && buffer.size() < maxLength);
+
+    // The silence detector holds before reporting; drop the inaudible tail
+    size_t length = std::min(buffer.size(), maxLength);
+    while (length > 0 && std::fabs(buffer[length - 1]) <= kTailThreshold) {
+        --length;
+    }
+
+    // Some models never decay to silence (the analog snare keeps a noise
+    // floor): end a hit cut at the length limit with a short fade
+    if (length == maxLength) {
+        const size_t fade = std::min(length, static_cast<size_t>(sample_rate_ * kTruncateFadeSeconds));
+        for (size_t i = 0; i < fade; ++i) {
+            buffer[length - 1 - i] *= static_cast<float>(i) / static_cast<float>(fade);
+        }
+    }
+
+    auto* hit = new DrumHit();
+    hit->key = key;
+    hit->length = length;
+    hit->samples.reset(new float[std::max<size_t>(length, 1)]);
+    std::copy(buffer.begin(), buffer.begin() + length, hit->samples.get());
+    hit->last_used = 0;
+    hit->users = 0;
+    hit->next_retired = nullptr;
+    return hit;
+}
+
+} // namespace Grainulator
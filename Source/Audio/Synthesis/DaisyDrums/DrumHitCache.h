@@ -0,0 +1,154 @@
+//
+//  DrumHitCache.h
+//  Grainulator
+//
+//  Pre-rendered one-shot drum hits for the drum sequencer lanes. A hit is
+//  identified by everything that shapes it (engine, note, harmonics, timbre,
+//  morph and level, which carries velocity); a trigger whose key has been
+//  rendered plays the cached buffer instead of running the DaisySP model.
+//
+//  Misses are rendered on a background thread. A key is only queued on its
+//  second miss, so parameters that move between hits (a knob being swept)
+//  stay on live synthesis instead of filling the cache with one-off hits.
+//  Memory is bounded by a byte budget; the least recently used hits not
+//  currently playing are evicted first.
+//
+//  Threading: Update(), Acquire() and Release() belong to the thread that
+//  renders the drum lanes (the audio thread or the worker running the drum
+//  job) and never block, allocate or free. Finished renders reach that thread
+//  through a lock-free queue; evicted hits go back to the renderer on an
+//  intrusive list, which cannot fill, so a hit is never freed on the lane thread.
+//
+
+#ifndef DRUMHITCACHE_H
+#define DRUMHITCACHE_H
+
+#include "MpscQueue.h"
+#include "WakeSemaphore.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace Grainulator {
+
+struct DrumHitKey {
+    int engine;
+    float note;
+    float harmonics;
+    float timbre;
+    float morph;
+    float level;
+
+    bool operator==(const DrumHitKey& other) const {
+        return engine == other.engine && note == other.note && harmonics == other.harmonics
+            && timbre == other.timbre && morph == other.morph && level == other.level;
+    }
+};
+
+/// One rendered hit: the voice's output from the trigger until it fell silent
+struct DrumHit {
+    DrumHitKey key;
+    std::unique_ptr<float[]> samples;
+    size_t length;
+
+    // Owned by the lane thread
+    uint64_t last_used;
+    int users;  // Voices playing or fading this hit
+
+    DrumHit* next_retired;  // Link in the retire list once evicted
+};
+
+class DrumHitCache {
+public:
+    static constexpr size_t kDefaultBudgetBytes = 8u << 20;
+    static constexpr int kMaxHits = 128;
+    static constexpr float kMaxHitSeconds = 2.0f;  // Longer hits are faded out
+
+    DrumHitCache();
+    ~DrumHitCache();
+
+    /// Spawns the renderer thread. Not real-time safe.
+    void Start(float sample_rate);
+    /// Joins the renderer and frees every hit. No voice may still hold one.
+    void Stop();
+
+    /// Off: Acquire() always misses and unused hits are freed on Update().
+    /// Safe from any thread.
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Bypassed: Acquire() misses without queuing renders, and cached hits are
+    /// kept for later. Offline renders bypass the cache so their output does
+    /// not depend on background timing. Safe from any thread.
+    void SetBypassed(bool bypassed) { bypassed_.store(bypassed, std::memory_order_relaxed); }
+
+    /// Safe from any thread; takes effect on the next Update()
+    void SetBudgetBytes(size_t bytes) { budget_bytes_.store(bytes, std::memory_order_relaxed); }
+
+    // ---- Lane thread ----
+
+    /// Adopts finished renders and evicts down to the budget. Call once per block.
+    void Update();
+
+    /// The cached hit for key, retained for the caller, or null on a miss
+    /// (which may queue the key for rendering). Pair with Release().
+    const DrumHit* Acquire(const DrumHitKey& key);
+    void Release(const DrumHit* hit);
+
+    // ---- Statistics (any thread) ----
+
+    size_t GetBytes() const { return bytes_.load(std::memory_order_relaxed); }
+    int GetNumHits() const { return num_hits_published_.load(std::memory_order_relaxed); }
+    uint32_t GetHitCount() const { return hit_count_.load(std::memory_order_relaxed); }
+    uint32_t GetMissCount() const { return miss_count_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int kRecentMisses = 32;
+    static constexpr int kMaxPending = 16;
+
+    void RenderLoop();
+    DrumHit* Render(const DrumHitKey& key);
+    bool Evict();  // Least recently used hit nobody is playing
+    void Retire(DrumHit* hit);  // Hands a hit to the renderer to free
+    void FreeRetired();
+    bool IsPending(const DrumHitKey& key) const;
+    void RemovePending(const DrumHitKey& key);
+
+    float sample_rate_;
+    std::atomic<bool> enabled_;
+    std::atomic<bool> bypassed_;
+    std::atomic<size_t> budget_bytes_;
+
+    // Lane-thread index
+    DrumHit* hits_[kMaxHits];
+    int num_hits_;
+    uint64_t clock_;
+    DrumHitKey recent_misses_[kRecentMisses];
+    int num_recent_misses_;
+    int next_recent_miss_;
+    DrumHitKey pending_[kMaxPending];
+    int num_pending_;
+
+    std::atomic<size_t> bytes_;
+    std::atomic<int> num_hits_published_;
+    std::atomic<uint32_t> hit_count_;
+    std::atomic<uint32_t> miss_count_;
+
+    // Renderer
+    std::thread thread_;
+    std::atomic<bool> running_;
+    WakeSemaphore wake_;
+    MpscQueue<DrumHitKey, kMaxPending> requests_;
+    MpscQueue<DrumHit*, kMaxPending> finished_;
+    std::atomic<DrumHit*> retired_;  // Intrusive list head, linked by next_retired
+
+    DrumHitCache(const DrumHitCache&) = delete;
+    DrumHitCache& operator=(const DrumHitCache&) = delete;
+};
+
+} // namespace Grainulator
+
+#endif // DRUMHITCACHE_H
@@ -2,13 +2,14 @@
 //  Grain.h
 //  Grainulator
 //
-//  Individual grain for granular synthesis
-//  Handles playback, windowing, and pitch shifting
+//  Grain envelopes and grain pool for granular synthesis
+//  Handles windowing and per-grain playback state
 //
 
 #ifndef GRAIN_H
 #define GRAIN_H
 
+#include "FastMath.h"
 #include <cmath>
 #include <cstdint>
 #include <cstddef>
@@ -203,135 +204,146 @@ class WindowTable {
     }
 };
 
-/// Individual grain state
-struct Grain {
-    // Playback state
-    bool active;                // Is this grain currently playing?
-    float position;             // Current read position in source buffer (samples)
-    float position_start;       // Starting position in buffer
-    float phase;                // Current phase within grain envelope (0.0 to 1.0)
-
-    // Grain parameters
-    float duration_samples;     // Total duration of grain in samples
-    float speed;                // Playback speed (1.0 = normal, 0.5 = half, 2.0 = double)
-    float pitch_ratio;          // Additional pitch shift (1.0 = no shift)
-    float amplitude;            // Grain amplitude (0.0 to 1.0)
-    float pan;                  // Stereo position (-1.0 = left, 0.0 = center, 1.0 = right)
-
-    // Envelope
-    WindowType window_type;
-    float decay_rate;           // Decay rate for pluck/decay envelopes (1.0 - 10.0)
-
-    // Source reference
-    size_t buffer_index;        // Which reel buffer to read from
-    size_t splice_index;        // Which splice within the reel
-
-    Grain()
-        : active(false)
-        , position(0.0f)
-        , position_start(0.0f)
-        , phase(0.0f)
-        , duration_samples(4800.0f)  // 100ms @ 48kHz
-        , speed(1.0f)
-        , pitch_ratio(1.0f)
-        , amplitude(1.0f)
-        , pan(0.0f)
-        , window_type(WindowType::Hanning)
-        , decay_rate(5.0f)
-        , buffer_index(0)
-        , splice_index(0)
-    {}
-
-    /// Reset grain to initial state
-    void Reset() {
-        active = false;
-        position = 0.0f;
-        position_start = 0.0f;
-        phase = 0.0f;
+/// Grain envelope at a normalized phase (0.0 to 1.0).
+/// Decay shapes are computed on the fly so each grain can use its own decay rate;
+/// the rest come from the pre-computed window tables.
+inline float GrainEnvelope(WindowType type, float phase, float decay_rate) {
+    switch (type) {
+        case WindowType::Pluck: {
+            // Pluck: brief attack, then exponential decay
+            const float attack = 0.05f;
+            if (phase < attack) {
+                return phase / attack;
+            }
+            float decay_x = (phase - attack) / (1.0f - attack);
+            return fastmath::exp(-decay_rate * decay_x);
+        }
+        case WindowType::PluckSoft: {
+            // Softer pluck: longer attack, slower decay
+            const float attack = 0.10f;
+            if (phase < attack) {
+                float attack_phase = phase / attack;
+                return 0.5f * (1.0f - fastmath::cos(3.14159265f * attack_phase));
+            }
+            float decay_x = (phase - attack) / (1.0f - attack);
+            return fastmath::exp(-decay_rate * 0.6f * decay_x);  // Slower than pluck
+        }
+        case WindowType::ExpDecay:
+            // Pure exponential decay
+            return fastmath::exp(-decay_rate * 0.8f * phase);
+        default:
+            return WindowTable::Instance().Get(type, phase);
     }
+}
 
-    /// Start a new grain
-    void Start(float start_position, float duration, float playback_speed, float pitch) {
-        active = true;
-        position = start_position;
-        position_start = start_position;
-        phase = 0.0f;
-        duration_samples = duration;
-        speed = playback_speed;
-        pitch_ratio = pitch;
-    }
+/// Structure-of-arrays grain pool.
+///
+/// Per-grain state lives in parallel arrays indexed by slot. Playing grains are
+/// listed densely in `active` (in spawn order) and idle slots sit on a free-list
+/// stack, so spawning is O(1) and rendering only visits grains that are playing.
+template <size_t Capacity>
+struct GrainPool {
+    static_assert(Capacity > 0 && Capacity <= 65535, "Grain slots are indexed with uint16_t");
+
+    static constexpr uint16_t kNoSlot = 0xFFFF;
 
-    /// Advance the grain by one sample
-    /// Returns true if grain is still active, false if finished
-    bool Advance(float sample_rate) {
-        if (!active) return false;
+    // Playback state
+    float position[Capacity];         // Read position in source buffer (samples)
+    float phase[Capacity];            // Phase within grain envelope (0.0 to 1.0)
+    float phase_increment[Capacity];  // 1 / duration in samples
+    float pitch_ratio[Capacity];      // Read increment per sample (negative = reverse)
 
-        // Advance position by speed * pitch_ratio
-        position += speed * pitch_ratio;
+    // Envelope and output
+    float amplitude[Capacity];
+    float pan_left[Capacity];         // Equal-power pan gains, computed at spawn
+    float pan_right[Capacity];
+    float decay_rate[Capacity];       // Decay rate for pluck/decay envelopes (1.0 - 10.0)
+    WindowType window_type[Capacity];
 
-        // Advance envelope phase
-        float phase_increment = 1.0f / duration_samples;
-        phase += phase_increment;
+    GrainPool() { Reset(); }
 
-        // Check if grain is complete
-        if (phase >= 1.0f) {
-            active = false;
-            return false;
+    /// Release every grain
+    void Reset() {
+        num_active_ = 0;
+        num_free_ = Capacity;
+        for (size_t i = 0; i < Capacity; ++i) {
+            // Stack top is slot 0
+            free_[i] = static_cast<uint16_t>(Capacity - 1 - i);
+            position[i] = 0.0f;
+            phase[i] = 0.0f;
+            phase_increment[i] = 0.0f;
+            pitch_ratio[i] = 1.0f;
+            amplitude[i] = 1.0f;
+            pan_left[i] = 1.0f;
+            pan_right[i] = 0.0f;
+            decay_rate[i] = 5.0f;
+            window_type[i] = WindowType::Hanning;
         }
+    }
+
+    size_t NumActive() const { return num_active_; }
 
-        return true;
+    /// Take a free slot and append it to the active list. Returns kNoSlot when full.
+    uint16_t Acquire() {
+        if (num_free_ == 0) return kNoSlot;
+        const uint16_t slot = free_[--num_free_];
+        active_[num_active_++] = slot;
+        return slot;
     }
 
-    /// Get the current envelope amplitude
-    float GetEnvelopeAmplitude() const {
-        float env;
-
-        // For decay-based envelopes, compute on the fly with adjustable decay rate
-        switch (window_type) {
-            case WindowType::Pluck: {
-                // Pluck: brief attack, then exponential decay
-                const float attack = 0.05f;
-                if (phase < attack) {
-                    env = phase / attack;
-                } else {
-                    float decay_x = (phase - attack) / (1.0f - attack);
-                    env = std::exp(-decay_rate * decay_x);
-                }
-                break;
+    /// Active grain furthest through its envelope (stays active; the caller restarts it).
+    /// Returns kNoSlot if no grain has advanced yet.
+    uint16_t Oldest() const {
+        uint16_t slot = kNoSlot;
+        float oldest_phase = 0.0f;
+        for (size_t k = 0; k < num_active_; ++k) {
+            const uint16_t candidate = active_[k];
+            if (phase[candidate] > oldest_phase) {
+                oldest_phase = phase[candidate];
+                slot = candidate;
             }
-            case WindowType::PluckSoft: {
-                // Softer pluck: longer attack, slower decay
-                const float attack = 0.10f;
-                if (phase < attack) {
-                    float attack_phase = phase / attack;
-                    env = 0.5f * (1.0f - std::cos(3.14159265f * attack_phase));
-                } else {
-                    float decay_x = (phase - attack) / (1.0f - attack);
-                    env = std::exp(-decay_rate * 0.6f * decay_x);  // Slower than pluck
-                }
-                break;
-            }
-            case WindowType::ExpDecay: {
-                // Pure exponential decay
-                env = std::exp(-decay_rate * 0.8f * phase);
-                break;
-            }
-            default:
-                // Use pre-computed table for non-decay envelopes
-                env = WindowTable::Instance().Get(window_type, phase);
-                break;
         }
-
-        return env * amplitude;
+        return slot;
     }
 
-    /// Get stereo gains (left, right)
-    void GetPanGains(float& left, float& right) const {
+    /// Start a grain in an acquired (or stolen) slot
+    void Start(uint16_t slot, float start_position, float duration_samples, float pitch,
+               float pan, WindowType window, float decay) {
+        position[slot] = start_position;
+        phase[slot] = 0.0f;
+        phase_increment[slot] = 1.0f / duration_samples;
+        pitch_ratio[slot] = pitch;
+        amplitude[slot] = 1.0f;
+        window_type[slot] = window;
+        decay_rate[slot] = decay;
+
         // Equal power panning
-        float angle = (pan + 1.0f) * 0.25f * 3.14159265f;  // 0 to pi/2
-        left = std::cos(angle);
-        right = std::sin(angle);
+        const float angle = (pan + 1.0f) * 0.25f * 3.14159265f;  // 0 to pi/2
+        pan_left[slot] = fastmath::cos(angle);
+        pan_right[slot] = fastmath::sin(angle);
     }
+
+    /// Calls fn(slot) for each active grain in order. Grains for which fn returns
+    /// false have finished and go back on the free list; the rest keep their order.
+    template <typename Fn>
+    void Update(Fn&& fn) {
+        size_t kept = 0;
+        for (size_t k = 0; k < num_active_; ++k) {
+            const uint16_t slot = active_[k];
+            if (fn(slot)) {
+                active_[kept++] = slot;
+            } else {
+                free_[num_free_++] = slot;
+            }
+        }
+        num_active_ = kept;
+    }
+
+private:
+    uint16_t active_[Capacity];
+    uint16_t free_[Capacity];
+    size_t num_active_;
+    size_t num_free_;
 };
 
 } // namespace Grainulator
@@ -11,17 +11,8 @@
 
 #include "ReelBuffer.h"
 #include "Grain.h"
-#include "MoogLadders/LadderFilterBase.h"
-#include "MoogLadders/StilsonModel.h"
-#include "MoogLadders/MicrotrackerModel.h"
-#include "MoogLadders/KrajeskiModel.h"
-#include "MoogLadders/MusicDSPModel.h"
-#include "MoogLadders/OberheimVariationModel.h"
-#include "MoogLadders/ImprovedModel.h"
-#include "MoogLadders/RKSimulationModel.h"
-#include "MoogLadders/HyperionModel.h"
-#include "MoogLadders/DaisyLadderModel.h"
-#include "MoogLadders/CytomicSvfModel.h"
+#include "SilenceDetector.h"
+#include "MoogLadders/LadderFilterBank.h"
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -96,13 +87,8 @@ class GranularVoice {
         , gate_(false)
         , grain_timer_(0.0f)
         , grain_interval_(0.0f)
-        , num_active_grains_(0)
         , envelope_level_(0.0f)
     {
-        // Initialize all grains as inactive
-        for (size_t i = 0; i < kMaxGrainsPerVoice; ++i) {
-            grains_[i].Reset();
-        }
         CalculateGrainInterval();
         CreateFilterInstances();
         UpdateFilterParameters();
@@ -111,6 +97,7 @@ class GranularVoice {
     void Init(float sample_rate) {
         sample_rate_ = sample_rate;
         grain_timer_ = 0.0f;
+        silence_.Init(sample_rate);
         CalculateGrainInterval();
         CreateFilterInstances();
         UpdateFilterParameters();
@@ -121,6 +108,7 @@ class GranularVoice {
     void SetBuffer(ReelBuffer* buffer) {
         buffer_ = buffer;
         position_ = 0.0f;
+        silence_.Wake();
     }
 
     ReelBuffer* GetBuffer() const { return buffer_; }
@@ -224,11 +212,11 @@ class GranularVoice {
     }
     float GetQ() const { return q_; }
 
-    /// FILTER MODEL: Select which Moog ladder implementation to use.
+    /// FILTER MODEL: Select which Moog ladder implementation to use. Real-time
+    /// safe: every model is pre-built and the change crossfades.
     void SetFilterModel(FilterModel model) {
         filter_model_ = model;
-        CreateFilterInstances();
-        UpdateFilterParameters();
+        if (filter_) filter_->SetModel(static_cast<int>(model));
     }
 
     void SetFilterModelIndex(int index) {
@@ -293,7 +281,7 @@ class GranularVoice {
     float GetEffectivePitch() const {
         // Modulation adds ±1 octave (±12 semitones)
         float mod_semitones = pitch_mod_ * 12.0f;
-        float mod_ratio = std::pow(2.0f, mod_semitones / 12.0f);
+        float mod_ratio = fastmath::exp2(mod_semitones / 12.0f);
         return std::max(0.25f, std::min(4.0f, pitch_ * mod_ratio));
     }
 
@@ -315,7 +303,7 @@ class GranularVoice {
     float GetEffectiveCutoff() const {
         // Modulation adds ±4 octaves to cutoff
         float mod_octaves = filter_mod_ * 4.0f;
-        float mod_ratio = std::pow(2.0f, mod_octaves);
+        float mod_ratio = fastmath::exp2(mod_octaves);
         return std::max(20.0f, std::min(20000.0f, cutoff_ * mod_ratio));
     }
 
@@ -395,24 +383,25 @@ class GranularVoice {
                 out_left[i] = 0.0f;
                 out_right[i] = 0.0f;
             }
+            silence_.ProcessPeak(0.0f, num_frames);
             return;
         }
 
         float buffer_length = static_cast<float>(buffer_->GetLength());
         float buffer_duration = buffer_length / sample_rate_;
 
-        // Calculate envelope coefficient for gate on/off (ASR envelope like MGlut)
-        float env_coef = 1.0f - std::exp(-1.0f / (envscale_ * sample_rate_));
-
-        for (size_t i = 0; i < num_frames; ++i) {
-            // Update voice envelope based on gate state
-            float env_target = gate_ ? 1.0f : 0.0f;
-            envelope_level_ += env_coef * (env_target - envelope_level_);
+        // Modulated values are fixed for the duration of a render call
+        const float effective_speed = GetEffectiveSpeed();
+        const float effective_density = GetEffectiveDensity();
 
-            // Get effective modulated values
-            float effective_speed = GetEffectiveSpeed();
-            float effective_density = GetEffectiveDensity();
+        // Grains accumulate grain-major straight into the output buffers, one
+        // segment at a time. Segments end where a new grain spawns, so spawning
+        // (and stealing) sees every grain exactly as it would sample by sample.
+        std::fill(out_left, out_left + num_frames, 0.0f);
+        std::fill(out_right, out_right + num_frames, 0.0f);
+        size_t segment_start = 0;
 
+        for (size_t i = 0; i < num_frames; ++i) {
             // Advance phasor position (like SC's Phasor.kr)
             // Rate = speed / buffer_duration (so at speed=1, takes buf_dur to go 0→1)
             if (!freeze_ && gate_) {
@@ -441,104 +430,48 @@ class GranularVoice {
             if (gate_ && effective_density > 0.0f) {
                 grain_timer_ += 1.0f;
                 if (grain_timer_ >= mod_grain_interval) {
+                    RenderGrains(out_left, out_right, segment_start, i, buffer_length);
+                    segment_start = i;
                     SpawnGrain();
                     grain_timer_ = 0.0f;
                 }
             }
+        }
+        RenderGrains(out_left, out_right, segment_start, num_frames, buffer_length);
 
-            // Render all active grains
-            float sample_l = 0.0f;
-            float sample_r = 0.0f;
-            num_active_grains_ = 0;
-
-            for (size_t g = 0; g < kMaxGrainsPerVoice; ++g) {
-                Grain& grain = grains_[g];
-                if (!grain.active) continue;
-
-                num_active_grains_++;
-
-                // Get grain envelope amplitude (Hanning window)
-                float env = grain.GetEnvelopeAmplitude();
-
-                // Read from buffer at grain's current position
-                // Position wraps within buffer
-                float read_pos = std::fmod(grain.position, buffer_length);
-                if (read_pos < 0.0f) read_pos += buffer_length;
-
-                // 4-point Hermite interpolation for quality pitched playback
-                size_t idx0 = static_cast<size_t>(read_pos);
-                size_t buf_len = static_cast<size_t>(buffer_length);
-                size_t idx_m1 = (idx0 > 0) ? idx0 - 1 : buf_len - 1;
-                size_t idx1 = (idx0 + 1) % buf_len;
-                size_t idx2 = (idx0 + 2) % buf_len;
-                float frac = read_pos - static_cast<float>(idx0);
-
-                // Hermite cubic for left channel
-                float y0L = buffer_->GetSampleInt(0, idx_m1);
-                float y1L = buffer_->GetSampleInt(0, idx0);
-                float y2L = buffer_->GetSampleInt(0, idx1);
-                float y3L = buffer_->GetSampleInt(0, idx2);
-                float c0L = y1L;
-                float c1L = 0.5f * (y2L - y0L);
-                float c2L = y0L - 2.5f * y1L + 2.0f * y2L - 0.5f * y3L;
-                float c3L = 0.5f * (y3L - y0L) + 1.5f * (y1L - y2L);
-                float samp_l = ((c3L * frac + c2L) * frac + c1L) * frac + c0L;
-
-                // Hermite cubic for right channel
-                float y0R = buffer_->GetSampleInt(1, idx_m1);
-                float y1R = buffer_->GetSampleInt(1, idx0);
-                float y2R = buffer_->GetSampleInt(1, idx1);
-                float y3R = buffer_->GetSampleInt(1, idx2);
-                float c0R = y1R;
-                float c1R = 0.5f * (y2R - y0R);
-                float c2R = y0R - 2.5f * y1R + 2.0f * y2R - 0.5f * y3R;
-                float c3R = 0.5f * (y3R - y0R) + 1.5f * (y1R - y2R);
-                float samp_r = ((c3R * frac + c2R) * frac + c1R) * frac + c0R;
-
-                // Apply grain envelope
-                samp_l *= env;
-                samp_r *= env;
-
-                // Apply pan (equal power)
-                float pan_l, pan_r;
-                grain.GetPanGains(pan_l, pan_r);
-                sample_l += samp_l * pan_l;
-                sample_r += samp_r * pan_r;
-
-                // Advance grain playback position by pitch rate
-                // This is how GrainBuf works - pitch affects playback rate within grain
-                grain.position += grain.pitch_ratio;
-                if (grain.position >= buffer_length || grain.position < 0.0f) {
-                    grain.position = std::fmod(grain.position, buffer_length);
-                    if (grain.position < 0.0f) grain.position += buffer_length;
-                }
-
-                // Advance grain envelope phase
-                grain.phase += 1.0f / grain.duration_samples;
-                if (grain.phase >= 1.0f) {
-                    grain.active = false;
-                }
-            }
+        // Calculate envelope coefficient for gate on/off (ASR envelope like MGlut)
+        float env_coef = 1.0f - std::exp(-1.0f / (envscale_ * sample_rate_));
+        float effective_cutoff = GetEffectiveCutoff();
 
-            // Apply voice envelope
-            sample_l *= envelope_level_;
-            sample_r *= envelope_level_;
+        for (size_t i = 0; i < num_frames; ++i) {
+            // Update voice envelope based on gate state
+            float env_target = gate_ ? 1.0f : 0.0f;
+            envelope_level_ += env_coef * (env_target - envelope_level_);
 
-            // Apply gain
-            sample_l *= gain_;
-            sample_r *= gain_;
+            // Apply voice envelope and gain, bounded for the filter
+            const float level = envelope_level_ * gain_;
+            out_left[i] = std::max(-8.0f, std::min(8.0f, out_left[i] * level));
+            out_right[i] = std::max(-8.0f, std::min(8.0f, out_right[i] * level));
+        }
 
-            // Apply 4-pole Moog-style ladder low-pass filter with modulation
-            float effective_cutoff = GetEffectiveCutoff();
-            ApplyFilterWithCutoff(sample_l, sample_r, effective_cutoff);
+        // Apply 4-pole Moog-style ladder low-pass filter with modulation
+        ApplyFilterBlock(out_left, out_right, num_frames, effective_cutoff);
 
-            // Soft clip output
-            out_left[i] = std::tanh(sample_l);
-            out_right[i] = std::tanh(sample_r);
+        // Soft clip output
+        for (size_t i = 0; i < num_frames; ++i) {
+            out_left[i] = fastmath::tanh(out_left[i]);
+            out_right[i] = fastmath::tanh(out_right[i]);
         }
+        silence_.Process(out_left, out_right, num_frames);
     }
 
-    size_t GetNumActiveGrains() const { return num_active_grains_; }
+    /// True once the gate is off, every grain has finished and the filter
+    /// tail has decayed; Render() may be skipped until the gate opens.
+    bool IsSilent() const {
+        return !gate_ && grains_.NumActive() == 0 && silence_.IsSilent();
+    }
+
+    size_t GetNumActiveGrains() const { return grains_.NumActive(); }
 
     // ========== Legacy compatibility methods ==========
     void SetSlide(float value) { SetPosition(value); }
@@ -593,14 +526,13 @@ class GranularVoice {
     float grain_timer_;
     float grain_interval_;
     float envelope_level_;
+    SilenceDetector silence_;
 
     // Grain pool
-    Grain grains_[kMaxGrainsPerVoice];
-    size_t num_active_grains_;
+    GrainPool<kMaxGrainsPerVoice> grains_;
 
-    // Selected filter instances, one per stereo channel.
-    std::unique_ptr<LadderFilterBase> filter_l_;
-    std::unique_ptr<LadderFilterBase> filter_r_;
+    // Every ladder model for this voice's stereo signal
+    std::unique_ptr<LadderFilterBank> filter_;
 
     // Simple noise generator
     uint32_t noise_state_ = 12345;
@@ -625,27 +557,12 @@ class GranularVoice {
     void SpawnGrain() {
         if (!buffer_) return;
 
-        // Find an inactive grain slot
-        size_t slot = kMaxGrainsPerVoice;
-        for (size_t i = 0; i < kMaxGrainsPerVoice; ++i) {
-            if (!grains_[i].active) {
-                slot = i;
-                break;
-            }
-        }
-
-        // If no free slot, steal oldest grain
-        if (slot >= kMaxGrainsPerVoice) {
-            float oldest_phase = 0.0f;
-            for (size_t i = 0; i < kMaxGrainsPerVoice; ++i) {
-                if (grains_[i].phase > oldest_phase) {
-                    oldest_phase = grains_[i].phase;
-                    slot = i;
-                }
-            }
+        // Take a free slot, or steal the oldest grain when the pool is full
+        uint16_t slot = grains_.Acquire();
+        if (slot == GrainPool<kMaxGrainsPerVoice>::kNoSlot) {
+            slot = grains_.Oldest();
         }
-
-        if (slot >= kMaxGrainsPerVoice) return;
+        if (slot == GrainPool<kMaxGrainsPerVoice>::kNoSlot) return;
 
         float buffer_length = static_cast<float>(buffer_->GetLength());
         float buffer_duration = buffer_length / sample_rate_;
@@ -686,14 +603,6 @@ class GranularVoice {
         float effective_size = GetEffectiveSize();
         float duration_samples = effective_size * sample_rate_;
 
-        // Initialize grain
-        Grain& grain = grains_[slot];
-        grain.active = true;
-        grain.position = grain_position;
-        grain.position_start = grain_position;
-        grain.phase = 0.0f;
-        grain.duration_samples = duration_samples;
-
         // Use modulated pitch as base
         float grainPitchRatio = GetEffectivePitch();
         if (morphPitchActive) {
@@ -705,10 +614,7 @@ class GranularVoice {
         grainPitchRatio = std::max(0.125f, std::min(8.0f, grainPitchRatio));
 
         const bool grainReverse = reverse_grains_ || morphReverseActive;
-        grain.pitch_ratio = grainReverse ? -grainPitchRatio : grainPitchRatio;  // GrainBuf rate parameter
-        grain.amplitude = 1.0f;
-        grain.window_type = window_type_;  // Use voice's envelope setting
-        grain.decay_rate = decay_rate_;    // Use voice's decay rate
+        const float grain_rate = grainReverse ? -grainPitchRatio : grainPitchRatio;  // GrainBuf rate parameter
 
         // Apply pan with spread
         // MGlut: pan_sig = TRand(-spread, spread)
@@ -723,110 +629,100 @@ class GranularVoice {
             grain_pan += GenerateRandomBipolar() * effectiveSpread;
             grain_pan = std::max(-1.0f, std::min(1.0f, grain_pan));
         }
-        grain.pan = grain_pan;
-    }
-
-    std::unique_ptr<LadderFilterBase> CreateFilterInstance(FilterModel model) const {
-        switch (model) {
-            case FilterModel::Stilson: return std::make_unique<StilsonMoog>(sample_rate_);
-            case FilterModel::Microtracker: return std::make_unique<MicrotrackerMoog>(sample_rate_);
-            case FilterModel::Krajeski: return std::make_unique<KrajeskiMoog>(sample_rate_);
-            case FilterModel::MusicDSP: return std::make_unique<MusicDSPMoog>(sample_rate_);
-            case FilterModel::OberheimVariation: return std::make_unique<OberheimVariationMoog>(sample_rate_);
-            case FilterModel::Improved: return std::make_unique<ImprovedMoog>(sample_rate_);
-            case FilterModel::RKSimulation: return std::make_unique<RKSimulationMoog>(sample_rate_);
-            case FilterModel::Hyperion: return std::make_unique<HyperionMoog>(sample_rate_);
-            case FilterModel::DaisyLadder: return std::make_unique<DaisyLadderMoog>(sample_rate_);
-            case FilterModel::CytomicSVF: return std::make_unique<CytomicSvfMoog>(sample_rate_);
-            case FilterModel::Count: break;
+
+        // Envelope shape and decay come from the voice's current settings
+        grains_.Start(slot, grain_position, duration_samples, grain_rate, grain_pan, window_type_, decay_rate_);
+    }
+
+    /// Mix every active grain into out_left/out_right over [begin, end).
+    /// Finished grains are returned to the pool.
+    void RenderGrains(float* out_left, float* out_right, size_t begin, size_t end, float buffer_length) {
+        if (begin >= end) return;
+        grains_.Update([&](uint16_t slot) {
+            return RenderGrain(slot, out_left, out_right, begin, end, buffer_length);
+        });
+    }
+
+    /// Render one grain over [begin, end). Returns false once the grain has finished.
+    bool RenderGrain(uint16_t slot, float* out_left, float* out_right, size_t begin, size_t end,
+                     float buffer_length) {
+        const size_t buf_len = static_cast<size_t>(buffer_length);
+        const WindowType window = grains_.window_type[slot];
+        const float decay = grains_.decay_rate[slot];
+        const float amplitude = grains_.amplitude[slot];
+        const float pan_l = grains_.pan_left[slot];
+        const float pan_r = grains_.pan_right[slot];
+        const float rate = grains_.pitch_ratio[slot];
+        const float phase_increment = grains_.phase_increment[slot];
+        float position = grains_.position[slot];
+        float phase = grains_.phase[slot];
+        bool playing = true;
+
+        for (size_t i = begin; i < end; ++i) {
+            // Grain envelope amplitude
+            float env = GrainEnvelope(window, phase, decay) * amplitude;
+
+            // Read from buffer at grain's current position
+            // Position wraps within buffer
+            float read_pos = std::fmod(position, buffer_length);
+            if (read_pos < 0.0f) read_pos += buffer_length;
+            size_t idx0 = static_cast<size_t>(read_pos);
+            if (idx0 >= buf_len) idx0 = buf_len - 1;  // read_pos rounded up to buffer_length
+            float frac = read_pos - static_cast<float>(idx0);
+
+            // 4-point Hermite interpolation for quality pitched playback.
+            // The reel's guard bands supply the wrapped neighbours.
+            float samp_l;
+            float samp_r;
+            buffer_->ReadHermite(idx0, frac, samp_l, samp_r);
+
+            // Apply grain envelope and pan (equal power)
+            out_left[i] += (samp_l * env) * pan_l;
+            out_right[i] += (samp_r * env) * pan_r;
+
+            // Advance grain playback position by pitch rate
+            // This is how GrainBuf works - pitch affects playback rate within grain
+            position += rate;
+            if (position >= buffer_length || position < 0.0f) {
+                position = std::fmod(position, buffer_length);
+                if (position < 0.0f) position += buffer_length;
+            }
+
+            // Advance grain envelope phase
+            phase += phase_increment;
+            if (phase >= 1.0f) {
+                playing = false;
+                break;
+            }
         }
 
-        return std::make_unique<HyperionMoog>(sample_rate_);
+        grains_.position[slot] = position;
+        grains_.phase[slot] = phase;
+        return playing;
     }
 
     void CreateFilterInstances() {
-        filter_l_ = CreateFilterInstance(filter_model_);
-        filter_r_ = CreateFilterInstance(filter_model_);
+        filter_ = std::make_unique<LadderFilterBank>(sample_rate_, static_cast<int>(filter_model_));
     }
 
     void UpdateFilterParameters() {
-        if (!filter_l_ || !filter_r_) return;
-
-        // Model-specific stability limits.
-        float cutoffLimit = 0.45f;
-        float resonanceMax = 1.0f;
-        switch (filter_model_) {
-            case FilterModel::Stilson:            cutoffLimit = 0.45f; resonanceMax = 0.95f; break;
-            case FilterModel::Microtracker:       cutoffLimit = 0.45f; resonanceMax = 0.92f; break;
-            case FilterModel::Krajeski:           cutoffLimit = 0.45f; resonanceMax = 0.93f; break;
-            case FilterModel::MusicDSP:           cutoffLimit = 0.42f; resonanceMax = 0.88f; break;
-            case FilterModel::OberheimVariation:  cutoffLimit = 0.40f; resonanceMax = 0.86f; break;
-            case FilterModel::Improved:           cutoffLimit = 0.40f; resonanceMax = 0.82f; break;
-            case FilterModel::RKSimulation:       cutoffLimit = 0.35f; resonanceMax = 0.55f; break;
-            case FilterModel::Hyperion:           cutoffLimit = 0.42f; resonanceMax = 0.88f; break;
-            case FilterModel::DaisyLadder:        cutoffLimit = 0.45f; resonanceMax = 0.95f; break;
-            case FilterModel::CytomicSVF:         cutoffLimit = 0.49f; resonanceMax = 1.0f;  break;
-            case FilterModel::Count: break;
-        }
-
-        const float nyquist = sample_rate_ * 0.5f;
-        const float safeCutoff = std::max(20.0f, std::min(cutoff_, nyquist * cutoffLimit));
-        const float safeResonance = std::max(0.0f, std::min(q_, resonanceMax));
-
-        filter_l_->SetCutoff(safeCutoff);
-        filter_r_->SetCutoff(safeCutoff);
-        filter_l_->SetResonance(safeResonance);
-        filter_r_->SetResonance(safeResonance);
-    }
-
-    void ApplyFilter(float& sample_l, float& sample_r) {
-        ApplyFilterWithCutoff(sample_l, sample_r, cutoff_);
-    }
-
-    void ApplyFilterWithCutoff(float& sample_l, float& sample_r, float cutoff) {
-        if (!filter_l_ || !filter_r_) return;
-
-        // Model-specific stability limits
-        float cutoffLimit = 0.45f;
-        switch (filter_model_) {
-            case FilterModel::Stilson:            cutoffLimit = 0.45f; break;
-            case FilterModel::Microtracker:       cutoffLimit = 0.45f; break;
-            case FilterModel::Krajeski:           cutoffLimit = 0.45f; break;
-            case FilterModel::MusicDSP:           cutoffLimit = 0.42f; break;
-            case FilterModel::OberheimVariation:  cutoffLimit = 0.40f; break;
-            case FilterModel::Improved:           cutoffLimit = 0.40f; break;
-            case FilterModel::RKSimulation:       cutoffLimit = 0.35f; break;
-            case FilterModel::Hyperion:           cutoffLimit = 0.42f; break;
-            case FilterModel::DaisyLadder:        cutoffLimit = 0.45f; break;
-            case FilterModel::CytomicSVF:         cutoffLimit = 0.49f; break;
-            case FilterModel::Count: break;
-        }
-
-        const float nyquist = sample_rate_ * 0.5f;
-        const float safeCutoff = std::max(20.0f, std::min(cutoff, nyquist * cutoffLimit));
-
-        // Update filter cutoff for modulation
-        filter_l_->SetCutoff(safeCutoff);
-        filter_r_->SetCutoff(safeCutoff);
+        if (filter_) filter_->SetResonance(q_);
+    }
 
-        sample_l = std::max(-8.0f, std::min(8.0f, sample_l));
-        sample_r = std::max(-8.0f, std::min(8.0f, sample_r));
-        filter_l_->Process(&sample_l, 1);
-        filter_r_->Process(&sample_r, 1);
+    /// Filters a block in place, ramping the cutoff from where the previous
+    /// block ended to `cutoff` (see LadderFilterBank).
+    void ApplyFilterBlock(float* left, float* right, size_t num_frames, float cutoff) {
+        if (!filter_) return;
+        // A non-finite output is muted and the filter cleared in place
+        if (!filter_->Process(left, right, static_cast<uint32_t>(num_frames), cutoff)) return;
 
-        // Guard against unstable states and denormals in some ladder variants.
-        if (!std::isfinite(sample_l) || !std::isfinite(sample_r)) {
-            sample_l = 0.0f;
-            sample_r = 0.0f;
-            CreateFilterInstances();
-            UpdateFilterParameters();
-            return;
+        for (size_t i = 0; i < num_frames; ++i) {
+            float sample_l = fastmath::tanh(left[i] * 0.5f) * 2.0f;
+            float sample_r = fastmath::tanh(right[i] * 0.5f) * 2.0f;
+            // Flush denormals
+            left[i] = std::fabs(sample_l) < 1.0e-20f ? 0.0f : sample_l;
+            right[i] = std::fabs(sample_r) < 1.0e-20f ? 0.0f : sample_r;
         }
-
-        sample_l = std::tanh(sample_l * 0.5f) * 2.0f;
-        sample_r = std::tanh(sample_r * 0.5f) * 2.0f;
-        if (std::fabs(sample_l) < 1.0e-20f) sample_l = 0.0f;
-        if (std::fabs(sample_r) < 1.0e-20f) sample_r = 0.0f;
     }
 };
 
@@ -70,6 +70,12 @@ class CytomicSvfMoog : public LadderFilterBase
         updateCoefficients();
     }
 
+    virtual void Reset() override
+    {
+        ic1eq_ = 0.0f;
+        ic2eq_ = 0.0f;
+    }
+
     void SetFilterMode(FilterMode mode)
     {
         mode_ = mode;
@@ -109,6 +109,13 @@ class DaisyLadderMoog : public LadderFilterBase
         K_ = 4.0f * r;
     }
 
+    virtual void Reset() override
+    {
+        std::fill(std::begin(z0_), std::end(z0_), 0.0f);
+        std::fill(std::begin(z1_), std::end(z1_), 0.0f);
+        oldinput_ = 0.0f;
+    }
+
     void SetFilterMode(FilterMode mode) { mode_ = mode; }
 
     void SetPassbandGain(float pbg)
@@ -125,6 +125,17 @@ class HyperionMoog : public LadderFilterBase
         alpha0 = 1.0 / (1.0 + K * gamma);
     }
 
+    virtual void Reset() override
+    {
+        std::fill(std::begin(z), std::end(z), 0.0);
+        std::fill(std::begin(x_prev_stage), std::end(x_prev_stage), 0.0);
+        std::fill(std::begin(Fx_prev_stage), std::end(Fx_prev_stage), 0.0);
+        std::fill(std::begin(Vt_prev), std::end(Vt_prev), 0.0);
+        u_prev = 0.0;
+        Fu_prev = 0.0;
+        Vt_u_prev = 0.0;
+    }
+
     void SetFilterMode(FilterMode mode)
     {
         // Multi-mode output coefficients: output = c[0]*u + c[1]*y0 + c[2]*y1 + c[3]*y2 + c[4]*y3
@@ -20,6 +20,7 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #define IMPROVED_LADDER_H
 
 #include "LadderFilterBase.h"
+#include "FastMath.h"
 #include <algorithm>
 
 /*
@@ -60,25 +61,25 @@ class ImprovedMoog : public LadderFilterBase
 
 		for (int i = 0; i < n; i++)
 		{
-			dV0 = -g * (tanh((drive * samples[i] + resonance * V[3]) / (2.0 * VT)) + tV[0]);
+			dV0 = -g * (Grainulator::fastmath::tanh((drive * samples[i] + resonance * V[3]) / (2.0 * VT)) + tV[0]);
 			V[0] += (dV0 + dV[0]) / (2.0 * sampleRate);
 			dV[0] = dV0;
-			tV[0] = tanh(V[0] / (2.0 * VT));
+			tV[0] = Grainulator::fastmath::tanh(V[0] / (2.0 * VT));
 			
 			dV1 = g * (tV[0] - tV[1]);
 			V[1] += (dV1 + dV[1]) / (2.0 * sampleRate);
 			dV[1] = dV1;
-			tV[1] = tanh(V[1] / (2.0 * VT));
+			tV[1] = Grainulator::fastmath::tanh(V[1] / (2.0 * VT));
 			
 			dV2 = g * (tV[1] - tV[2]);
 			V[2] += (dV2 + dV[2]) / (2.0 * sampleRate);
 			dV[2] = dV2;
-			tV[2] = tanh(V[2] / (2.0 * VT));
+			tV[2] = Grainulator::fastmath::tanh(V[2] / (2.0 * VT));
 			
 			dV3 = g * (tV[2] - tV[3]);
 			V[3] += (dV3 + dV[3]) / (2.0 * sampleRate);
 			dV[3] = dV3;
-			tV[3] = tanh(V[3] / (2.0 * VT));
+			tV[3] = Grainulator::fastmath::tanh(V[3] / (2.0 * VT));
 			
 			samples[i] = V[3];
 		}
@@ -96,6 +97,13 @@ class ImprovedMoog : public LadderFilterBase
 		g = 4.0 * MOOG_PI * VT * cutoff * (1.0 - x) / (1.0 + x);
 	}
 	
+	virtual void Reset() override
+	{
+		std::fill(std::begin(V), std::end(V), 0.0);
+		std::fill(std::begin(dV), std::end(dV), 0.0);
+		std::fill(std::begin(tV), std::end(tV), 0.0);
+	}
+	
 private:
 	
 	double V[4];
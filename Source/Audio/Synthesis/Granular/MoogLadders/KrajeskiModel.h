@@ -4,6 +4,7 @@
 #define KRAJESKI_LADDER_H
 
 #include "LadderFilterBase.h"
+#include "FastMath.h"
 #include <algorithm>
 
 /*
@@ -47,7 +48,7 @@ class KrajeskiMoog final : public LadderFilterBase
 	{
 		for (int s = 0; s < n; ++s)
 		{
-			state[0] = tanh(drive * (samples[s] - 4 * gRes * (state[4] - gComp * samples[s])));
+			state[0] = Grainulator::fastmath::tanh(drive * (samples[s] - 4 * gRes * (state[4] - gComp * samples[s])));
 			
 			for(int i = 0; i < 4; i++)
 			{
@@ -62,14 +63,22 @@ class KrajeskiMoog final : public LadderFilterBase
 	virtual void SetResonance(float r) override
 	{
 		resonance = r;
-		gRes = resonance * (1.0029 + 0.0526 * wc - 0.926 * pow(wc, 2) + 0.0218 * pow(wc, 3));
+		const double wc2 = wc * wc;
+		gRes = resonance * (1.0029 + 0.0526 * wc - 0.926 * wc2 + 0.0218 * wc2 * wc);
 	}
 	
 	virtual void SetCutoff(float c) override
 	{
 		cutoff = c;
 		wc = 2 * MOOG_PI * cutoff / sampleRate;
-		g = 0.9892 * wc - 0.4342 * pow(wc, 2) + 0.1381 * pow(wc, 3) - 0.0202 * pow(wc, 4);
+		const double wc2 = wc * wc;
+		g = 0.9892 * wc - 0.4342 * wc2 + 0.1381 * wc2 * wc - 0.0202 * wc2 * wc2;
+	}
+	
+	virtual void Reset() override
+	{
+		std::fill(std::begin(state), std::end(state), 0.0);
+		std::fill(std::begin(delay), std::end(delay), 0.0);
 	}
 	
 private:
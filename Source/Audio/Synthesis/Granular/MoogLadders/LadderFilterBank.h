@@ -0,0 +1,246 @@
+// LadderFilterBank - every ladder model, pre-constructed, for one stereo signal
+//
+// Holds a stereo-linked instance of each model (see StereoLadders.h) by value
+// and dispatches on the model index with a switch, so there is no virtual call
+// and no allocation after construction. A model change resets the incoming
+// model and crossfades to it over kCrossfadeLength samples; a change requested
+// mid-fade starts when the running fade ends. Cutoff is ramped per block at
+// control rate, as in LadderFilterBase::ProcessCutoffRamp, and both cutoff and
+// resonance are clamped to each model's stability limits.
+//
+// Model indices follow GranularVoice::FilterModel and the master filter's
+// parameter: Stilson, Microtracker, Krajeski, MusicDSP, OberheimVariation,
+// Improved, RKSimulation, Hyperion, DaisyLadder, CytomicSVF.
+
+#pragma once
+
+#ifndef LADDER_FILTER_BANK_H
+#define LADDER_FILTER_BANK_H
+
+#include "StereoLadders.h"
+#include "StilsonModel.h"
+#include "OberheimVariationModel.h"
+#include "RKSimulationModel.h"
+#include "HyperionModel.h"
+#include "DaisyLadderModel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <tuple>
+
+class LadderFilterBank
+{
+public:
+
+    static constexpr int kNumModels = 10;
+    static constexpr uint32_t kControlInterval = LadderFilterBase::kControlInterval;
+    static constexpr uint32_t kCrossfadeLength = 512;
+
+    LadderFilterBank(float sampleRate, int model)
+        : models_(sampleRate, sampleRate, sampleRate, sampleRate, sampleRate,
+                  sampleRate, sampleRate, sampleRate, sampleRate, sampleRate)
+        , nyquist_(sampleRate * 0.5f)
+        , model_(std::max(0, std::min(kNumModels - 1, model)))
+        , active_(model_)
+    {
+        Configure(active_, appliedCutoff_);
+    }
+
+    LadderFilterBank(const LadderFilterBank&) = delete;
+    LadderFilterBank& operator=(const LadderFilterBank&) = delete;
+
+    // Selects a model by index (clamped). Real-time safe.
+    void SetModel(int model)
+    {
+        model = std::max(0, std::min(kNumModels - 1, model));
+        model_ = model;
+        if (fading_ < 0)
+            StartFade(model);
+        else
+            pending_ = model;
+    }
+
+    // The most recently requested model
+    int GetModel() const { return model_; }
+
+    // Resonance 0-1, applied immediately
+    void SetResonance(float r)
+    {
+        resonance_ = r;
+        Visit(active_, [this](auto& m) { m.SetResonance(SafeResonance(active_)); });
+        if (fading_ >= 0)
+            Visit(fading_, [this](auto& m) { m.SetResonance(SafeResonance(fading_)); });
+    }
+
+    // Clears the state of every model
+    void Reset()
+    {
+        for (int m = 0; m < kNumModels; ++m)
+            Visit(m, [](auto& model) { model.Reset(); });
+    }
+
+    // Filters a stereo block in place while the cutoff ramps linearly from the
+    // previous block's value to `cutoff` (Hz). Returns false if the output was
+    // not finite; the block is then muted and the running models are reset.
+    bool Process(float * left, float * right, uint32_t n, float cutoff)
+    {
+        const float step = n > 0 ? (cutoff - cutoff_) / static_cast<float>(n) : 0.0f;
+        for (uint32_t offset = 0; offset < n; offset += kControlInterval)
+        {
+            const uint32_t count = std::min(kControlInterval, n - offset);
+            const float c = cutoff_ + step * static_cast<float>(offset + count);
+            if (c != appliedCutoff_)
+            {
+                appliedCutoff_ = c;
+                Configure(active_, c);
+                if (fading_ >= 0)
+                    Configure(fading_, c);
+            }
+
+            float * l = left + offset;
+            float * r = right + offset;
+            if (fading_ < 0)
+            {
+                Visit(active_, [=](auto& m) { m.Process(l, r, count); });
+                continue;
+            }
+
+            // Outgoing model on a copy, incoming in place, then blend
+            float oldL[kControlInterval];
+            float oldR[kControlInterval];
+            std::memcpy(oldL, l, count * sizeof(float));
+            std::memcpy(oldR, r, count * sizeof(float));
+            Visit(fading_, [&](auto& m) { m.Process(oldL, oldR, count); });
+            Visit(active_, [=](auto& m) { m.Process(l, r, count); });
+
+            const float inc = 1.0f / static_cast<float>(kCrossfadeLength);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const float t = std::min(1.0f, static_cast<float>(fadePos_ + i + 1) * inc);
+                l[i] = oldL[i] + (l[i] - oldL[i]) * t;
+                r[i] = oldR[i] + (r[i] - oldR[i]) * t;
+            }
+            fadePos_ += count;
+            if (fadePos_ >= kCrossfadeLength)
+            {
+                fading_ = -1;
+                if (pending_ >= 0)
+                {
+                    const int next = pending_;
+                    pending_ = -1;
+                    StartFade(next);
+                }
+            }
+        }
+        cutoff_ = cutoff;
+
+        bool finite = true;
+        for (uint32_t i = 0; i < n; ++i)
+            finite = finite && std::isfinite(left[i]) && std::isfinite(right[i]);
+        if (!finite)
+        {
+            std::fill(left, left + n, 0.0f);
+            std::fill(right, right + n, 0.0f);
+            Visit(active_, [](auto& m) { m.Reset(); });
+            if (fading_ >= 0)
+                Visit(fading_, [](auto& m) { m.Reset(); });
+        }
+        return finite;
+    }
+
+private:
+
+    struct Limits
+    {
+        float cutoff;     // Fraction of Nyquist
+        float resonance;  // Highest stable resonance
+    };
+
+    static constexpr Limits kLimits[kNumModels] = {
+        {0.45f, 0.95f},  // Stilson
+        {0.45f, 0.92f},  // Microtracker
+        {0.45f, 0.93f},  // Krajeski
+        {0.42f, 0.88f},  // MusicDSP
+        {0.40f, 0.86f},  // OberheimVariation
+        {0.40f, 0.82f},  // Improved
+        {0.35f, 0.55f},  // RKSimulation
+        {0.42f, 0.88f},  // Hyperion
+        {0.45f, 0.95f},  // DaisyLadder
+        {0.49f, 1.0f},   // CytomicSVF
+    };
+
+    using Models = std::tuple<
+        StereoLadder<StilsonMoog>,
+        StereoMicrotracker,
+        StereoKrajeski,
+        StereoMusicDSP,
+        StereoLadder<OberheimVariationMoog>,
+        StereoImproved,
+        StereoLadder<RKSimulationMoog>,
+        StereoLadder<HyperionMoog>,
+        StereoLadder<DaisyLadderMoog>,
+        StereoCytomicSvf>;
+    static_assert(std::tuple_size<Models>::value == kNumModels, "one slot per model");
+
+    template <typename Fn>
+    void Visit(int model, Fn&& fn)
+    {
+        switch (model)
+        {
+            case 0: fn(std::get<0>(models_)); break;
+            case 1: fn(std::get<1>(models_)); break;
+            case 2: fn(std::get<2>(models_)); break;
+            case 3: fn(std::get<3>(models_)); break;
+            case 4: fn(std::get<4>(models_)); break;
+            case 5: fn(std::get<5>(models_)); break;
+            case 6: fn(std::get<6>(models_)); break;
+            case 7: fn(std::get<7>(models_)); break;
+            case 8: fn(std::get<8>(models_)); break;
+            case 9: fn(std::get<9>(models_)); break;
+            default: break;
+        }
+    }
+
+    float SafeCutoff(int model, float cutoff) const
+    {
+        return std::max(20.0f, std::min(cutoff, nyquist_ * kLimits[model].cutoff));
+    }
+
+    float SafeResonance(int model) const
+    {
+        return std::max(0.0f, std::min(resonance_, kLimits[model].resonance));
+    }
+
+    // Cutoff first: Krajeski's resonance gain depends on the cutoff
+    void Configure(int model, float cutoff)
+    {
+        Visit(model, [&](auto& m) {
+            m.SetCutoff(SafeCutoff(model, cutoff));
+            m.SetResonance(SafeResonance(model));
+        });
+    }
+
+    void StartFade(int model)
+    {
+        if (model == active_)
+            return;
+        Visit(model, [](auto& m) { m.Reset(); });
+        Configure(model, appliedCutoff_);
+        fading_ = active_;
+        active_ = model;
+        fadePos_ = 0;
+    }
+
+    Models models_;
+    float nyquist_;
+    int model_;            // Requested model
+    int active_;           // Model being faded in (or running alone)
+    int fading_ = -1;      // Model being faded out, -1 when not crossfading
+    int pending_ = -1;     // Requested while a fade was running
+    uint32_t fadePos_ = 0;
+    float cutoff_ = 20000.0f;         // Cutoff reached by the last block
+    float appliedCutoff_ = 20000.0f;  // Cutoff the running models were last set to
+    float resonance_ = 0.0f;
+};
+
+#endif // LADDER_FILTER_BANK_H
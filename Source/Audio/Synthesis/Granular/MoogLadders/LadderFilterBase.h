@@ -4,6 +4,7 @@
 #define LADDER_FILTER_BASE_H
 
 #include "MoogUtils.h"
+#include <algorithm>
 #include <iterator>
 
 class LadderFilterBase
@@ -13,10 +14,32 @@ class LadderFilterBase
 	LadderFilterBase(float sampleRate) : sampleRate(sampleRate) {}
 	virtual ~LadderFilterBase() {}
 	
+	// Coefficient update period for ProcessCutoffRamp
+	static constexpr uint32_t kControlInterval = 16;
+	
 	virtual void Process(float * samples, uint32_t n) = 0;
 	virtual void SetResonance(float r) = 0;
 	virtual void SetCutoff(float c) = 0;
 	
+	// Clears the filter state (delays, integrators) but keeps the coefficients;
+	// real-time safe, used to recover from a non-finite output.
+	virtual void Reset() = 0;
+	
+	// Processes n samples while the cutoff moves linearly from `from` to `to` (Hz).
+	// Coefficients are recomputed every kControlInterval samples, at the cutoff
+	// reached by the end of that sub-block, so the cost of SetCutoff and of the
+	// virtual calls is paid per sub-block rather than per sample.
+	void ProcessCutoffRamp(float * samples, uint32_t n, float from, float to)
+	{
+		const float step = n > 0 ? (to - from) / static_cast<float>(n) : 0.0f;
+		for (uint32_t offset = 0; offset < n; offset += kControlInterval)
+		{
+			const uint32_t count = std::min(kControlInterval, n - offset);
+			SetCutoff(from + step * static_cast<float>(offset + count));
+			Process(samples + offset, count);
+		}
+	}
+	
 	float GetResonance() { return resonance; }
 	float GetCutoff() { return cutoff; }
 	
@@ -56,6 +56,11 @@ class MicrotrackerMoog : public LadderFilterBase
 		cutoff = moog_min(cutoff, 1);
 	}
 
+	virtual void Reset() override
+	{
+		p0 = p1 = p2 = p3 = p32 = p33 = p34 = 0.0;
+	}
+
 private:
 
 	double p0;
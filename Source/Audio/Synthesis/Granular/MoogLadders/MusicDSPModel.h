@@ -33,7 +33,7 @@ class MusicDSPMoog : public LadderFilterBase
 	{
 		for (int s = 0; s < n; ++s)
 		{
-			float x = samples[s] - resonance * stage[3];
+			float x = samples[s] - feedback * stage[3];
 
 			// Four cascaded one-pole filters (bilinear transform)
 			stage[0] = x * p + delay[0]  * p - k * stage[0];
@@ -55,7 +55,8 @@ class MusicDSPMoog : public LadderFilterBase
 	
 	virtual void SetResonance(float r) override
 	{
-		resonance = r * (t2 + 6.0 * t1) / (t2 - 6.0 * t1);
+		resonance = r;
+		feedback = r * (t2 + 6.0 * t1) / (t2 - 6.0 * t1);
 	}
 	
 	virtual void SetCutoff(float c) override
@@ -70,6 +71,12 @@ class MusicDSPMoog : public LadderFilterBase
 		SetResonance(resonance);
 	}
 	
+	virtual void Reset() override
+	{
+		std::fill(std::begin(stage), std::end(stage), 0.0);
+		std::fill(std::begin(delay), std::end(delay), 0.0);
+	}
+	
 private:
 	
 	double stage[4];
@@ -79,6 +86,7 @@ class MusicDSPMoog : public LadderFilterBase
 	double k;
 	double t1;
 	double t2;
+	double feedback; // resonance scaled for the current cutoff
 
 };
 
@@ -40,6 +40,8 @@ class VAOnePole
 		return out;
 	}
 	
+	void ClearState() { z1 = 0.0; }
+	
 	void SetFeedback(double fb) { feedback = fb; }
 	double GetFeedbackOutput(){ return beta * (z1 + feedback * delta); }
 	void SetAlpha(double a) { alpha = a; };
@@ -160,6 +162,14 @@ class OberheimVariationMoog : public LadderFilterBase
 		oberheimCoefs[4] = 1.0;
 	}
 	
+	virtual void Reset() override
+	{
+		LPF1->ClearState();
+		LPF2->ClearState();
+		LPF3->ClearState();
+		LPF4->ClearState();
+	}
+	
 private:
 	
 	VAOnePole * LPF1;
@@ -110,6 +110,11 @@ class RKSimulationMoog : public LadderFilterBase
 		cutoff = (2.0 * MOOG_PI * c);
 	}
 	
+	virtual void Reset() override
+	{
+		std::fill(std::begin(state), std::end(state), 0.0);
+	}
+	
 private:
 	
 	void calculateDerivatives(float input, double * dstate, double * state)
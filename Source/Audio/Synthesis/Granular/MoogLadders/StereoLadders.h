@@ -0,0 +1,400 @@
+// StereoLadders - stereo-linked versions of the ladder models for LadderFilterBank
+//
+// Both channels share one set of coefficients (same cutoff and resonance),
+// so only the state differs. StereoLadder<Model> wraps two scalar instances
+// and calls them without virtual dispatch. The models whose recurrences map
+// onto plain arithmetic also have a 2-lane SIMD version: L and R sit in lanes
+// 0 and 1 of a SimdOps vector, the state is single precision, and one pass
+// runs both channels. Each SIMD model computes its coefficients with the same
+// formulas as the scalar model it mirrors.
+//
+// Every class has the same interface: SetCutoff, SetResonance, Reset and
+// Process(left, right, n).
+
+#pragma once
+
+#ifndef STEREO_LADDERS_H
+#define STEREO_LADDERS_H
+
+#include "LadderFilterBase.h"
+#include "FastMath.h"
+#include "SimdOps.h"
+#include <algorithm>
+#include <cmath>
+
+namespace stereo_ladder_detail
+{
+    using Grainulator::simd::f4;
+
+    inline f4 LoadPair(const float * left, const float * right, uint32_t i)
+    {
+        return Grainulator::simd::setr(left[i], right[i], 0.0f, 0.0f);
+    }
+
+    inline void StorePair(f4 v, float * left, float * right, uint32_t i)
+    {
+        float lanes[Grainulator::simd::kWidth];
+        Grainulator::simd::store(lanes, v);
+        left[i] = lanes[0];
+        right[i] = lanes[1];
+    }
+}
+
+// Two scalar instances of Model, called directly (qualified, so not virtual).
+template <typename Model>
+class StereoLadder
+{
+public:
+
+    explicit StereoLadder(float sampleRate) : left_(sampleRate), right_(sampleRate) {}
+
+    void SetCutoff(float c)
+    {
+        left_.Model::SetCutoff(c);
+        right_.Model::SetCutoff(c);
+    }
+
+    void SetResonance(float r)
+    {
+        left_.Model::SetResonance(r);
+        right_.Model::SetResonance(r);
+    }
+
+    void Reset()
+    {
+        left_.Model::Reset();
+        right_.Model::Reset();
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        left_.Model::Process(left, n);
+        right_.Model::Process(right, n);
+    }
+
+private:
+
+    Model left_;
+    Model right_;
+};
+
+// CytomicSvfMoog, low-pass output
+class StereoCytomicSvf
+{
+public:
+
+    explicit StereoCytomicSvf(float sampleRate) : sampleRate_(sampleRate), cutoff_(1000.0f), resonance_(0.1f)
+    {
+        Reset();
+        UpdateCoefficients();
+    }
+
+    void SetCutoff(float c) { cutoff_ = c; UpdateCoefficients(); }
+    void SetResonance(float r) { resonance_ = r; UpdateCoefficients(); }
+
+    void Reset()
+    {
+        ic1eq_ = Grainulator::simd::set1(0.0f);
+        ic2eq_ = Grainulator::simd::set1(0.0f);
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        using namespace Grainulator::simd;
+        using namespace stereo_ladder_detail;
+        const f4 a1 = set1(a1_), a2 = set1(a2_), a3 = set1(a3_), two = set1(2.0f);
+        f4 ic1 = ic1eq_, ic2 = ic2eq_;
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const f4 v3 = sub(LoadPair(left, right, s), ic2);
+            const f4 v1 = add(mul(a1, ic1), mul(a2, v3));
+            const f4 v2 = add(add(ic2, mul(a2, ic1)), mul(a3, v3));
+            ic1 = sub(mul(two, v1), ic1);
+            ic2 = sub(mul(two, v2), ic2);
+            StorePair(v2, left, right, s);
+        }
+        ic1eq_ = ic1;
+        ic2eq_ = ic2;
+    }
+
+private:
+
+    void UpdateCoefficients()
+    {
+        const float freq = std::max(20.0f, std::min(cutoff_, sampleRate_ * 0.49f));
+        const float g = std::tan(static_cast<float>(M_PI) * freq / sampleRate_);
+        const float k = 1.0f / (0.5f * std::exp(resonance_ * 3.6889f));
+        a1_ = 1.0f / (1.0f + g * (g + k));
+        a2_ = g * a1_;
+        a3_ = g * a2_;
+    }
+
+    float sampleRate_;
+    float cutoff_;
+    float resonance_;
+    float a1_, a2_, a3_;
+    stereo_ladder_detail::f4 ic1eq_, ic2eq_;
+};
+
+// KrajeskiMoog
+class StereoKrajeski
+{
+public:
+
+    explicit StereoKrajeski(float sampleRate) : sampleRate_(sampleRate), wc_(0.0), g_(0.0f), gRes_(0.0f)
+    {
+        Reset();
+        SetCutoff(1000.0f);
+        SetResonance(0.1f);
+    }
+
+    void SetResonance(float r)
+    {
+        const double wc2 = wc_ * wc_;
+        gRes_ = static_cast<float>(r * (1.0029 + 0.0526 * wc_ - 0.926 * wc2 + 0.0218 * wc2 * wc_));
+    }
+
+    void SetCutoff(float c)
+    {
+        wc_ = 2 * MOOG_PI * c / sampleRate_;
+        const double wc2 = wc_ * wc_;
+        g_ = static_cast<float>(0.9892 * wc_ - 0.4342 * wc2 + 0.1381 * wc2 * wc_ - 0.0202 * wc2 * wc2);
+    }
+
+    void Reset()
+    {
+        std::fill(std::begin(state_), std::end(state_), Grainulator::simd::set1(0.0f));
+        std::fill(std::begin(delay_), std::end(delay_), Grainulator::simd::set1(0.0f));
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        using namespace Grainulator::simd;
+        using namespace stereo_ladder_detail;
+        const f4 g = set1(g_), fourRes = set1(4.0f * gRes_);
+        const f4 a = set1(static_cast<float>(0.3 / 1.3)), b = set1(static_cast<float>(1 / 1.3));
+        const f4 lo = set1(-1e30f), hi = set1(1e30f);
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const f4 x = LoadPair(left, right, s);
+            state_[0] = Grainulator::fastmath::tanh(sub(x, mul(fourRes, sub(state_[4], x))));
+            for (int i = 0; i < 4; i++)
+            {
+                const f4 delta = sub(add(mul(a, state_[i]), mul(b, delay_[i])), state_[i + 1]);
+                state_[i + 1] = min(max(add(mul(g, delta), state_[i + 1]), lo), hi);
+                delay_[i] = state_[i];
+            }
+            StorePair(state_[4], left, right, s);
+        }
+    }
+
+private:
+
+    float sampleRate_;
+    double wc_;
+    float g_;
+    float gRes_;
+    stereo_ladder_detail::f4 state_[5];
+    stereo_ladder_detail::f4 delay_[4];
+};
+
+// MicrotrackerMoog
+class StereoMicrotracker
+{
+public:
+
+    explicit StereoMicrotracker(float sampleRate) : sampleRate_(sampleRate), cutoff_(0.0f), resonance_(0.0f)
+    {
+        Reset();
+        SetCutoff(1000.0f);
+        SetResonance(0.1f);
+    }
+
+    void SetResonance(float r) { resonance_ = r; }
+
+    void SetCutoff(float c)
+    {
+        cutoff_ = moog_min(static_cast<float>(c * 2 * MOOG_PI / sampleRate_), 1);
+    }
+
+    void Reset()
+    {
+        std::fill(std::begin(p_), std::end(p_), Grainulator::simd::set1(0.0f));
+        p32_ = p33_ = p34_ = Grainulator::simd::set1(0.0f);
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        using namespace Grainulator::simd;
+        using namespace stereo_ladder_detail;
+        const f4 k = set1(resonance_ * 4.0f), cutoff = set1(cutoff_);
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const f4 out = add(add(mul(p_[3], set1(0.360891f)), mul(p32_, set1(0.417290f))),
+                               add(mul(p33_, set1(0.177896f)), mul(p34_, set1(0.0439725f))));
+            p34_ = p33_;
+            p33_ = p32_;
+            p32_ = p_[3];
+
+            f4 input = sub(LoadPair(left, right, s), mul(k, out));
+            for (int i = 0; i < 4; ++i)
+            {
+                const f4 t = FastTanh(p_[i]);
+                p_[i] = add(p_[i], mul(sub(FastTanh(input), t), cutoff));
+                input = p_[i];
+            }
+            StorePair(out, left, right, s);
+        }
+    }
+
+private:
+
+    // Same rational approximation as MoogUtils fast_tanh
+    static stereo_ladder_detail::f4 FastTanh(stereo_ladder_detail::f4 x)
+    {
+        using namespace Grainulator::simd;
+        const f4 x2 = mul(x, x);
+        return div(mul(x, add(set1(27.0f), x2)), add(set1(27.0f), mul(set1(9.0f), x2)));
+    }
+
+    float sampleRate_;
+    float cutoff_;
+    float resonance_;
+    stereo_ladder_detail::f4 p_[4];
+    stereo_ladder_detail::f4 p32_, p33_, p34_;
+};
+
+// MusicDSPMoog
+class StereoMusicDSP
+{
+public:
+
+    explicit StereoMusicDSP(float sampleRate) : sampleRate_(sampleRate), resonance_(0.0f)
+    {
+        Reset();
+        SetCutoff(1000.0f);
+        SetResonance(0.1f);
+    }
+
+    void SetResonance(float r)
+    {
+        resonance_ = r;
+        feedback_ = static_cast<float>(r * (t2_ + 6.0 * t1_) / (t2_ - 6.0 * t1_));
+    }
+
+    void SetCutoff(float c)
+    {
+        const double cutoff = 2.0 * c / sampleRate_;
+        p_ = static_cast<float>(cutoff * (1.8 - 0.8 * cutoff));
+        // k is close to -1 at low cutoffs; keep 1 + k instead so the float
+        // coefficient does not lose the small difference that sets the pole
+        kPlusOne_ = static_cast<float>(2.0 * sin(cutoff * MOOG_PI * 0.5));
+        t1_ = (1.0 - p_) * 1.386249;
+        t2_ = 12.0 + t1_ * t1_;
+        SetResonance(resonance_);
+    }
+
+    void Reset()
+    {
+        std::fill(std::begin(stage_), std::end(stage_), Grainulator::simd::set1(0.0f));
+        std::fill(std::begin(delay_), std::end(delay_), Grainulator::simd::set1(0.0f));
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        using namespace Grainulator::simd;
+        using namespace stereo_ladder_detail;
+        const f4 p = set1(p_), k1 = set1(kPlusOne_), fb = set1(feedback_), sixth = set1(1.0f / 6.0f);
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const f4 x = sub(LoadPair(left, right, s), mul(fb, stage_[3]));
+            stage_[0] = add(stage_[0], sub(mul(add(x, delay_[0]), p), mul(k1, stage_[0])));
+            stage_[1] = add(stage_[1], sub(mul(add(stage_[0], delay_[1]), p), mul(k1, stage_[1])));
+            stage_[2] = add(stage_[2], sub(mul(add(stage_[1], delay_[2]), p), mul(k1, stage_[2])));
+            stage_[3] = add(stage_[3], sub(mul(add(stage_[2], delay_[3]), p), mul(k1, stage_[3])));
+            stage_[3] = sub(stage_[3], mul(mul(mul(stage_[3], stage_[3]), stage_[3]), sixth));
+            delay_[0] = x;
+            delay_[1] = stage_[0];
+            delay_[2] = stage_[1];
+            delay_[3] = stage_[2];
+            StorePair(stage_[3], left, right, s);
+        }
+    }
+
+private:
+
+    float sampleRate_;
+    float resonance_;
+    float feedback_;
+    float p_, kPlusOne_;
+    double t1_, t2_;
+    stereo_ladder_detail::f4 stage_[4];
+    stereo_ladder_detail::f4 delay_[4];
+};
+
+// ImprovedMoog
+class StereoImproved
+{
+public:
+
+    explicit StereoImproved(float sampleRate) : sampleRate_(sampleRate), g_(0.0f), resonance_(0.0f)
+    {
+        Reset();
+        SetCutoff(1000.0f);
+        SetResonance(0.1f);
+    }
+
+    void SetResonance(float r) { resonance_ = r; }
+
+    void SetCutoff(float c)
+    {
+        const double x = (MOOG_PI * c) / sampleRate_;
+        g_ = static_cast<float>(4.0 * MOOG_PI * kVT * c * (1.0 - x) / (1.0 + x));
+    }
+
+    void Reset()
+    {
+        std::fill(std::begin(V_), std::end(V_), Grainulator::simd::set1(0.0f));
+        std::fill(std::begin(dV_), std::end(dV_), Grainulator::simd::set1(0.0f));
+        std::fill(std::begin(tV_), std::end(tV_), Grainulator::simd::set1(0.0f));
+    }
+
+    void Process(float * left, float * right, uint32_t n)
+    {
+        using namespace Grainulator::simd;
+        using namespace stereo_ladder_detail;
+        using Grainulator::fastmath::tanh;
+        const f4 g = set1(g_), res = set1(resonance_);
+        const f4 invTwoVT = set1(static_cast<float>(1.0 / (2.0 * kVT)));
+        const f4 invTwoSr = set1(1.0f / (2.0f * sampleRate_));
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const f4 x = LoadPair(left, right, s);
+            f4 dV = mul(sub(set1(0.0f), g), add(tanh(mul(add(x, mul(res, V_[3])), invTwoVT)), tV_[0]));
+            V_[0] = add(V_[0], mul(add(dV, dV_[0]), invTwoSr));
+            dV_[0] = dV;
+            tV_[0] = tanh(mul(V_[0], invTwoVT));
+            for (int i = 1; i < 4; ++i)
+            {
+                dV = mul(g, sub(tV_[i - 1], tV_[i]));
+                V_[i] = add(V_[i], mul(add(dV, dV_[i]), invTwoSr));
+                dV_[i] = dV;
+                tV_[i] = tanh(mul(V_[i], invTwoVT));
+            }
+            StorePair(V_[3], left, right, s);
+        }
+    }
+
+private:
+
+    static constexpr double kVT = 0.312;  // Same thermal voltage as ImprovedMoog
+
+    float sampleRate_;
+    float g_;
+    float resonance_;
+    stereo_ladder_detail::f4 V_[4];
+    stereo_ladder_detail::f4 dV_[4];
+    stereo_ladder_detail::f4 tV_[4];
+};
+
+#endif // STEREO_LADDERS_H
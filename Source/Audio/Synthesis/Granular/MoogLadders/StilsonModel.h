@@ -61,6 +61,7 @@ class StilsonMoog : public LadderFilterBase
 	StilsonMoog(float sampleRate) : LadderFilterBase(sampleRate)
 	{
 		std::fill(std::begin(state), std::end(state), 0.0);
+		output = 0.0;
 		SetCutoff(1000.0f);
 		SetResonance(0.10f);
 	}
@@ -127,6 +128,12 @@ class StilsonMoog : public LadderFilterBase
 		SetResonance(resonance);
 	}
 	
+	virtual void Reset() override
+	{
+		std::fill(std::begin(state), std::end(state), 0.0);
+		output = 0.0;
+	}
+	
 private:
 	
 	double p;
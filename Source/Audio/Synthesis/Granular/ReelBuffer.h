@@ -11,10 +11,14 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <algorithm>
 #include <atomic>
+#include <memory>
+
+#include "ReelPagePool.h"
 
 namespace Grainulator {
 
@@ -48,6 +52,15 @@ enum class RecordMode : int {
 
 /// ReelBuffer - holds audio data and splice markers
 /// Capacity: 2.5 minutes @ 48kHz stereo = 7,200,000 samples per channel
+///
+/// Audio is stored per channel in fixed-size pages taken from a ReelPagePool
+/// the first time recording or loading writes into them; pages never written
+/// read as silence from a shared zero page. Each page carries guard bands that
+/// mirror its neighbours, and the reel ends wrap the same way (the band before
+/// sample 0 mirrors the last samples, the samples after `length` mirror the
+/// first ones), so interpolators read wrapped neighbours without bounds checks
+/// or modulo (see ReadHermite / ReadLinear). Every write path here keeps the
+/// guards coherent.
 class ReelBuffer {
 public:
     // Constants
@@ -57,9 +70,16 @@ class ReelBuffer {
     static constexpr size_t kMaxRecordSamples = 120 * kDefaultSampleRate;  // 2 minutes recording limit
     static constexpr size_t kMaxSplices = 300;
     static constexpr size_t kNumChannels = 2;  // Stereo
-
-    ReelBuffer()
-        : sample_rate_(kDefaultSampleRate)
+    static constexpr size_t kGuardSamples = ReelPagePool::kGuardSamples;  // Covers the Hermite window (-1..+2)
+    static constexpr size_t kPageSamples = ReelPagePool::kPageSamples;
+    static constexpr size_t kMaxPages = (kMaxSamples + kPageSamples - 1) / kPageSamples;
+
+    /// pool: page allocator, usually shared by all reels of an engine. Without
+    /// one the reel reserves a private pool big enough for itself.
+    explicit ReelBuffer(ReelPagePool* pool = nullptr)
+        : pool_(pool)
+        , num_pages_(0)
+        , sample_rate_(kDefaultSampleRate)
         , length_(0)
         , num_splices_(0)
         , is_recording_(false)
@@ -67,13 +87,19 @@ class ReelBuffer {
         , record_mode_(static_cast<int>(RecordMode::OneShot))
         , feedback_(0.0f)
         , loop_length_(0)
+        , dropped_record_frames_(0)
     {
-        // Allocate audio buffers
-        buffer_left_ = new float[kMaxSamples];
-        buffer_right_ = new float[kMaxSamples];
+        if (!pool_) {
+            own_pool_ = std::make_unique<ReelPagePool>(kNumChannels * kMaxPages);
+            pool_ = own_pool_.get();
+        }
 
-        // Initialize to silence
-        Clear();
+        // Nothing is resident until written
+        for (size_t channel = 0; channel < kNumChannels; ++channel) {
+            for (size_t page = 0; page < kMaxPages; ++page) {
+                pages_[channel][page].store(ZeroPage(), std::memory_order_relaxed);
+            }
+        }
 
         // Create default splice covering entire buffer
         splices_[0].start_sample = 0;
@@ -84,8 +110,7 @@ class ReelBuffer {
     }
 
     ~ReelBuffer() {
-        delete[] buffer_left_;
-        delete[] buffer_right_;
+        ReleasePages();
     }
 
     // ========== Buffer Access ==========
@@ -103,12 +128,12 @@ class ReelBuffer {
         size_t index = static_cast<size_t>(position);
         float frac = position - static_cast<float>(index);
 
-        // Get buffer pointer
-        const float* buffer = (channel == 0) ? buffer_left_ : buffer_right_;
+        // Sample pointer (the page guard holds the next page's first sample)
+        const float* buffer = At(channel, index);
 
         // Linear interpolation
-        float sample1 = buffer[index];
-        float sample2 = (index + 1 < length_) ? buffer[index + 1] : sample1;
+        float sample1 = buffer[0];
+        float sample2 = (index + 1 < length_) ? buffer[1] : sample1;
 
         return sample1 + frac * (sample2 - sample1);
     }
@@ -116,40 +141,120 @@ class ReelBuffer {
     /// Get sample at integer position (no interpolation)
     float GetSampleInt(size_t channel, size_t position) const {
         if (position >= length_) return 0.0f;
-        return (channel == 0) ? buffer_left_[position] : buffer_right_[position];
+        return *At(channel, position);
+    }
+
+    // ---------- Unchecked reads (caller guarantees the range) ----------
+
+    /// 4-point Hermite read of both channels at index + frac, wrapping around
+    /// the buffer ends. Requires index < length; taps outside come from the guards.
+    void ReadHermite(size_t index, float frac, float& left, float& right) const {
+        left = Hermite(At(0, index), frac);
+        right = Hermite(At(1, index), frac);
+    }
+
+    /// Linear read matching GetSample() for 0 <= position <= length - 1.
+    float ReadLinear(size_t channel, float position) const {
+        size_t index = static_cast<size_t>(position);
+        float frac = position - static_cast<float>(index);
+        const float* buffer = At(channel, index);
+        float sample1 = buffer[0];
+        float sample2 = buffer[1];
+        return sample1 + frac * (sample2 - sample1);
     }
 
     /// Write sample at position
     void SetSample(size_t channel, size_t position, float value) {
-        if (position >= kMaxSamples) return;
-
-        if (channel == 0) {
-            buffer_left_[position] = value;
-        } else {
-            buffer_right_[position] = value;
-        }
+        if (position >= kMaxSamples || channel >= kNumChannels) return;
+        if (!StoreSample(channel, position, value)) return;
 
         // Update length if writing beyond current length
         if (position >= length_) {
             length_ = position + 1;
+            RefreshGuardBands();
+        } else if (InGuardedRange(position)) {
+            RefreshGuardBands();
         }
     }
 
-    /// Get pointer to buffer for bulk operations (use with care)
-    const float* GetBufferPointer(size_t channel) const {
-        return (channel == 0) ? buffer_left_ : buffer_right_;
+    /// Replace the contents with numSamples of audio (right may be null for mono).
+    /// Stops short if the page pool runs out. Not for the audio thread.
+    void Load(const float* left, const float* right, size_t numSamples) {
+        Clear();
+        Append(left, right, numSamples);
     }
 
-    float* GetBufferPointerMutable(size_t channel) {
-        return (channel == 0) ? buffer_left_ : buffer_right_;
+    /// Add numSamples of audio after the current end (right may be null for mono)
+    /// and publish the new length, so playback can use a reel while it is still
+    /// being filled. Returns the number of samples added (short if the reel is
+    /// full or the page pool runs out). Not for the audio thread.
+    size_t Append(const float* left, const float* right, size_t numSamples) {
+        const size_t start = length_;
+        numSamples = std::min(numSamples, kMaxSamples - start);
+        const float* sources[kNumChannels] = {left, right ? right : left};
+
+        size_t written = 0;
+        while (written < numSamples) {
+            const size_t index = start + written;
+            const size_t page = index >> ReelPagePool::kPageShift;
+            const size_t offset = index & ReelPagePool::kPageMask;
+            const size_t count = std::min(kPageSamples - offset, numSamples - written);
+            float* data[kNumChannels] = {EnsurePage(0, page), EnsurePage(1, page)};
+            if (!data[0] || !data[1]) break;
+
+            for (size_t channel = 0; channel < kNumChannels; ++channel) {
+                std::memcpy(data[channel] + offset, sources[channel] + written, count * sizeof(float));
+                // The page's head is mirrored at the end of the previous page
+                if (offset < kGuardSamples && page > 0) {
+                    std::memcpy(Page(channel, page - 1) + kPageSamples + offset, data[channel] + offset,
+                                std::min(count, kGuardSamples - offset) * sizeof(float));
+                }
+            }
+            written += count;
+        }
+        if (written > 0) {
+            SetLength(start + written);
+        }
+        return written;
+    }
+
+    /// Copy [start, start + count) of both channels out; returns the number copied.
+    size_t CopyOut(size_t start, size_t count, float* left, float* right) const {
+        if (start >= length_) return 0;
+        count = std::min(count, length_ - start);
+        size_t copied = 0;
+        while (copied < count) {
+            const size_t index = start + copied;
+            const size_t run = std::min(count - copied, kPageSamples - (index & ReelPagePool::kPageMask));
+            std::memcpy(left + copied, At(0, index), run * sizeof(float));
+            std::memcpy(right + copied, At(1, index), run * sizeof(float));
+            copied += run;
+        }
+        return copied;
+    }
+
+    /// Resident bytes this reel accounts for: its pages (guards and OS page
+    /// rounding included), the reel object itself and, with a private pool,
+    /// that pool's faulted-in reserve. A shared pool reports its own reserve.
+    size_t GetMemoryUsage() const {
+        size_t pages = num_pages_.load(std::memory_order_relaxed);
+        if (own_pool_) {
+            pages += own_pool_->GetWarmPages();
+        }
+        return pages * pool_->GetResidentPageBytes() + sizeof(*this);
+    }
+
+    /// Recorded frames lost because the page pool was exhausted
+    uint64_t GetDroppedRecordFrames() const {
+        return dropped_record_frames_.load(std::memory_order_relaxed);
     }
 
     // ========== Buffer Management ==========
 
-    /// Clear the entire buffer to silence
+    /// Clear the buffer to silence. Only pages that were written are touched
+    /// (they go back to the pool). Not for the audio thread.
     void Clear() {
-        std::memset(buffer_left_, 0, kMaxSamples * sizeof(float));
-        std::memset(buffer_right_, 0, kMaxSamples * sizeof(float));
+        ReleasePages();
         length_ = 0;
 
         // Reset to single default splice
@@ -162,6 +267,7 @@ class ReelBuffer {
     /// Set the buffer length (in samples)
     void SetLength(size_t length) {
         length_ = std::min(length, kMaxSamples);
+        RefreshGuardBands();
 
         // Update default splice to cover entire buffer
         if (num_splices_ > 0) {
@@ -172,6 +278,13 @@ class ReelBuffer {
     size_t GetLength() const { return length_; }
     size_t GetMaxLength() const { return kMaxSamples; }
 
+    /// Rewrite the wrap-around guards from the current contents (O(kGuardSamples)).
+    void RefreshGuardBands() {
+        for (size_t channel = 0; channel < kNumChannels; ++channel) {
+            RefreshGuardBands(channel);
+        }
+    }
+
     float GetSampleRate() const { return sample_rate_; }
     void SetSampleRate(float rate) { sample_rate_ = rate; }
 
@@ -307,8 +420,14 @@ class ReelBuffer {
             return;
         }
 
-        buffer_left_[record_position_] = left;
-        buffer_right_[record_position_] = right;
+        if (!StoreSample(0, record_position_, left) || !StoreSample(1, record_position_, right)) {
+            dropped_record_frames_.fetch_add(1, std::memory_order_relaxed);
+            StopRecording();  // Out of reel memory
+            return;
+        }
+        if (InGuardedRange(record_position_)) {
+            RefreshGuardBands();
+        }
         record_position_++;
     }
 
@@ -316,40 +435,19 @@ class ReelBuffer {
     /// In OneShot mode: destructive write, stops at kMaxRecordSamples
     /// In LiveLoop mode: blends with existing buffer using feedback, wraps at loop_length_
     void RecordSampleWithFeedback(float left, float right) {
-        if (!is_recording_) return;
-
-        RecordMode mode = GetRecordMode();
+        if (WriteRecordSample(left, right)) {
+            RefreshGuardBands();
+        }
+    }
 
-        if (mode == RecordMode::OneShot) {
-            if (record_position_ >= kMaxRecordSamples) {
-                StopRecording();
-                return;
-            }
-            buffer_left_[record_position_] = left;
-            buffer_right_[record_position_] = right;
-            record_position_++;
-            // Update length as we record so playback can see new content
-            if (record_position_ > length_) {
-                length_ = record_position_;
-            }
-        } else {
-            // LiveLoop mode
-            if (loop_length_ == 0) return;
-            if (record_position_ >= loop_length_) {
-                record_position_ = 0;
-            }
-            float fb = feedback_.load(std::memory_order_relaxed);
-            float mixL = buffer_left_[record_position_] * fb + left;
-            float mixR = buffer_right_[record_position_] * fb + right;
-            // Soft-clip to prevent runaway accumulation and guard against NaN/Inf
-            if (!std::isfinite(mixL)) mixL = 0.0f;
-            if (!std::isfinite(mixR)) mixR = 0.0f;
-            buffer_left_[record_position_] = std::max(-4.0f, std::min(4.0f, mixL));
-            buffer_right_[record_position_] = std::max(-4.0f, std::min(4.0f, mixR));
-            record_position_++;
-            if (record_position_ >= loop_length_) {
-                record_position_ = 0;
-            }
+    /// Block form of RecordSampleWithFeedback; refreshes the guards once per block.
+    void RecordBlockWithFeedback(const float* left, const float* right, size_t numFrames) {
+        bool guardsDirty = false;
+        for (size_t i = 0; i < numFrames && is_recording_; ++i) {
+            guardsDirty |= WriteRecordSample(left[i], right[i]);
+        }
+        if (guardsDirty) {
+            RefreshGuardBands();
         }
     }
 
@@ -380,14 +478,14 @@ class ReelBuffer {
         for (size_t i = 0; i < output_size; ++i) {
             size_t start = static_cast<size_t>(i * samples_per_pixel);
             size_t end = static_cast<size_t>((i + 1) * samples_per_pixel);
-            end = std::min(end, length_);
+            end = std::min(end, length_.load());
 
             float min_val = 1.0f;
             float max_val = -1.0f;
 
             for (size_t j = start; j < end; ++j) {
                 // Mix L+R for mono overview
-                float sample = (buffer_left_[j] + buffer_right_[j]) * 0.5f;
+                float sample = (*At(0, j) + *At(1, j)) * 0.5f;
                 min_val = std::min(min_val, sample);
                 max_val = std::max(max_val, sample);
             }
@@ -398,10 +496,14 @@ class ReelBuffer {
     }
 
 private:
-    float* buffer_left_;
-    float* buffer_right_;
+    ReelPagePool* pool_;
+    std::unique_ptr<ReelPagePool> own_pool_;  // Only when constructed without a pool
+    // ZeroPage() until first written. Published with release, so a thread that
+    // sees a page also sees its zeroed contents and adopted guards.
+    std::atomic<float*> pages_[kNumChannels][kMaxPages];
+    std::atomic<size_t> num_pages_;           // Pages taken from the pool
     float sample_rate_;
-    size_t length_;  // Current used length in samples
+    std::atomic<size_t> length_;  // Used length in samples; grows while a streaming load runs
 
     SpliceMarker splices_[kMaxSplices];
     size_t num_splices_;
@@ -411,8 +513,176 @@ class ReelBuffer {
     std::atomic<int> record_mode_;       // RecordMode enum (set from UI, read from audio thread)
     std::atomic<float> feedback_;        // 0-1 feedback for LiveLoop (set from UI, read from audio thread)
     size_t loop_length_;                 // Loop length in samples for LiveLoop mode
+    std::atomic<uint64_t> dropped_record_frames_;  // Audio thread writes, UI reads
+
+    /// Hermite cubic over p[-1..2]
+    static float Hermite(const float* p, float frac) {
+        const float y0 = p[-1];
+        const float y1 = p[0];
+        const float y2 = p[1];
+        const float y3 = p[2];
+        const float c0 = y1;
+        const float c1 = 0.5f * (y2 - y0);
+        const float c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+        const float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+        return ((c3 * frac + c2) * frac + c1) * frac + c0;
+    }
+
+    // ---------- Pages ----------
+
+    /// Stand-in for pages that were never written. Never written through.
+    static float* ZeroPage() { return const_cast<float*>(ReelPagePool::ZeroPage()); }
+
+    float* Page(size_t channel, size_t page) const {
+        return pages_[channel][page].load(std::memory_order_acquire);
+    }
+
+    bool IsAllocated(size_t channel, size_t page) const {
+        return Page(channel, page) != ReelPagePool::ZeroPage();
+    }
+
+    /// Address of a sample; neighbours up to kGuardSamples away are readable
+    const float* At(size_t channel, size_t index) const {
+        return Page(channel, index >> ReelPagePool::kPageShift) + (index & ReelPagePool::kPageMask);
+    }
+
+    /// Page for writing, taken from the pool on first use (lock-free).
+    /// Returns nullptr if the pool is exhausted.
+    float* EnsurePage(size_t channel, size_t page) {
+        float* data = Page(channel, page);
+        if (data != ReelPagePool::ZeroPage()) return data;
+
+        data = pool_->Acquire();
+        if (!data) return nullptr;
+
+        // Adopt what the neighbours already mirror of this page (and vice versa)
+        // so every guard stays coherent: head <- previous page's trailing guard,
+        // tail <- next page's leading guard.
+        constexpr size_t G = kGuardSamples;
+        constexpr size_t N = kPageSamples;
+        if (page > 0) {
+            const float* prev = Page(channel, page - 1);
+            std::memcpy(data - G, prev + N - G, G * sizeof(float));
+            std::memcpy(data, prev + N, G * sizeof(float));
+        }
+        if (page + 1 < kMaxPages) {
+            const float* next = Page(channel, page + 1);
+            std::memcpy(data + N, next, G * sizeof(float));
+            std::memcpy(data + N - G, next - G, G * sizeof(float));
+        }
+
+        pages_[channel][page].store(data, std::memory_order_release);
+        num_pages_.fetch_add(1, std::memory_order_relaxed);
+        return data;
+    }
+
+    /// Write one sample and its mirrors in neighbouring page guards. With
+    /// allocate=false an unallocated page is left alone and only the mirrors
+    /// are written. Returns false if a page was needed but unavailable.
+    bool StoreSample(size_t channel, size_t index, float value, bool allocate = true) {
+        constexpr size_t G = kGuardSamples;
+        constexpr size_t N = kPageSamples;
+        const size_t page = index >> ReelPagePool::kPageShift;
+        const size_t offset = index & ReelPagePool::kPageMask;
+
+        float* data = allocate ? EnsurePage(channel, page) : Page(channel, page);
+        if (!data) return false;
+        if (data != ReelPagePool::ZeroPage()) {
+            data[offset] = value;
+        }
+        if (offset < G && page > 0 && IsAllocated(channel, page - 1)) {
+            Page(channel, page - 1)[N + offset] = value;
+        }
+        if (offset >= N - G && page + 1 < kMaxPages && IsAllocated(channel, page + 1)) {
+            // Leading guard of the next page (index offset - N, which is negative)
+            Page(channel, page + 1)[static_cast<ptrdiff_t>(offset) - static_cast<ptrdiff_t>(N)] = value;
+        }
+        return true;
+    }
+
+    void ReleasePages() {
+        for (size_t channel = 0; channel < kNumChannels; ++channel) {
+            for (size_t page = 0; page < kMaxPages; ++page) {
+                if (IsAllocated(channel, page)) {
+                    float* data = Page(channel, page);
+                    pages_[channel][page].store(ZeroPage(), std::memory_order_release);
+                    pool_->Release(data);
+                }
+            }
+        }
+        num_pages_.store(0, std::memory_order_relaxed);
+    }
+
+    /// True if a write at position is mirrored into a wrap-around guard
+    bool InGuardedRange(size_t position) const {
+        return position < kGuardSamples || position + kGuardSamples >= length_;
+    }
+
+    void RefreshGuardBands(size_t channel) {
+        if (length_ == 0) return;
+
+        // The pages holding the first and last sample carry the wrapped copies
+        if (!EnsurePage(channel, 0) || !EnsurePage(channel, (length_ - 1) >> ReelPagePool::kPageShift)) return;
+
+        // The modulo only matters for reels shorter than the guard
+        float* first = Page(channel, 0);
+        for (size_t k = 0; k < kGuardSamples; ++k) {
+            StoreSample(channel, length_ + k, *At(channel, k % length_), false);
+            first[-static_cast<ptrdiff_t>(k) - 1] = *At(channel, length_ - 1 - (k % length_));
+        }
+    }
+
+    /// One recorded sample pair. Returns true if the guard bands need refreshing.
+    bool WriteRecordSample(float left, float right) {
+        if (!is_recording_) return false;
+
+        RecordMode mode = GetRecordMode();
+
+        if (mode == RecordMode::OneShot) {
+            if (record_position_ >= kMaxRecordSamples) {
+                StopRecording();
+                return false;
+            }
+            if (!StoreSample(0, record_position_, left) || !StoreSample(1, record_position_, right)) {
+                dropped_record_frames_.fetch_add(1, std::memory_order_relaxed);
+                StopRecording();  // Out of reel memory
+                return false;
+            }
+            record_position_++;
+            // Update length as we record so playback can see new content
+            if (record_position_ > length_) {
+                length_ = record_position_;
+                return true;
+            }
+            return InGuardedRange(record_position_ - 1);
+        }
+
+        // LiveLoop mode
+        if (loop_length_ == 0) return false;
+        if (record_position_ >= loop_length_) {
+            record_position_ = 0;
+        }
+        float fb = feedback_.load(std::memory_order_relaxed);
+        float mixL = *At(0, record_position_) * fb + left;
+        float mixR = *At(1, record_position_) * fb + right;
+        // Soft-clip to prevent runaway accumulation and guard against NaN/Inf
+        if (!std::isfinite(mixL)) mixL = 0.0f;
+        if (!std::isfinite(mixR)) mixR = 0.0f;
+        // Keeps looping when the pool is exhausted; the lost frames are counted
+        const bool storedL = StoreSample(0, record_position_, std::max(-4.0f, std::min(4.0f, mixL)));
+        const bool storedR = StoreSample(1, record_position_, std::max(-4.0f, std::min(4.0f, mixR)));
+        if (!storedL || !storedR) {
+            dropped_record_frames_.fetch_add(1, std::memory_order_relaxed);
+        }
+        const bool guarded = InGuardedRange(record_position_);
+        record_position_++;
+        if (record_position_ >= loop_length_) {
+            record_position_ = 0;
+        }
+        return guarded;
+    }
 
-    // Prevent copying (large buffers)
+    // Prevent copying (owns pages)
     ReelBuffer(const ReelBuffer&) = delete;
     ReelBuffer& operator=(const ReelBuffer&) = delete;
 };
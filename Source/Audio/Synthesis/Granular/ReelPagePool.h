@@ -0,0 +1,229 @@
+//
+//  ReelPagePool.h
+//  Grainulator
+//
+//  Page allocator for reel audio. The pool reserves address space for all of
+//  its pages up front but only pages that are written become resident.
+//  Acquire() is lock-free and safe on the audio thread; Release() hands the
+//  physical memory back to the OS and must be called off the audio thread.
+//
+//  Once Start() has run, a helper thread keeps a small reserve of pages
+//  already faulted in, and Acquire() hands those out first, so recording into
+//  a new page does not take page faults on the audio thread.
+//
+
+#ifndef REELPAGEPOOL_H
+#define REELPAGEPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "WakeSemaphore.h"
+
+namespace Grainulator {
+
+class ReelPagePool {
+public:
+    static constexpr size_t kPageShift = 16;
+    static constexpr size_t kPageSamples = size_t(1) << kPageShift;  // ~1.4 s @ 48kHz
+    static constexpr size_t kPageMask = kPageSamples - 1;
+    static constexpr size_t kGuardSamples = 4;  // Guard band on each side of a page
+    static constexpr size_t kPageFloats = kPageSamples + 2 * kGuardSamples;
+    static constexpr size_t kPageBytes = kPageFloats * sizeof(float);
+    static constexpr size_t kWarmPages = 8;  // Faulted-in reserve (~11 s of one stereo recording)
+
+    explicit ReelPagePool(size_t maxPages)
+        : region_(nullptr)
+        , capacity_(0)
+        , resident_page_bytes_(kPageBytes)
+        , in_use_(0)
+        , free_head_(0)
+        , warm_head_(0)
+        , warm_count_(0)
+        , running_(false)
+    {
+        if (maxPages == 0 || maxPages >= UINT32_MAX) return;
+
+        int flags = MAP_PRIVATE | MAP_ANON;
+#if defined(MAP_NORESERVE)
+        flags |= MAP_NORESERVE;
+#endif
+        void* region = mmap(nullptr, maxPages * kStrideBytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (region == MAP_FAILED) return;
+
+        region_ = static_cast<uint8_t*>(region);
+        capacity_ = maxPages;
+
+        // The guards push a page just past a whole number of OS pages; the
+        // partly used OS page at the end is resident too
+        const long os_page = sysconf(_SC_PAGESIZE);
+        if (os_page > 0) {
+            const size_t granule = static_cast<size_t>(os_page);
+            resident_page_bytes_ = std::min((kPageBytes + granule - 1) / granule * granule, kStrideBytes);
+        }
+        next_ = std::make_unique<std::atomic<uint32_t>[]>(maxPages);
+
+        // Free list holds every page; low addresses are handed out first
+        for (size_t i = 0; i < maxPages; ++i) {
+            next_[i].store(i + 1 < maxPages ? static_cast<uint32_t>(i + 2) : 0, std::memory_order_relaxed);
+        }
+        free_head_.store(1, std::memory_order_relaxed);
+    }
+
+    ~ReelPagePool() {
+        Stop();
+        if (region_) {
+            munmap(region_, capacity_ * kStrideBytes);
+        }
+    }
+
+    /// Spawns the thread that keeps kWarmPages faulted in. Not real-time safe.
+    void Start() {
+        if (!region_ || running_.load(std::memory_order_acquire)) return;
+        running_.store(true, std::memory_order_release);
+        thread_ = std::thread([this]() { WarmLoop(); });
+        wake_.post();
+    }
+
+    void Stop() {
+        if (!running_.load(std::memory_order_acquire)) return;
+        running_.store(false, std::memory_order_release);
+        wake_.post();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    /// Take a zeroed page. Returns a pointer to sample 0 of the page (the guard
+    /// bands are at [-kGuardSamples, 0) and [kPageSamples, kPageSamples + kGuardSamples)),
+    /// or nullptr when the pool is exhausted. Lock-free. Faulted-in pages come
+    /// first; only when the reserve has run dry is a page first touched by its writer.
+    float* Acquire() {
+        uint32_t slot = Pop(warm_head_);
+        if (slot != 0) {
+            warm_count_.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            slot = Pop(free_head_);
+            if (slot == 0) return nullptr;
+        }
+        in_use_.fetch_add(1, std::memory_order_relaxed);
+        if (running_.load(std::memory_order_relaxed) && warm_count_.load(std::memory_order_relaxed) < kWarmPages) {
+            wake_.post();
+        }
+        return PageData(slot - 1);
+    }
+
+    /// Return a page. Its memory is dropped (and reads back as zero when reused).
+    /// Makes a system call; do not call from the audio thread.
+    void Release(float* page) {
+        if (!page || !region_) return;
+        uint8_t* base = reinterpret_cast<uint8_t*>(page - kGuardSamples);
+        const size_t index = static_cast<size_t>(base - region_) / kStrideBytes;
+        if (index >= capacity_) return;
+
+        // Replacing the mapping frees the physical pages and zero-fills on next touch
+        int flags = MAP_PRIVATE | MAP_ANON | MAP_FIXED;
+#if defined(MAP_NORESERVE)
+        flags |= MAP_NORESERVE;
+#endif
+        if (mmap(base, kStrideBytes, PROT_READ | PROT_WRITE, flags, -1, 0) == MAP_FAILED) {
+            std::memset(base, 0, kPageBytes);
+        }
+
+        Push(free_head_, static_cast<uint32_t>(index + 1));
+        in_use_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Read-only page of zeros (guards included) standing in for unallocated pages
+    static const float* ZeroPage() {
+        static const float zeros[kPageFloats] = {};
+        return zeros + kGuardSamples;
+    }
+
+    size_t GetCapacityPages() const { return capacity_; }
+    size_t GetPagesInUse() const { return in_use_.load(std::memory_order_relaxed); }
+    size_t GetWarmPages() const { return warm_count_.load(std::memory_order_relaxed); }
+    /// Resident bytes behind one handed-out or warm page, guards and OS page rounding included
+    size_t GetResidentPageBytes() const { return resident_page_bytes_; }
+    /// Resident bytes of the pool: pages in use plus the faulted-in reserve
+    size_t GetBytesInUse() const { return (GetPagesInUse() + GetWarmPages()) * resident_page_bytes_; }
+
+private:
+    // Page slots are padded to 64 KB so Release() can remap them individually
+    static constexpr size_t kStrideBytes = (kPageBytes + 65535) & ~size_t(65535);
+
+    float* PageData(size_t index) const {
+        return reinterpret_cast<float*>(region_ + index * kStrideBytes) + kGuardSamples;
+    }
+
+    // Both free lists are Treiber stacks over next_; a page is on at most one
+    uint32_t Pop(std::atomic<uint64_t>& list) {
+        uint64_t head = list.load(std::memory_order_acquire);
+        for (;;) {
+            const uint32_t slot = static_cast<uint32_t>(head);
+            if (slot == 0) return 0;
+            const uint64_t next = (head & ~uint64_t(0xFFFFFFFFu)) + (uint64_t(1) << 32) + next_[slot - 1].load(std::memory_order_relaxed);
+            if (list.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return slot;
+            }
+        }
+    }
+
+    void Push(std::atomic<uint64_t>& list, uint32_t slot) {
+        uint64_t head = list.load(std::memory_order_relaxed);
+        for (;;) {
+            next_[slot - 1].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            const uint64_t desired = (head & ~uint64_t(0xFFFFFFFFu)) + (uint64_t(1) << 32) + slot;
+            if (list.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    // Moves pages from the free list to the reserve, writing every byte so the
+    // OS backs them here rather than on the audio thread
+    void WarmLoop() {
+        for (;;) {
+            wake_.wait();
+            if (!running_.load(std::memory_order_acquire)) return;
+            while (warm_count_.load(std::memory_order_relaxed) < kWarmPages) {
+                const uint32_t slot = Pop(free_head_);
+                if (slot == 0) break;
+                std::memset(PageData(slot - 1) - kGuardSamples, 0, kPageBytes);
+                Push(warm_head_, slot);
+                warm_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    uint8_t* region_;
+    size_t capacity_;
+    size_t resident_page_bytes_;
+    std::atomic<size_t> in_use_;
+
+    // Treiber stacks of free pages: low 32 bits = slot + 1 (0 = empty), high 32 bits = ABA tag.
+    // The warm stack holds pages the helper thread has already faulted in.
+    std::atomic<uint64_t> free_head_;
+    std::atomic<uint64_t> warm_head_;
+    std::atomic<size_t> warm_count_;
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+
+    std::thread thread_;
+    std::atomic<bool> running_;
+    WakeSemaphore wake_;
+
+    ReelPagePool(const ReelPagePool&) = delete;
+    ReelPagePool& operator=(const ReelPagePool&) = delete;
+};
+
+} // namespace Grainulator
+
+#endif // REELPAGEPOOL_H
@@ -101,6 +101,10 @@ void LooperVoice::WrapPlayhead(float loopStartSample, float loopEndSample) {
     }
 }
 
+bool LooperVoice::IsSilent() const {
+    return !isPlaying_ || !buffer_ || buffer_->GetLength() == 0;
+}
+
 void LooperVoice::Render(float* outLeft, float* outRight, size_t numFrames) {
     if (!outLeft || !outRight) {
         return;
@@ -136,22 +140,25 @@ void LooperVoice::Render(float* outLeft, float* outRight, size_t numFrames) {
     // Short crossfade at loop seam to suppress clicks.
     const float crossfadeSamples = std::min(128.0f, std::max(8.0f, loopLength * 0.1f));
 
+    // Every read position below lies within [loopStartSample, loopEndSample] (clamped
+    // to [0, maxIndex] for rounding), so the unchecked reads are in range.
     for (size_t i = 0; i < numFrames; ++i) {
-        float left = buffer_->GetSample(0, playheadSamples_);
-        float right = buffer_->GetSample(1, playheadSamples_);
+        const float readPos = std::clamp(playheadSamples_, 0.0f, maxIndex);
+        float left = buffer_->ReadLinear(0, readPos);
+        float right = buffer_->ReadLinear(1, readPos);
 
         if (step > 0.0f && playheadSamples_ >= (loopEndSample - crossfadeSamples)) {
             const float fade = std::clamp((playheadSamples_ - (loopEndSample - crossfadeSamples)) / crossfadeSamples, 0.0f, 1.0f);
             const float wrappedPos = loopStartSample + (playheadSamples_ - (loopEndSample - crossfadeSamples));
-            const float wrappedL = buffer_->GetSample(0, wrappedPos);
-            const float wrappedR = buffer_->GetSample(1, wrappedPos);
+            const float wrappedL = buffer_->ReadLinear(0, std::clamp(wrappedPos, 0.0f, maxIndex));
+            const float wrappedR = buffer_->ReadLinear(1, std::clamp(wrappedPos, 0.0f, maxIndex));
             left = left * (1.0f - fade) + wrappedL * fade;
             right = right * (1.0f - fade) + wrappedR * fade;
         } else if (step < 0.0f && playheadSamples_ <= (loopStartSample + crossfadeSamples)) {
             const float fade = std::clamp(((loopStartSample + crossfadeSamples) - playheadSamples_) / crossfadeSamples, 0.0f, 1.0f);
             const float wrappedPos = loopEndSample - ((loopStartSample + crossfadeSamples) - playheadSamples_);
-            const float wrappedL = buffer_->GetSample(0, wrappedPos);
-            const float wrappedR = buffer_->GetSample(1, wrappedPos);
+            const float wrappedL = buffer_->ReadLinear(0, std::clamp(wrappedPos, 0.0f, maxIndex));
+            const float wrappedR = buffer_->ReadLinear(1, std::clamp(wrappedPos, 0.0f, maxIndex));
             left = left * (1.0f - fade) + wrappedL * fade;
             right = right * (1.0f - fade) + wrappedR * fade;
         }
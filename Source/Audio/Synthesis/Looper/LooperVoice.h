@@ -26,6 +26,8 @@ class LooperVoice {
 
     void SetPlaying(bool playing) { isPlaying_ = playing; }
     bool IsPlaying() const { return isPlaying_; }
+    // The looper has no tail: it is silent whenever it is not playing a loop
+    bool IsSilent() const;
 
     void SetPosition(float normalizedPosition);
     float GetPosition() const;
@@ -25,10 +25,11 @@ constexpr int kRetriggerLowBlocks = 1;
 constexpr int kSixOpEngineMin = 2;
 constexpr int kSixOpEngineMax = 4;
 constexpr int kSixOpPatchCount = 32;
+constexpr float kOutputLevelDecay = 0.99f;  // Per 12-sample block
 static_assert(plaits::kBlockSize == 12, "Plaits block size changed; update kInternalBlockSize.");
 }
 
-PlaitsVoice::PlaitsVoice()
+PlaitsVoice::PlaitsVoice(PlaitsVoiceArena* arena)
     : sample_rate_(48000.0f)
     , note_(60.0f)
     , harmonics_(0.5f)
@@ -56,10 +57,12 @@ PlaitsVoice::PlaitsVoice()
     , block_out_{}
     , block_aux_{}
     , block_read_index_(kInternalBlockSize)
+    , output_level_(0.0f)
+    , arena_(arena)
 {
     allocator_ = std::make_unique<stmlib::BufferAllocator>();
     voice_ = std::make_unique<plaits::Voice>();
-    allocator_->Init(voice_allocator_buffer_.data(), voice_allocator_buffer_.size());
+    allocator_->Init(arena_->bytes, PlaitsVoiceArena::kSize);
     voice_->Init(allocator_.get());
 }
 
@@ -68,7 +71,7 @@ PlaitsVoice::~PlaitsVoice() = default;
 void PlaitsVoice::Init(float sample_rate) {
     sample_rate_ = std::max(1.0f, sample_rate);
 
-    allocator_->Init(voice_allocator_buffer_.data(), voice_allocator_buffer_.size());
+    allocator_->Init(arena_->bytes, PlaitsVoiceArena::kSize);
     voice_->Init(allocator_.get());
 
     note_ = 60.0f;
@@ -94,45 +97,59 @@ void PlaitsVoice::Init(float sample_rate) {
     six_op_custom_patch_index_ = 0;
     six_op_custom_bank_.fill(0);
     six_op_custom_slots_active_ = false;
+    silence_.Init(sample_rate_);
     plaits::ClearDesktopUserDataSlot(2);
     plaits::ClearDesktopUserDataSlot(3);
     plaits::ClearDesktopUserDataSlot(4);
     block_out_.fill(0.0f);
     block_aux_.fill(0.0f);
     block_read_index_ = kInternalBlockSize;
+    output_level_ = 0.0f;
 }
 
-void PlaitsVoice::Render(float* out, float* aux, size_t size) {
-    if (!out && !aux) {
-        return;
-    }
-
-    for (size_t i = 0; i < size; ++i) {
-        if (block_read_index_ >= kInternalBlockSize) {
-            renderNextBlock();
+void PlaitsVoice::RenderAdd(float* out, float* aux, size_t size, float gain) {
+    size_t i = 0;
+    while (i < size) {
+        if (block_read_index_ < kInternalBlockSize) {
+            // Rest of a block that straddled the previous call
+            const size_t count = std::min(kInternalBlockSize - block_read_index_, size - i);
+            for (size_t k = 0; k < count; ++k) {
+                out[i + k] += block_out_[block_read_index_ + k] * gain;
+                aux[i + k] += block_aux_[block_read_index_ + k] * gain;
+            }
+            block_read_index_ += count;
+            i += count;
+        } else if (size - i >= kInternalBlockSize) {
+            renderNextBlock(out + i, aux + i, gain);
+            i += kInternalBlockSize;
+        } else {
+            block_out_.fill(0.0f);
+            block_aux_.fill(0.0f);
+            renderNextBlock(block_out_.data(), block_aux_.data(), 1.0f);
             block_read_index_ = 0;
         }
-        if (out) {
-            out[i] = block_out_[block_read_index_];
-        }
-        if (aux) {
-            aux[i] = block_aux_[block_read_index_];
-        }
-        ++block_read_index_;
     }
 }
 
+bool PlaitsVoice::IsSilent() const {
+    return !gate_state_ && trigger_pulse_blocks_ == 0 && !retrigger_pending_ &&
+           force_low_blocks_ == 0 && silence_.IsSilent();
+}
+
 void PlaitsVoice::SetEngine(int engine) {
     current_engine_ = std::clamp(engine, kMinEngine, kMaxEngine);
+    silence_.Wake();
     applySixOpUserDataState();
 }
 
 void PlaitsVoice::SetNote(float note) {
     note_ = std::clamp(note, 0.0f, 127.0f);
+    silence_.Wake();
 }
 
 void PlaitsVoice::SetHarmonics(float value) {
     harmonics_ = std::clamp(value, 0.0f, 1.0f);
+    silence_.Wake();
     if (current_engine_ >= kSixOpEngineMin && current_engine_ <= kSixOpEngineMax) {
         const int quantized_index = std::clamp(
             static_cast<int>(std::lround(harmonics_ * static_cast<float>(kSixOpPatchCount - 1))),
@@ -145,10 +162,12 @@ void PlaitsVoice::SetHarmonics(float value) {
 
 void PlaitsVoice::SetTimbre(float value) {
     timbre_ = std::clamp(value, 0.0f, 1.0f);
+    silence_.Wake();
 }
 
 void PlaitsVoice::SetMorph(float value) {
     morph_ = std::clamp(value, 0.0f, 1.0f);
+    silence_.Wake();
 }
 
 void PlaitsVoice::Trigger(bool state) {
@@ -168,6 +187,7 @@ void PlaitsVoice::Trigger(bool state) {
 
 void PlaitsVoice::SetLevel(float value) {
     level_ = std::clamp(value, 0.0f, 1.0f);
+    silence_.Wake();
 }
 
 void PlaitsVoice::SetHarmonicsModAmount(float amount) {
@@ -197,6 +217,7 @@ void PlaitsVoice::SetLPGAttack(float attack) {
 
 void PlaitsVoice::SetLPGBypass(bool bypass) {
     lpg_bypass_ = bypass;
+    silence_.Wake();
 }
 
 void PlaitsVoice::SetSixOpCustomEnabled(bool enabled) {
@@ -262,7 +283,7 @@ void PlaitsVoice::applySixOpUserDataState(bool force_reload) {
     }
 }
 
-void PlaitsVoice::renderNextBlock() {
+void PlaitsVoice::renderNextBlock(float* out, float* aux, float gain) {
     const bool timbre_mod_patched = std::fabs(timbre_mod_amount_) > 1.0e-6f;
     const bool morph_mod_patched = std::fabs(morph_mod_amount_) > 1.0e-6f;
 
@@ -307,16 +328,19 @@ void PlaitsVoice::renderNextBlock() {
     plaits::Voice::Frame frames[plaits::kBlockSize] = {};
     voice_->Render(patch, modulations, frames, plaits::kBlockSize);
 
+    int peak = 0;
+    const float scale = level_ / 32768.0f;
     for (size_t i = 0; i < kInternalBlockSize; ++i) {
-        block_out_[i] = std::clamp(
-            (static_cast<float>(frames[i].out) / 32768.0f) * level_,
-            -1.0f,
-            1.0f);
-        block_aux_[i] = std::clamp(
-            (static_cast<float>(frames[i].aux) / 32768.0f) * level_,
-            -1.0f,
-            1.0f);
+        peak = std::max(peak, std::max(std::abs(static_cast<int>(frames[i].out)),
+                                       std::abs(static_cast<int>(frames[i].aux))));
+        out[i] += std::clamp(static_cast<float>(frames[i].out) * scale, -1.0f, 1.0f) * gain;
+        aux[i] += std::clamp(static_cast<float>(frames[i].aux) * scale, -1.0f, 1.0f) * gain;
     }
+    // Measured before the level scaling so a muted voice keeps its tail. A
+    // closed LPG still toggles the last bit, so +/-1 LSB (-90 dBFS) is silence.
+    const float block_peak = peak > 1 ? static_cast<float>(peak) / 32768.0f : 0.0f;
+    silence_.ProcessPeak(block_peak, kInternalBlockSize);
+    output_level_ = std::max(block_peak * level_, output_level_ * kOutputLevelDecay);
 
     if (force_low_blocks_ > 0) {
         --force_low_blocks_;
@@ -13,6 +13,8 @@
 #include <cstdint>
 #include <memory>
 
+#include "SilenceDetector.h"
+
 namespace stmlib {
 class BufferAllocator;
 }
@@ -23,13 +25,33 @@ class Voice;
 
 namespace Grainulator {
 
+// Working memory for one voice's Plaits engines. A polyphonic pool allocates
+// its arenas as one array, so each voice's buffers start on a cache line.
+struct alignas(64) PlaitsVoiceArena {
+    static constexpr size_t kSize = 65536;
+    char bytes[kSize];
+};
+
 class PlaitsVoice {
 public:
-    PlaitsVoice();
+    // The arena is owned by the caller and must outlive the voice.
+    explicit PlaitsVoice(PlaitsVoiceArena* arena);
     ~PlaitsVoice();
 
     void Init(float sample_rate);
-    void Render(float* out, float* aux, size_t size);
+
+    // Adds size samples of out/aux, scaled by gain, to the given buffers.
+    // Whole 12-sample Plaits blocks are converted straight into them; only a
+    // block split across calls is buffered.
+    void RenderAdd(float* out, float* aux, size_t size, float gain);
+
+    // True once the gate is released and the output has decayed to silence;
+    // RenderAdd() may be skipped until a trigger or parameter change wakes it.
+    bool IsSilent() const;
+
+    // Recent output peak (decays with a ~25 ms time constant), used to pick
+    // the quietest voice to steal.
+    float GetOutputLevel() const { return output_level_; }
 
     // Plaits alternate firmware model range: 0-23.
     void SetEngine(int engine);
@@ -64,7 +86,6 @@ class PlaitsVoice {
     void LoadUserWavetable(const float* data, int numSamples, int frameSize = 0);
 
 private:
-    static constexpr size_t kVoiceBufferSize = 65536;
     static constexpr size_t kInternalBlockSize = 12;
 
     float sample_rate_;
@@ -94,12 +115,14 @@ class PlaitsVoice {
     std::array<float, kInternalBlockSize> block_out_;
     std::array<float, kInternalBlockSize> block_aux_;
     size_t block_read_index_;
+    float output_level_;
+    SilenceDetector silence_;
 
-    std::array<char, kVoiceBufferSize> voice_allocator_buffer_;
+    PlaitsVoiceArena* arena_;
     std::unique_ptr<stmlib::BufferAllocator> allocator_;
     std::unique_ptr<plaits::Voice> voice_;
     void applySixOpUserDataState(bool force_reload = false);
-    void renderNextBlock();
+    void renderNextBlock(float* out, float* aux, float gain);
 
     PlaitsVoice(const PlaitsVoice&) = delete;
     PlaitsVoice& operator=(const PlaitsVoice&) = delete;
@@ -66,6 +66,7 @@ void RingsVoice::Init(float sample_rate) {
     note_queue_count_ = 0;
     patch_ = base_patch_;
     use_string_synth_ = false;
+    silence_.Init(sample_rate);
 }
 
 void RingsVoice::Render(const float* in, float* out, float* aux, size_t size) {
@@ -160,6 +161,9 @@ void RingsVoice::Render(const float* in, float* out, float* aux, size_t size) {
             part_.Process(performance_, patch_, input_buffer_, render_l_, render_r_, block);
         }
 
+        // Measured before the level scaling so a muted voice keeps its tail
+        silence_.Process(render_l_, render_r_, block);
+
         for (size_t i = 0; i < block; ++i) {
             out[rendered + i] = render_l_[i] * level_;
             aux[rendered + i] = render_r_[i] * level_;
@@ -169,6 +173,11 @@ void RingsVoice::Render(const float* in, float* out, float* aux, size_t size) {
     }
 }
 
+bool RingsVoice::IsSilent() const {
+    return note_queue_count_ == 0 && pending_model_.load(std::memory_order_relaxed) < 0 &&
+           pending_polyphony_.load(std::memory_order_relaxed) < 0 && silence_.IsSilent();
+}
+
 void RingsVoice::NoteOn(int midiNote, int velocity) {
     float note = std::clamp(static_cast<float>(midiNote), 0.0f, 127.0f);
     float accent = std::clamp(static_cast<float>(velocity) / 127.0f, 0.0f, 1.0f);
@@ -192,6 +201,7 @@ void RingsVoice::NoteOff(int midiNote) {
 
 void RingsVoice::SetNote(float midiNote) {
     note_ = std::clamp(midiNote, 0.0f, 127.0f);
+    silence_.Wake();
 }
 
 void RingsVoice::SetStructure(float value) {
@@ -222,6 +232,7 @@ void RingsVoice::SetModel(int modelIndex) {
 
 void RingsVoice::SetLevel(float value) {
     level_ = std::clamp(value, 0.0f, 1.0f);
+    silence_.Wake();
 }
 
 void RingsVoice::SetStructureMod(float amount) {
@@ -252,14 +263,17 @@ void RingsVoice::SetPolyphony(int polyphony) {
 
 void RingsVoice::SetChord(int chord) {
     chord_ = std::max(0, std::min(chord, rings::kNumChords - 1));
+    silence_.Wake();
 }
 
 void RingsVoice::SetFM(float fm) {
     fm_ = std::max(0.0f, std::min(1.0f, fm));
+    silence_.Wake();
 }
 
 void RingsVoice::SetInternalExciter(bool internal) {
     internal_exciter_ = internal;
+    silence_.Wake();
 }
 
 } // namespace Grainulator
@@ -18,6 +18,8 @@
 #include "rings/dsp/patch.h"
 #include "rings/dsp/string_synth_part.h"
 
+#include "SilenceDetector.h"
+
 namespace Grainulator {
 
 class RingsVoice {
@@ -46,6 +48,10 @@ class RingsVoice {
     // Render with external excitation input
     void Render(const float* in, float* out, float* aux, size_t size);
 
+    // True once no strum is queued and the resonator has rung out. The caller
+    // must also check that the exciter input is silent before skipping Render().
+    bool IsSilent() const;
+
     // Modulation (adds to base value, clamped to 0-0.9995)
     void SetStructureMod(float amount);
     void SetBrightnessMod(float amount);
@@ -104,6 +110,8 @@ class RingsVoice {
     float brightness_mod_;
     float damping_mod_;
     float position_mod_;
+
+    SilenceDetector silence_;
 };
 
 } // namespace Grainulator
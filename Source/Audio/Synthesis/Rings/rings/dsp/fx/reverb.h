@@ -46,6 +46,8 @@ class Reverb {
     engine_.SetLFOFrequency(LFO_2, 0.3f / 48000.0f);
     lp_ = 0.7f;
     diffusion_ = 0.625f;
+    lp_decay_1_ = 0.0f;
+    lp_decay_2_ = 0.0f;
   }
   
   void Process(float* left, float* right, size_t size) {
@@ -49,6 +49,7 @@ class Plucker {
     comb_filter_.Init();
     remaining_samples_ = 0;
     comb_filter_period_ = 0.0f;
+    comb_filter_gain_ = 0.0f;
   }
   
   void Trigger(float frequency, float cutoff, float position) {
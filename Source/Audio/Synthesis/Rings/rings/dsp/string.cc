@@ -61,6 +61,7 @@ void String::Init(bool enable_dispersion) {
   previous_dispersion_ = 0.0f;
   dispersion_noise_ = 0.0f;
   curved_bridge_ = 0.0f;
+  src_phase_ = 0.0f;
   previous_damping_compensation_ = 0.0f;
   
   out_sample_[0] = out_sample_[1] = 0.0f;
@@ -0,0 +1,75 @@
+//
+//  SilenceDetector.h
+//  Grainulator
+//
+//  Tracks how long a voice's output has stayed below the noise floor so the
+//  engine can stop rendering it. A voice reports IsSilent() only once it has
+//  no note/gate pending AND its output has been quiet for the hold time, so
+//  release and filter tails always finish before the voice sleeps.
+//
+
+#ifndef SILENCEDETECTOR_H
+#define SILENCEDETECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+
+namespace Grainulator {
+
+class SilenceDetector {
+public:
+    static constexpr float kThreshold = 1.0e-5f;    // -100 dBFS
+    static constexpr float kDefaultHoldSeconds = 0.05f;
+
+    SilenceDetector() : hold_samples_(1), quiet_samples_(0), wake_(false) {}
+
+    void Init(float sample_rate, float hold_seconds = kDefaultHoldSeconds) {
+        hold_samples_ = static_cast<size_t>(std::max(1.0f, sample_rate * hold_seconds));
+        quiet_samples_ = 0;
+        wake_.store(false, std::memory_order_relaxed);
+    }
+
+    /// Restarts the hold time, for changes that can make sound without a note
+    /// (level, engine, bypass...). Safe from any thread.
+    void Wake() { wake_.store(true, std::memory_order_relaxed); }
+
+    /// Accounts for a rendered block. right may be null for mono voices.
+    void Process(const float* left, const float* right, size_t size) {
+        float peak = 0.0f;
+        for (size_t i = 0; i < size; ++i) {
+            peak = std::max(peak, std::fabs(left[i]));
+        }
+        if (right) {
+            for (size_t i = 0; i < size; ++i) {
+                peak = std::max(peak, std::fabs(right[i]));
+            }
+        }
+        ProcessPeak(peak, size);
+    }
+
+    /// Same as Process() for callers that already know the block peak.
+    void ProcessPeak(float peak, size_t size) {
+        const bool woken = wake_.exchange(false, std::memory_order_relaxed);
+        // Written this way round so a NaN peak counts as sound
+        if (woken || !(peak <= kThreshold)) {
+            quiet_samples_ = 0;
+        } else {
+            quiet_samples_ = std::min(quiet_samples_ + size, hold_samples_);
+        }
+    }
+
+    bool IsSilent() const {
+        return quiet_samples_ >= hold_samples_ && !wake_.load(std::memory_order_relaxed);
+    }
+
+private:
+    size_t hold_samples_;
+    size_t quiet_samples_;
+    std::atomic<bool> wake_;
+};
+
+} // namespace Grainulator
+
+#endif // SILENCEDETECTOR_H
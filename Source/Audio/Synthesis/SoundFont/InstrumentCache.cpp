@@ -0,0 +1,366 @@
+//
+//  InstrumentCache.cpp
+//  Grainulator
+//
+//  Binary instrument cache: file layout, validation, mapping and writing.
+//
+
+#include "InstrumentCache.h"
+#include "SampleLoader.h"
+#include "WavSamplerVoice.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Grainulator {
+
+namespace {
+
+// Layout: CacheHeader, CacheDependency[], CacheSample[], NUL-separated
+// strings, then each sample's interleaved stereo data in its encoding, 64-byte aligned.
+// Records are stored in this build's native layout; the version and record
+// size reject a file written by a different one.
+
+constexpr char kMagic[8] = {'G', 'R', 'N', 'S', 'M', 'P', 'L', '\0'};
+constexpr uint32_t kVersion = 2;
+constexpr uint64_t kNoString = UINT64_MAX;
+constexpr size_t kDataAlign = 64;
+constexpr size_t kTouchStride = 4096;
+
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sampleRecordBytes;     // sizeof(WavSample)
+    uint64_t fileBytes;             // Whole file
+    uint64_t streamHeadFrames;
+    uint32_t sampleCount;
+    uint32_t dependencyCount;
+    uint32_t useSfzVelocity;
+    uint32_t compact;
+    uint64_t totalMemoryBytes;
+    uint64_t dependenciesOffset;
+    uint64_t samplesOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsBytes;
+    SampleMap::NoteEntry noteTable[128];
+    char instrumentName[256];
+};
+
+struct CacheDependency {
+    uint64_t size;
+    int64_t mtimeSeconds;
+    int64_t mtimeNanos;
+    uint64_t pathOffset;            // Into the strings
+};
+
+struct CacheSample {
+    WavSample sample;               // data and streamPath zeroed
+    uint64_t dataOffset;            // From the start of the file
+    uint64_t streamPathOffset;      // Into the strings, or kNoString
+};
+
+struct FileStamp {
+    uint64_t size;
+    int64_t mtimeSeconds;
+    int64_t mtimeNanos;
+};
+
+bool statFile(const char* path, FileStamp& stamp) {
+    struct stat st;
+    if (stat(path, &st) != 0) return false;
+    stamp.size = static_cast<uint64_t>(st.st_size);
+    stamp.mtimeSeconds = static_cast<int64_t>(st.st_mtime);
+#if defined(__APPLE__)
+    stamp.mtimeNanos = static_cast<int64_t>(st.st_mtimespec.tv_nsec);
+#else
+    stamp.mtimeNanos = static_cast<int64_t>(st.st_mtim.tv_nsec);
+#endif
+    return true;
+}
+
+uint64_t alignUp(uint64_t value, uint64_t align) {
+    return (value + align - 1) / align * align;
+}
+
+uint64_t sampleDataBytes(const WavSample& s) {
+    return static_cast<uint64_t>(s.headFrames) * SampleFrameBytes(s.encoding);
+}
+
+bool writeZeros(FILE* f, uint64_t count) {
+    static const char zeros[kDataAlign] = {};
+    while (count > 0) {
+        const size_t n = static_cast<size_t>(count < kDataAlign ? count : kDataAlign);
+        if (std::fwrite(zeros, 1, n, f) != n) return false;
+        count -= n;
+    }
+    return true;
+}
+
+} // namespace
+
+std::string InstrumentCachePath(const std::string& cacheDirectory, const std::string& sourcePath,
+                                const SampleLoadOptions& options) {
+    // FNV-1a over the source path and load settings
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* bytes, size_t count) {
+        const unsigned char* p = static_cast<const unsigned char*>(bytes);
+        for (size_t i = 0; i < count; ++i) {
+            hash ^= p[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(sourcePath.data(), sourcePath.size());
+    const uint64_t head = options.streamHeadFrames;
+    mix(&head, sizeof(head));
+    const uint8_t compact = options.compact ? 1 : 0;
+    mix(&compact, sizeof(compact));
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.gsmc", static_cast<unsigned long long>(hash));
+    std::string path = cacheDirectory;
+    while (!path.empty() && path.back() == '/') path.pop_back();
+    return path + "/" + name;
+}
+
+SampleMap* LoadInstrumentCache(const std::string& cachePath, const SampleLoadOptions& options,
+                               SampleLoadControl* control) {
+    const int fd = open(cachePath.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(CacheHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    const uint64_t fileBytes = static_cast<uint64_t>(st.st_size);
+    void* mapping = mmap(nullptr, fileBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return nullptr;
+
+    const char* base = static_cast<const char*>(mapping);
+    auto reject = [&]() -> SampleMap* {
+        munmap(mapping, fileBytes);
+        return nullptr;
+    };
+
+    CacheHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion
+        || header.sampleRecordBytes != sizeof(WavSample) || header.fileBytes != fileBytes
+        || header.streamHeadFrames != options.streamHeadFrames
+        || header.compact != (options.compact ? 1u : 0u) || header.sampleCount == 0) {
+        return reject();
+    }
+
+    // Every table must lie inside the file, and the strings must end in a NUL
+    const uint64_t depsEnd = header.dependenciesOffset + uint64_t(header.dependencyCount) * sizeof(CacheDependency);
+    const uint64_t samplesEnd = header.samplesOffset + uint64_t(header.sampleCount) * sizeof(CacheSample);
+    const uint64_t stringsEnd = header.stringsOffset + header.stringsBytes;
+    if (depsEnd > fileBytes || samplesEnd > fileBytes || stringsEnd > fileBytes
+        || header.stringsBytes == 0 || base[stringsEnd - 1] != '\0') {
+        return reject();
+    }
+    const char* strings = base + header.stringsOffset;
+
+    // Note ranges index samples[] directly when the region table is built
+    for (const SampleMap::NoteEntry& entry : header.noteTable) {
+        if (entry.sampleCount < 0) return reject();
+        if (entry.sampleCount > 0
+            && (entry.firstSampleIndex < 0
+                || int64_t(entry.firstSampleIndex) + entry.sampleCount > int64_t(header.sampleCount))) {
+            return reject();
+        }
+    }
+
+    // Stale once any source file has changed
+    for (uint32_t i = 0; i < header.dependencyCount; ++i) {
+        CacheDependency dep;
+        std::memcpy(&dep, base + header.dependenciesOffset + i * sizeof(CacheDependency), sizeof(dep));
+        FileStamp stamp;
+        if (dep.pathOffset >= header.stringsBytes || !statFile(strings + dep.pathOffset, stamp)
+            || stamp.size != dep.size || stamp.mtimeSeconds != dep.mtimeSeconds
+            || stamp.mtimeNanos != dep.mtimeNanos) {
+            return reject();
+        }
+    }
+
+    SampleMap* map = new SampleMap{};
+    map->sampleCount = static_cast<int>(header.sampleCount);
+    map->samples = new WavSample[map->sampleCount];
+    map->totalMemoryBytes = static_cast<size_t>(header.totalMemoryBytes);
+    map->useSfzVelocity = header.useSfzVelocity != 0;
+    std::memcpy(map->noteTable, header.noteTable, sizeof(map->noteTable));
+    std::memcpy(map->instrumentName, header.instrumentName, sizeof(map->instrumentName));
+    map->instrumentName[sizeof(map->instrumentName) - 1] = '\0';
+    map->cacheMapping = mapping;
+    map->cacheMappingBytes = static_cast<size_t>(fileBytes);
+
+    for (int i = 0; i < map->sampleCount; ++i) {
+        CacheSample record;
+        std::memcpy(&record, base + header.samplesOffset + i * sizeof(CacheSample), sizeof(record));
+        WavSample& s = record.sample;
+        if (s.headFrames > s.frameCount || s.encoding > SampleEncoding::Int24 || record.dataOffset % kDataAlign != 0
+            || record.dataOffset > fileBytes || sampleDataBytes(s) > fileBytes - record.dataOffset
+            || (record.streamPathOffset != kNoString && record.streamPathOffset >= header.stringsBytes)) {
+            delete[] map->samples;
+            delete map;
+            return reject();
+        }
+        // The mapping is read-only; the sampler never writes sample data
+        s.data = const_cast<char*>(base + record.dataOffset);
+        s.streamPath = record.streamPathOffset != kNoString
+            ? const_cast<char*>(strings + record.streamPathOffset) : nullptr;
+        map->samples[i] = s;
+    }
+
+    // Fault the data in here rather than on the audio thread's first note
+    madvise(mapping, fileBytes, MADV_WILLNEED);
+    if (control) control->total.store(map->sampleCount, std::memory_order_relaxed);
+    volatile char sink = 0;
+    for (int i = 0; i < map->sampleCount; ++i) {
+        if (control && control->IsCancelled()) {
+            ReleaseInstrumentCache(map);
+            delete[] map->samples;
+            delete map;
+            return nullptr;
+        }
+        const char* data = reinterpret_cast<const char*>(map->samples[i].data);
+        const uint64_t bytes = sampleDataBytes(map->samples[i]);
+        for (uint64_t b = 0; b < bytes; b += kTouchStride) {
+            sink = sink + data[b];
+        }
+        if (control) control->completed.fetch_add(1, std::memory_order_relaxed);
+    }
+    (void)sink;
+
+    // Touched file pages can still be evicted and read back on the audio
+    // thread. Pin them; failing that (RLIMIT_MEMLOCK), move the data to
+    // anonymous memory, which is no worse than a map decoded without the cache.
+    if (mlock(mapping, fileBytes) != 0) {
+        void* copy = mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if (copy != MAP_FAILED) {
+            std::memcpy(copy, mapping, fileBytes);
+            char* copyBase = static_cast<char*>(copy);
+            for (int i = 0; i < map->sampleCount; ++i) {
+                WavSample& s = map->samples[i];
+                s.data = copyBase + (static_cast<const char*>(s.data) - base);
+                if (s.streamPath) s.streamPath = copyBase + (s.streamPath - base);
+            }
+            munmap(mapping, fileBytes);
+            map->cacheMapping = copy;
+        }
+    }
+    return map;
+}
+
+bool WriteInstrumentCache(const std::string& cachePath, const SampleLoadOptions& options, const SampleMap& map,
+                          const std::vector<std::string>& dependencies) {
+    if (map.sampleCount <= 0) return false;
+
+    // Stamp the sources first: a file that changes while writing makes the cache stale, not wrong
+    std::vector<FileStamp> stamps(dependencies.size());
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        if (!statFile(dependencies[i].c_str(), stamps[i])) return false;
+    }
+
+    std::string strings;
+    auto addString = [&strings](const char* text) -> uint64_t {
+        const uint64_t offset = strings.size();
+        strings.append(text);
+        strings.push_back('\0');
+        return offset;
+    };
+
+    std::vector<CacheDependency> deps(dependencies.size());
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        deps[i].size = stamps[i].size;
+        deps[i].mtimeSeconds = stamps[i].mtimeSeconds;
+        deps[i].mtimeNanos = stamps[i].mtimeNanos;
+        deps[i].pathOffset = addString(dependencies[i].c_str());
+    }
+
+    CacheHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.sampleRecordBytes = sizeof(WavSample);
+    header.streamHeadFrames = options.streamHeadFrames;
+    header.compact = options.compact ? 1 : 0;
+    header.sampleCount = static_cast<uint32_t>(map.sampleCount);
+    header.dependencyCount = static_cast<uint32_t>(deps.size());
+    header.useSfzVelocity = map.useSfzVelocity ? 1 : 0;
+    header.totalMemoryBytes = map.totalMemoryBytes;
+    std::memcpy(header.noteTable, map.noteTable, sizeof(header.noteTable));
+    std::memcpy(header.instrumentName, map.instrumentName, sizeof(header.instrumentName));
+
+    std::vector<CacheSample> records(map.sampleCount);
+    for (int i = 0; i < map.sampleCount; ++i) {
+        records[i] = CacheSample{};
+        records[i].sample = map.samples[i];
+        records[i].sample.data = nullptr;
+        records[i].sample.streamPath = nullptr;
+        records[i].streamPathOffset = map.samples[i].streamPath
+            ? addString(map.samples[i].streamPath) : kNoString;
+    }
+    if (strings.empty()) strings.push_back('\0');
+
+    header.dependenciesOffset = alignUp(sizeof(CacheHeader), 8);
+    header.samplesOffset = alignUp(header.dependenciesOffset + deps.size() * sizeof(CacheDependency), 8);
+    header.stringsOffset = header.samplesOffset + records.size() * sizeof(CacheSample);
+    header.stringsBytes = strings.size();
+
+    uint64_t offset = header.stringsOffset + header.stringsBytes;
+    for (int i = 0; i < map.sampleCount; ++i) {
+        offset = alignUp(offset, kDataAlign);
+        records[i].dataOffset = offset;
+        offset += sampleDataBytes(map.samples[i]);
+    }
+    header.fileBytes = offset;
+
+    // Unique temporary name: two loads of one instrument may write at once
+    std::string tempPath = cachePath + ".XXXXXX";
+    const int fd = mkstemp(&tempPath[0]);
+    if (fd < 0) return false;
+    FILE* f = fdopen(fd, "wb");
+    if (!f) {
+        close(fd);
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+    ok = ok && writeZeros(f, header.dependenciesOffset - sizeof(header));
+    ok = ok && (deps.empty() || std::fwrite(deps.data(), sizeof(CacheDependency), deps.size(), f) == deps.size());
+    ok = ok && writeZeros(f, header.samplesOffset - (header.dependenciesOffset + deps.size() * sizeof(CacheDependency)));
+    ok = ok && std::fwrite(records.data(), sizeof(CacheSample), records.size(), f) == records.size();
+    ok = ok && std::fwrite(strings.data(), 1, strings.size(), f) == strings.size();
+    uint64_t written = header.stringsOffset + header.stringsBytes;
+    for (int i = 0; ok && i < map.sampleCount; ++i) {
+        ok = writeZeros(f, records[i].dataOffset - written);
+        const uint64_t bytes = sampleDataBytes(map.samples[i]);
+        ok = ok && (bytes == 0 || std::fwrite(map.samples[i].data, 1, bytes, f) == bytes);
+        written = records[i].dataOffset + bytes;
+    }
+    ok = (std::fclose(f) == 0) && ok;
+
+    if (!ok || std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void ReleaseInstrumentCache(SampleMap* map) {
+    if (map && map->cacheMapping) {
+        munmap(map->cacheMapping, map->cacheMappingBytes);
+        map->cacheMapping = nullptr;
+        map->cacheMappingBytes = 0;
+    }
+}
+
+} // namespace Grainulator
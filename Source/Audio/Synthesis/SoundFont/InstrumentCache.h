@@ -0,0 +1,53 @@
+//
+//  InstrumentCache.h
+//  Grainulator
+//
+//  Binary cache of loaded sampler instruments. One file per instrument
+//  source (an .sfz file or an mx.samples directory) holds the region records,
+//  the note table and the decoded sample data exactly as WavSamplerVoice keeps
+//  them. The next load memory-maps the file and points the SampleMap straight
+//  into it, skipping parsing and decoding.
+//
+//  A cache file lists the files it was built from with their size and mtime
+//  and is only used while all of them still match. Files are written to a
+//  temporary name and renamed, so a reader never sees a partial one.
+//
+//  Loader thread only; not real-time safe.
+//
+
+#ifndef INSTRUMENTCACHE_H
+#define INSTRUMENTCACHE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Grainulator {
+
+struct SampleMap;
+struct SampleLoadControl;
+struct SampleLoadOptions;
+
+/// Cache file for sourcePath loaded with the given storage options
+std::string InstrumentCachePath(const std::string& cacheDirectory, const std::string& sourcePath,
+                                const SampleLoadOptions& options);
+
+/// Maps a cache file that is still valid and returns a SampleMap over it
+/// (samples, note table, name; the region table is left to the caller).
+/// Pages are touched and locked before returning so the audio thread does not
+/// fault them in; if they cannot be locked the data is copied to anonymous
+/// memory instead. Returns nullptr on a missing, stale, inconsistent or
+/// unreadable file, or when control is cancelled.
+SampleMap* LoadInstrumentCache(const std::string& cachePath, const SampleLoadOptions& options,
+                               SampleLoadControl* control);
+
+/// Writes map to cachePath, recording the current size and mtime of each
+/// dependency. Returns false (and leaves no file) on any I/O error.
+bool WriteInstrumentCache(const std::string& cachePath, const SampleLoadOptions& options, const SampleMap& map,
+                          const std::vector<std::string>& dependencies);
+
+/// Unmaps the data of a SampleMap returned by LoadInstrumentCache
+void ReleaseInstrumentCache(SampleMap* map);
+
+} // namespace Grainulator
+#endif // INSTRUMENTCACHE_H
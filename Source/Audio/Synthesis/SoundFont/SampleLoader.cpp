@@ -0,0 +1,146 @@
+//
+//  SampleLoader.cpp
+//  Grainulator
+//
+//  Parallel WAV decoding for instrument loads. Uses dr_wav for decoding.
+//
+
+#include "SampleLoader.h"
+#include "dr_wav.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Grainulator {
+
+namespace {
+
+// Decoding is part disk, part CPU: past a handful of threads the disk is the limit
+constexpr unsigned kMaxLoadThreads = 8;
+
+// Reads frames to interleaved stereo: mono is duplicated, channels past the second dropped
+template <typename T>
+bool readStereo(drwav& wav, size_t frames, T* out, drwav_uint64 (*read)(drwav*, drwav_uint64, T*)) {
+    const unsigned channels = wav.channels;
+    if (channels == 2) {
+        read(&wav, frames, out);
+        return true;
+    }
+
+    T* raw = new (std::nothrow) T[frames * channels];
+    if (!raw) return false;
+    read(&wav, frames, raw);
+    for (size_t i = 0; i < frames; ++i) {
+        out[i * 2]     = raw[i * channels];
+        out[i * 2 + 1] = (channels >= 2) ? raw[i * channels + 1] : raw[i * channels];
+    }
+    delete[] raw;
+    return true;
+}
+
+} // namespace
+
+DecodedWav DecodeWavFile(const std::string& path, size_t maxFrames, bool compact) {
+    DecodedWav result{};
+    result.valid = false;
+
+    drwav wav;
+    if (!drwav_init_file(&wav, path.c_str(), nullptr)) {
+        return result;
+    }
+
+    size_t fileFrames = wav.totalPCMFrameCount;
+    size_t totalFrames = std::min(fileFrames, maxFrames);
+
+    SampleEncoding encoding = SampleEncoding::Float32;
+    if (compact) {
+        const unsigned format = wav.translatedFormatTag;
+        const bool narrow = format == DR_WAVE_FORMAT_ALAW || format == DR_WAVE_FORMAT_MULAW
+            || (format == DR_WAVE_FORMAT_PCM && wav.bitsPerSample <= 16);
+        encoding = narrow ? SampleEncoding::Int16 : SampleEncoding::Int24;
+    }
+
+    // Allocate stereo interleaved buffer
+    uint8_t* stereoData = new (std::nothrow) uint8_t[totalFrames * SampleFrameBytes(encoding)];
+    if (!stereoData) {
+        drwav_uninit(&wav);
+        return result;
+    }
+
+    bool ok = false;
+    switch (encoding) {
+        case SampleEncoding::Float32:
+            ok = readStereo(wav, totalFrames, reinterpret_cast<float*>(stereoData), drwav_read_pcm_frames_f32);
+            break;
+        case SampleEncoding::Int16:
+            ok = readStereo(wav, totalFrames, reinterpret_cast<int16_t*>(stereoData), drwav_read_pcm_frames_s16);
+            break;
+        case SampleEncoding::Int24: {
+            // dr_wav widens to 32 bits; a 24-bit source comes back exact, wider ones are rounded
+            int32_t* wide = new (std::nothrow) int32_t[totalFrames * 2];
+            ok = wide && readStereo(wav, totalFrames, wide, drwav_read_pcm_frames_s32);
+            for (size_t i = 0; ok && i < totalFrames * 2; ++i) {
+                const int32_t value = static_cast<int32_t>(std::min<int64_t>(
+                    (static_cast<int64_t>(wide[i]) + 128) >> 8, 8388607));
+                uint8_t* out = stereoData + i * 3;
+                out[0] = static_cast<uint8_t>(value);
+                out[1] = static_cast<uint8_t>(value >> 8);
+                out[2] = static_cast<uint8_t>(value >> 16);
+            }
+            delete[] wide;
+            break;
+        }
+    }
+
+    drwav_uninit(&wav);
+    if (!ok) {
+        delete[] stereoData;
+        return result;
+    }
+
+    result.data = stereoData;
+    result.encoding = encoding;
+    result.frameCount = fileFrames;
+    result.headFrames = totalFrames;
+    result.sampleRate = static_cast<int>(wav.sampleRate);
+    result.valid = true;
+    return result;
+}
+
+void RunLoadJobs(int count, const std::function<void(int)>& job, SampleLoadControl* control) {
+    if (count <= 0) return;
+
+    std::atomic<int> next{0};
+    auto worker = [&]() {
+        for (;;) {
+            if (control && control->IsCancelled()) return;
+            const int index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count) return;
+            job(index);
+            if (control) control->completed.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    const unsigned threads = std::min({hardware, kMaxLoadThreads, static_cast<unsigned>(count)});
+
+    std::vector<std::thread> helpers;
+    helpers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        try {
+            helpers.emplace_back(worker);
+        } catch (const std::system_error&) {
+            break;  // Out of threads: the ones running share the rest
+        }
+    }
+    worker();
+    for (auto& t : helpers) {
+        t.join();
+    }
+}
+
+} // namespace Grainulator
@@ -0,0 +1,94 @@
+//
+//  SampleLoader.h
+//  Grainulator
+//
+//  Shared instrument-loading helpers for WavSamplerVoice and the SFZ parser:
+//  WAV decoding into the sampler's interleaved stereo layout, and a parallel
+//  loop that decodes an instrument's files on a short-lived pool of threads.
+//  A SampleLoadControl carries progress out of a load and a cancel request in.
+//
+//  Everything here runs on the loader thread; none of it is real-time safe.
+//
+
+#ifndef SAMPLELOADER_H
+#define SAMPLELOADER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Grainulator {
+
+/// How a WavSample's frames are stored. The integer encodings are scaled by
+/// 2^-15 and 2^-23, the same factors dr_wav uses, so 16- and 24-bit sources
+/// play back bit-identical to Float32.
+enum class SampleEncoding : uint8_t {
+    Float32 = 0,
+    Int16,              // int16_t L, R
+    Int24               // Packed little-endian, 3 bytes per channel
+};
+
+inline size_t SampleFrameBytes(SampleEncoding encoding) {
+    switch (encoding) {
+        case SampleEncoding::Int16: return 2 * sizeof(int16_t);
+        case SampleEncoding::Int24: return 2 * 3;
+        default:                    return 2 * sizeof(float);
+    }
+}
+
+/// How an instrument's samples are held in memory
+struct SampleLoadOptions {
+    size_t streamHeadFrames = 0;    // > 0: keep only this many frames resident (disk streaming)
+    bool compact = false;           // Integer encodings instead of Float32
+};
+
+/// Progress and cancellation for one instrument load. Safe from any thread.
+struct SampleLoadControl {
+    std::atomic<bool> cancelled{false};
+    std::atomic<int> completed{0};  // Work items finished
+    std::atomic<int> total{0};      // Work items in this load, 0 until known
+
+    void Begin() {
+        cancelled.store(false, std::memory_order_relaxed);
+        completed.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+    }
+    bool IsCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+
+    /// 0-1 over the known work items
+    float Progress() const {
+        const int t = total.load(std::memory_order_relaxed);
+        if (t <= 0) return 0.0f;
+        const int c = completed.load(std::memory_order_relaxed);
+        return c >= t ? 1.0f : static_cast<float>(c) / static_cast<float>(t);
+    }
+};
+
+struct DecodedWav {
+    void* data;         // Interleaved stereo, headFrames frames (new uint8_t[], caller owns)
+    SampleEncoding encoding;
+    size_t frameCount;  // Frames in the file
+    size_t headFrames;  // Frames decoded into data
+    int sampleRate;
+    bool valid;
+};
+
+/// Decodes at most maxFrames frames of a WAV file to interleaved stereo.
+/// Mono is duplicated and channels past the second are dropped. compact
+/// picks Int16 for sources of up to 16 bits and Int24 for the rest (wider
+/// and float sources are rounded to 24 bits).
+DecodedWav DecodeWavFile(const std::string& path, size_t maxFrames, bool compact);
+
+/// Releases DecodedWav::data or WavSample::data
+inline void FreeSampleData(void* data) { delete[] static_cast<uint8_t*>(data); }
+
+/// Runs job(0..count-1) on up to hardware_concurrency threads (the calling
+/// thread included) and counts each finished job in control. Jobs not yet
+/// started when control is cancelled are skipped; the caller checks
+/// IsCancelled() afterwards.
+void RunLoadJobs(int count, const std::function<void(int)>& job, SampleLoadControl* control);
+
+} // namespace Grainulator
+#endif // SAMPLELOADER_H
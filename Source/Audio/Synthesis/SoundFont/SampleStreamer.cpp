@@ -0,0 +1,215 @@
+//
+//  SampleStreamer.cpp
+//  Grainulator
+//
+//  Disk streaming for WavSamplerVoice. Uses dr_wav for decoding.
+//
+
+#include "SampleStreamer.h"
+#include "WavSamplerVoice.h"
+#include "dr_wav.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace Grainulator {
+
+struct SampleStreamer::OpenFile {
+    drwav wav;
+    bool open = false;
+    std::string path;
+    uint64_t position = 0;          // Next frame drwav will decode
+    std::vector<float> scratch;     // kReadChunk frames at the file's channel count
+
+    void Close() {
+        if (open) drwav_uninit(&wav);
+        open = false;
+        path.clear();
+    }
+};
+
+SampleStreamer::SampleStreamer()
+    : m_sampleRate(48000.0f)
+    , m_running(false)
+{
+}
+
+SampleStreamer::~SampleStreamer() {
+    Stop();
+}
+
+void SampleStreamer::Start(float sampleRate) {
+    if (IsRunning()) return;
+
+    m_sampleRate = sampleRate;
+    m_files.reset(new OpenFile[kMaxStreams]);
+    for (auto& stream : m_streams) {
+        if (!stream.ring) stream.ring.reset(new float[kRingFrames * 2]());
+        stream.sample.store(nullptr, std::memory_order_relaxed);
+        stream.fill.store(0, std::memory_order_relaxed);
+    }
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread([this]() { IoLoop(); });
+}
+
+void SampleStreamer::Stop() {
+    if (!IsRunning()) return;
+
+    m_running.store(false, std::memory_order_release);
+    m_wake.post();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    for (int i = 0; i < kMaxStreams; ++i) {
+        m_files[i].Close();
+    }
+}
+
+// ========== Audio thread ==========
+
+void SampleStreamer::Arm(int stream, const WavSample* sample, size_t startFrame, float playbackRate) {
+    Stream& s = m_streams[stream];
+    s.sample.store(sample, std::memory_order_relaxed);
+    s.rate.store(playbackRate, std::memory_order_relaxed);
+    s.readFrame.store(startFrame, std::memory_order_relaxed);
+    ++s.generation;
+    s.fill.store((s.generation << kGenerationShift) | sample->headFrames, std::memory_order_release);
+    m_wake.post();
+}
+
+void SampleStreamer::Disarm(int stream) {
+    Stream& s = m_streams[stream];
+    s.sample.store(nullptr, std::memory_order_relaxed);
+    ++s.generation;
+    s.fill.store(s.generation << kGenerationShift, std::memory_order_release);
+}
+
+void SampleStreamer::WaitForFill(int stream, size_t endFrame) {
+    const Stream& s = m_streams[stream];
+    const WavSample* sample = s.sample.load(std::memory_order_relaxed);
+    if (!sample || !sample->streamPath) return;
+
+    const size_t target = std::min(endFrame, FillTarget(s, *sample));
+    size_t available = Available(stream);
+    if (available >= target) return;
+
+    m_wake.post();
+    auto lastProgress = std::chrono::steady_clock::now();
+    while (IsRunning()) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        const size_t now = Available(stream);
+        if (now >= target) return;
+        if (now != available) {
+            available = now;
+            lastProgress = std::chrono::steady_clock::now();
+        } else if (std::chrono::steady_clock::now() - lastProgress > std::chrono::milliseconds(kStallTimeoutMs)) {
+            return;  // Plays the missing frames as silence, as in real time
+        }
+    }
+}
+
+// ========== I/O thread ==========
+
+void SampleStreamer::IoLoop() {
+#if defined(__APPLE__)
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+
+    for (;;) {
+        m_wake.wait();
+        if (!m_running.load(std::memory_order_acquire)) return;
+
+        // Keep passing over the streams while any of them still wants data.
+        // A pass sees every Disarm() made before the request it starts with.
+        bool busy = true;
+        while (busy && m_running.load(std::memory_order_relaxed)) {
+            const uint64_t pass = m_passRequested.load(std::memory_order_acquire);
+            busy = false;
+            for (int i = 0; i < kMaxStreams; ++i) {
+                busy |= FillStream(i);
+            }
+            m_passCompleted.store(pass, std::memory_order_release);
+        }
+    }
+}
+
+// Read ahead of the playhead by a fixed time at the voice's rate, never
+// over frames the voice may still read
+size_t SampleStreamer::FillTarget(const Stream& stream, const WavSample& sample) const {
+    const size_t readFrame = static_cast<size_t>(stream.readFrame.load(std::memory_order_acquire));
+    const float rate = std::max(stream.rate.load(std::memory_order_relaxed), 0.0f);
+    const size_t maxAhead = kRingFrames - kRingGuard;
+    const size_t ahead = std::min(maxAhead, std::max(kReadChunk,
+        static_cast<size_t>(rate * kReadAheadSeconds * m_sampleRate)));
+    return std::min(sample.frameCount, readFrame + ahead);
+}
+
+bool SampleStreamer::FillStream(int index) {
+    Stream& s = m_streams[index];
+    OpenFile& file = m_files[index];
+
+    const uint64_t fill = s.fill.load(std::memory_order_acquire);
+    const uint64_t generation = fill >> kGenerationShift;
+    size_t available = static_cast<size_t>(fill & kFrameMask);
+
+    // A sample read with a newer generation is harmless: the publish below fails
+    const WavSample* sample = s.sample.load(std::memory_order_relaxed);
+    if (!sample || !sample->streamPath) return false;
+    if (available >= sample->frameCount) return false;
+
+    if (!file.open || file.path != sample->streamPath) {
+        file.Close();
+        if (!drwav_init_file(&file.wav, sample->streamPath, nullptr)) return false;
+        file.open = true;
+        file.path = sample->streamPath;
+        file.position = 0;
+        file.scratch.resize(kReadChunk * file.wav.channels);
+    }
+
+    const size_t target = FillTarget(s, *sample);
+    if (available >= target) return false;
+
+    const size_t frames = std::min(kReadChunk, target - available);
+    if (file.position != available) {
+        if (!drwav_seek_to_pcm_frame(&file.wav, available)) {
+            file.Close();
+            return false;
+        }
+        file.position = available;
+    }
+    const size_t got = static_cast<size_t>(drwav_read_pcm_frames_f32(&file.wav, frames, file.scratch.data()));
+    file.position += got;
+
+    // Same channel handling as the loaders: mono is duplicated, extra channels dropped.
+    // A short read (truncated file) is padded with silence so the voice can finish.
+    const unsigned channels = file.wav.channels;
+    float* ring = s.ring.get();
+    for (size_t i = 0; i < frames; ++i) {
+        float* out = ring + ((available + i) & kRingMask) * 2;
+        if (i < got) {
+            const float* in = file.scratch.data() + i * channels;
+            out[0] = in[0];
+            out[1] = channels >= 2 ? in[1] : in[0];
+        } else {
+            out[0] = 0.0f;
+            out[1] = 0.0f;
+        }
+    }
+
+    uint64_t expected = fill;
+    const uint64_t next = (generation << kGenerationShift) | (available + frames);
+    if (!s.fill.compare_exchange_strong(expected, next, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+        return true;  // Re-armed meanwhile: look again
+    }
+    return available + frames < target;
+}
+
+} // namespace Grainulator
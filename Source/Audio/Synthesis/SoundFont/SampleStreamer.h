@@ -0,0 +1,124 @@
+//
+//  SampleStreamer.h
+//  Grainulator
+//
+//  Direct-from-disk playback for WavSamplerVoice. A streamed WavSample keeps
+//  only its first headFrames frames in memory; while a voice plays it, a
+//  background I/O thread decodes the rest of the file into that voice's ring
+//  buffer ahead of the playhead. Read-ahead scales with the playback rate.
+//
+//  One stream per voice slot. The audio thread arms and disarms streams and
+//  reads frames; the I/O thread only fills. Each stream's fill position is
+//  tagged with the generation that armed it, so a fill for a stolen voice
+//  can never be published into its successor. A fill already running when
+//  its stream is disarmed still reads the old sample until it returns;
+//  RequestPass()/HasPassed() tell the owner when samples may be freed.
+//
+
+#ifndef SAMPLESTREAMER_H
+#define SAMPLESTREAMER_H
+
+#include "WakeSemaphore.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace Grainulator {
+
+struct WavSample;
+
+class SampleStreamer {
+public:
+    static constexpr int kMaxStreams = 32;              // WavSamplerVoice::kMaxVoices
+    static constexpr size_t kHeadFrames = 16384;        // Preloaded per sample (~0.34 s @ 48kHz)
+    static constexpr size_t kRingFrames = 1 << 15;      // Per stream, power of two
+    static constexpr float kReadAheadSeconds = 0.25f;   // At playback rate 1
+
+    SampleStreamer();
+    ~SampleStreamer();
+
+    /// Allocates the rings and spawns the I/O thread. Not real-time safe.
+    void Start(float sampleRate);
+    void Stop();
+    bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    // ---- Audio thread ----
+
+    /// Begin filling stream for sample, whose playhead starts at startFrame
+    void Arm(int stream, const WavSample* sample, size_t startFrame, float playbackRate);
+    void Disarm(int stream);
+
+    /// Frames [sample->headFrames, Available()) can be read from Ring()
+    size_t Available(int stream) const {
+        return m_streams[stream].fill.load(std::memory_order_acquire) & kFrameMask;
+    }
+    const float* Ring(int stream) const { return m_streams[stream].ring.get(); }
+
+    /// Frames before this one are no longer needed; the ring may reuse them
+    void SetReadPosition(int stream, size_t frame) {
+        m_streams[stream].readFrame.store(frame, std::memory_order_release);
+    }
+
+    /// Nudge the I/O thread to top up the rings (once per render block)
+    void Wake() { m_wake.post(); }
+
+    /// Blocks until frames up to endFrame are available, or as many as the
+    /// I/O thread reads ahead of the read position. Gives up once the fill
+    /// stalls for kStallTimeoutMs (unreadable file). Not real-time safe; for
+    /// offline renders, which must not outrun the disk.
+    void WaitForFill(int stream, size_t endFrame);
+
+    /// Returns a ticket for HasPassed(), which turns true once the I/O thread
+    /// has finished every fill begun before this call. Samples of streams
+    /// disarmed before the call may be freed from then on.
+    uint64_t RequestPass() {
+        const uint64_t ticket = m_passRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+        m_wake.post();
+        return ticket;
+    }
+    bool HasPassed(uint64_t ticket) const {
+        return m_passCompleted.load(std::memory_order_acquire) >= ticket || !IsRunning();
+    }
+
+private:
+    static constexpr int kGenerationShift = 40;
+    static constexpr uint64_t kFrameMask = (uint64_t(1) << kGenerationShift) - 1;
+    static constexpr size_t kRingMask = kRingFrames - 1;
+    static constexpr size_t kReadChunk = 4096;          // Frames per file read
+    static constexpr size_t kRingGuard = 64;            // Interpolation history kept behind the reader
+    static constexpr int kStallTimeoutMs = 1000;        // WaitForFill() without progress
+
+    struct Stream {
+        std::atomic<const WavSample*> sample{nullptr};
+        std::atomic<uint64_t> fill{0};        // generation << 40 | end of streamed frames
+        std::atomic<uint64_t> readFrame{0};
+        std::atomic<float> rate{1.0f};
+        std::unique_ptr<float[]> ring;        // kRingFrames interleaved stereo frames
+        uint64_t generation = 0;              // Audio thread
+    };
+
+    struct OpenFile;                          // I/O thread state (dr_wav handle)
+
+    void IoLoop();
+    bool FillStream(int index);
+    size_t FillTarget(const Stream& stream, const WavSample& sample) const;
+
+    Stream m_streams[kMaxStreams];
+    std::unique_ptr<OpenFile[]> m_files;
+    float m_sampleRate;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::atomic<uint64_t> m_passRequested{0};
+    std::atomic<uint64_t> m_passCompleted{0};   // Latest request a whole pass started after
+    WakeSemaphore m_wake;
+
+    SampleStreamer(const SampleStreamer&) = delete;
+    SampleStreamer& operator=(const SampleStreamer&) = delete;
+};
+
+} // namespace Grainulator
+#endif // SAMPLESTREAMER_H
@@ -4,14 +4,16 @@
 //
 //  Minimal SFZ parser. Handles <control>, <global>, <group>, <region>
 //  headers with hierarchical opcode inheritance. Loads WAV samples
-//  via dr_wav.
+//  via SampleLoader.
 //
 
 #include "SfzParser.h"
-#include "dr_wav.h"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
+#include <limits>
 #include <unordered_map>
+#include <unordered_set>
 #include <fstream>
 
 namespace Grainulator {
@@ -129,82 +131,13 @@ static int parseNoteOrNumber(const std::string& val) {
     return midi;
 }
 
-// --- WAV loading (same pattern as WavSamplerVoice::LoadFromDirectory) ---
-
-struct LoadedWav {
-    float* data;        // Interleaved stereo
-    size_t frameCount;
-    int sampleRate;
-    size_t memoryBytes;
-    bool valid;
-};
-
-static LoadedWav loadWavFile(const std::string& path) {
-    LoadedWav result{};
-    result.valid = false;
-
-    drwav wav;
-    if (!drwav_init_file(&wav, path.c_str(), nullptr)) {
-        return result;
-    }
-
-    size_t totalFrames = wav.totalPCMFrameCount;
-    unsigned int channels = wav.channels;
-
-    // Allocate stereo interleaved buffer
-    float* stereoData = new (std::nothrow) float[totalFrames * 2];
-    if (!stereoData) {
-        drwav_uninit(&wav);
-        return result;
-    }
-
-    if (channels == 1) {
-        float* monoData = new (std::nothrow) float[totalFrames];
-        if (!monoData) {
-            delete[] stereoData;
-            drwav_uninit(&wav);
-            return result;
-        }
-        drwav_read_pcm_frames_f32(&wav, totalFrames, monoData);
-        for (size_t i = 0; i < totalFrames; ++i) {
-            stereoData[i * 2]     = monoData[i];
-            stereoData[i * 2 + 1] = monoData[i];
-        }
-        delete[] monoData;
-    } else if (channels == 2) {
-        drwav_read_pcm_frames_f32(&wav, totalFrames, stereoData);
-    } else {
-        // Multi-channel: take first two channels
-        float* rawData = new (std::nothrow) float[totalFrames * channels];
-        if (!rawData) {
-            delete[] stereoData;
-            drwav_uninit(&wav);
-            return result;
-        }
-        drwav_read_pcm_frames_f32(&wav, totalFrames, rawData);
-        for (size_t i = 0; i < totalFrames; ++i) {
-            stereoData[i * 2]     = rawData[i * channels];
-            stereoData[i * 2 + 1] = (channels >= 2) ? rawData[i * channels + 1] : rawData[i * channels];
-        }
-        delete[] rawData;
-    }
-
-    drwav_uninit(&wav);
-
-    result.data = stereoData;
-    result.frameCount = totalFrames;
-    result.sampleRate = static_cast<int>(wav.sampleRate);
-    result.memoryBytes = totalFrames * 2 * sizeof(float);
-    result.valid = true;
-    return result;
-}
-
 // --- Build a WavSample from opcodes + loaded WAV data ---
 
 static WavSample buildSampleFromOpcodes(const OpcodeMap& opcodes,
-                                         const LoadedWav& wav) {
+                                         const DecodedWav& wav) {
     WavSample s{};
     s.data = wav.data;
+    s.encoding = wav.encoding;
     s.frameCount = wav.frameCount;
     s.sampleRate = wav.sampleRate;
 
@@ -240,6 +173,8 @@ static WavSample buildSampleFromOpcodes(const OpcodeMap& opcodes,
     s.resonance = 0.0f;
     s.fil_type = 0;
     s.pitch_keytrack = -1.0f;
+    s.headFrames = wav.headFrames;
+    s.streamPath = nullptr;
 
     // Apply opcodes
     for (const auto& kv : opcodes) {
@@ -346,13 +281,16 @@ static WavSample buildSampleFromOpcodes(const OpcodeMap& opcodes,
     if (s.loopEnd >= s.frameCount) s.loopEnd = s.frameCount > 0 ? s.frameCount - 1 : 0;
     if (s.loopStart >= s.loopEnd) s.loopMode = WavSample::NoLoop;
     if (s.offset >= s.frameCount) s.offset = 0;
+    if (s.headFrames > s.frameCount) s.headFrames = s.frameCount;
 
     return s;
 }
 
 // --- Main parser ---
 
-SfzParseResult ParseSfzFile(const char* sfzPath) {
+SfzParseResult ParseSfzFile(const char* sfzPath, const SampleLoadOptions& options,
+                            SampleLoadControl* control) {
+    const size_t streamHeadFrames = options.streamHeadFrames;
     SfzParseResult result{};
     result.totalMemoryBytes = 0;
     result.success = false;
@@ -481,6 +419,13 @@ SfzParseResult ParseSfzFile(const char* sfzPath) {
     OpcodeMap currentRegionOpcodes;
     bool inRegion = false;
 
+    struct PendingRegion {
+        OpcodeMap opcodes;
+        std::string path;
+        size_t maxFrames;
+    };
+    std::vector<PendingRegion> regions;
+
     auto finalizeRegion = [&]() {
         if (!inRegion) return;
         inRegion = false;
@@ -510,15 +455,22 @@ SfzParseResult ParseSfzFile(const char* sfzPath) {
             fullPath += "/" + samplePath;
         }
 
-        // Load WAV
-        LoadedWav wav = loadWavFile(fullPath);
-        if (!wav.valid) return;
-
-        // Build WavSample from merged opcodes
-        WavSample sample = buildSampleFromOpcodes(merged, wav);
+        // Streaming: unlooped regions load only a head past their offset.
+        // Looped regions stay in memory, since the playhead jumps back.
+        size_t maxFrames = std::numeric_limits<size_t>::max();
+        if (streamHeadFrames > 0) {
+            auto loopIt = merged.find("loop_mode");
+            const std::string loopMode = loopIt != merged.end() ? toLowerStr(loopIt->second) : "";
+            if (loopMode != "loop_continuous" && loopMode != "loop_sustain") {
+                auto offsetIt = merged.find("offset");
+                const size_t offset = offsetIt != merged.end()
+                    ? static_cast<size_t>(std::atoll(offsetIt->second.c_str())) : 0;
+                maxFrames = offset + streamHeadFrames;
+            }
+        }
 
-        result.samples.push_back(sample);
-        result.totalMemoryBytes += wav.memoryBytes;
+        // Decoded after parsing, all regions at once
+        regions.push_back({std::move(merged), std::move(fullPath), maxFrames});
     };
 
     for (const auto& token : tokens) {
@@ -576,6 +528,45 @@ SfzParseResult ParseSfzFile(const char* sfzPath) {
     // Finalize last region
     finalizeRegion();
 
+    // Decode every region's WAV on the load pool
+    const int regionCount = static_cast<int>(regions.size());
+    std::vector<DecodedWav> decoded(regions.size());
+    if (control) control->total.store(regionCount, std::memory_order_relaxed);
+    RunLoadJobs(regionCount, [&](int i) {
+        decoded[i] = DecodeWavFile(regions[i].path, regions[i].maxFrames, options.compact);
+    }, control);
+
+    if (control && control->IsCancelled()) {
+        for (auto& wav : decoded) {
+            if (wav.valid) FreeSampleData(wav.data);
+        }
+        result.errorMessage = "Load cancelled";
+        return result;
+    }
+
+    // Build samples in file order; regions whose WAV failed to load are skipped
+    std::unordered_set<std::string> seenPaths;
+    for (int i = 0; i < regionCount; ++i) {
+        const DecodedWav& wav = decoded[i];
+        if (!wav.valid) continue;
+        const std::string& fullPath = regions[i].path;
+
+        // Build WavSample from merged opcodes
+        WavSample sample = buildSampleFromOpcodes(regions[i].opcodes, wav);
+        if (sample.headFrames < sample.frameCount) {
+            sample.streamPath = new char[fullPath.size() + 1];
+            std::memcpy(sample.streamPath, fullPath.c_str(), fullPath.size() + 1);
+        } else {
+            sample.headFrames = sample.frameCount;
+        }
+
+        result.samples.push_back(sample);
+        result.totalMemoryBytes += wav.headFrames * SampleFrameBytes(wav.encoding);
+        if (seenPaths.insert(fullPath).second) {
+            result.samplePaths.push_back(fullPath);
+        }
+    }
+
     if (result.samples.empty()) {
         result.errorMessage = "No valid regions with samples found in SFZ file";
         return result;
@@ -11,6 +11,7 @@
 #ifndef SFZPARSER_H
 #define SFZPARSER_H
 
+#include "SampleLoader.h"
 #include "WavSamplerVoice.h"
 #include <vector>
 #include <string>
@@ -23,12 +24,19 @@ struct SfzParseResult {
     std::string instrumentName;
     bool success;
     std::string errorMessage;
+    std::vector<std::string> samplePaths;  // Each WAV file read, once
 };
 
 /// Parse an SFZ file and load all referenced WAV samples.
 /// Resolves sample paths relative to the .sfz file location.
+/// options.streamHeadFrames > 0 loads only that many frames past each
+/// unlooped region's offset and sets the sample up for disk streaming;
+/// options.compact keeps integer sample data (see DecodeWavFile).
+/// The WAVs are decoded in parallel; control (optional) receives progress
+/// and cancels the load, which then fails with nothing left allocated.
 /// MUST be called off the audio thread (performs file I/O and allocations).
-SfzParseResult ParseSfzFile(const char* sfzPath);
+SfzParseResult ParseSfzFile(const char* sfzPath, const SampleLoadOptions& options = {},
+                            SampleLoadControl* control = nullptr);
 
 } // namespace Grainulator
 #endif // SFZPARSER_H
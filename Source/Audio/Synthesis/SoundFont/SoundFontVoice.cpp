@@ -22,6 +22,7 @@ SoundFontVoice::SoundFontVoice()
     , m_tsfLoading(nullptr)
     , m_swapPending(false)
     , m_pendingFree(nullptr)
+    , m_compactStorage(false)
     , m_currentPreset(0)
     , m_level(0.8f)
     , m_attack(0.0f)
@@ -60,6 +61,7 @@ void SoundFontVoice::Init(float sample_rate) {
     m_sampleRate = sample_rate;
     m_filterStateL = 0.0f;
     m_filterStateR = 0.0f;
+    m_silence.Init(sample_rate);
 
     // Pre-allocate render buffer for typical max buffer size (2048 stereo frames)
     m_renderBufferSize = 4096;
@@ -91,7 +93,7 @@ void SoundFontVoice::CheckSwap() {
 
 bool SoundFontVoice::LoadSoundFont(const char* filePath) {
     // This runs on a background thread — allocations are fine here.
-    tsf* newTsf = tsf_load_filename(filePath);
+    tsf* newTsf = tsf_load_filename_ex(filePath, m_compactStorage ? TSF_LOAD_COMPACT_SAMPLES : 0);
     if (!newTsf) {
         return false;
     }
@@ -179,6 +181,11 @@ int SoundFontVoice::GetActiveVoiceCount() const {
     return f ? tsf_active_voice_count(f) : 0;
 }
 
+bool SoundFontVoice::IsSilent() const {
+    return !m_swapPending.load(std::memory_order_acquire) && GetActiveVoiceCount() == 0 &&
+           m_silence.IsSilent();
+}
+
 // --- Parameters ---
 
 void SoundFontVoice::SetLevel(float value) {
@@ -243,6 +250,7 @@ void SoundFontVoice::Render(float* out_left, float* out_right, size_t size) {
     if (!f || size == 0) {
         std::memset(out_left, 0, size * sizeof(float));
         std::memset(out_right, 0, size * sizeof(float));
+        m_silence.ProcessPeak(0.0f, size);
         return;
     }
 
@@ -283,6 +291,8 @@ void SoundFontVoice::Render(float* out_left, float* out_right, size_t size) {
         std::memcpy(out_left, srcL, size * sizeof(float));
         std::memcpy(out_right, srcR, size * sizeof(float));
     }
+
+    m_silence.Process(out_left, out_right, size);
 }
 
 } // namespace Grainulator
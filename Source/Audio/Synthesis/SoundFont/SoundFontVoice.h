@@ -12,6 +12,8 @@
 #include <cstddef>
 #include <atomic>
 
+#include "SilenceDetector.h"
+
 namespace Grainulator {
 
 class SoundFontVoice {
@@ -30,6 +32,11 @@ class SoundFontVoice {
     void UnloadSoundFont();
     bool IsLoaded() const;
 
+    // Keep the font's 16-bit samples as they are instead of expanding them
+    // to float (half the memory, same output). Applies from the next load.
+    void SetCompactStorageEnabled(bool enabled) { m_compactStorage = enabled; }
+    bool IsCompactStorageEnabled() const { return m_compactStorage; }
+
     // Preset selection (0 to GetPresetCount()-1)
     void SetPreset(int presetIndex);
     int  GetPreset() const { return m_currentPreset; }
@@ -44,6 +51,10 @@ class SoundFontVoice {
     // Active voice count (for metering/diagnostics)
     int GetActiveVoiceCount() const;
 
+    // True once no voice is sounding, no swap is pending and the output
+    // filter has rung out; Render() may be skipped until the next note.
+    bool IsSilent() const;
+
     // Parameters (all 0.0–1.0 normalized unless noted)
     void SetLevel(float value);
     void SetAttack(float value);
@@ -67,6 +78,9 @@ class SoundFontVoice {
     // Old instance pending deferred free (set by audio thread after swap)
     void* m_pendingFree;
 
+    // Loader thread only
+    bool m_compactStorage;
+
     // Parameter state
     int   m_currentPreset;
     float m_level;
@@ -78,6 +92,7 @@ class SoundFontVoice {
     // Simple one-pole low-pass filter state (post-TSF)
     float m_filterStateL;
     float m_filterStateR;
+    SilenceDetector m_silence;
 
     // Interleaved render buffer for TSF (stereo unweaved)
     float* m_renderBuffer;
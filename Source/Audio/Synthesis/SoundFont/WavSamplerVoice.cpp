@@ -3,17 +3,21 @@
 //  Grainulator
 //
 //  WAV-based polyphonic sample player voice for mx.samples instruments.
-//  Uses dr_wav (public domain) for WAV file decoding.
+//  Compiles dr_wav (public domain); decoding goes through SampleLoader.
 //
 
 #define DR_WAV_IMPLEMENTATION
 #include "dr_wav.h"
 
 #include "WavSamplerVoice.h"
+#include "InstrumentCache.h"
+#include "SampleStreamer.h"
 #include "SfzParser.h"
+#include "SimdOps.h"
 #include <cstring>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include <string>
 #include <dirent.h>
@@ -144,13 +148,128 @@ static ParsedFilename parseMxSamplesFilename(const std::string& filename) {
 
 void WavSamplerVoice::FreeSampleMap(SampleMap* map) {
     if (!map) return;
-    for (int i = 0; i < map->sampleCount; ++i) {
-        delete[] map->samples[i].data;
+    if (map->cacheMapping) {
+        ReleaseInstrumentCache(map);
+    } else {
+        for (int i = 0; i < map->sampleCount; ++i) {
+            FreeSampleData(map->samples[i].data);
+            delete[] map->samples[i].streamPath;
+        }
     }
     delete[] map->samples;
+    delete[] map->regionList;
     delete map;
 }
 
+void WavSamplerVoice::BuildRegionTable(SampleMap* map) {
+    // Runs the note-on selection once per (note, bucket) so the audio thread
+    // only indexes. Candidate order matches the sorted samples[], which is
+    // the round-robin order.
+    std::vector<int> regions;
+    std::vector<int> candidates;
+    std::vector<int> zone;
+
+    // Neighbouring velocities and layers usually share their regions: reuse
+    // the previous run when it is identical
+    auto addZone = [&](SampleMap::Zone& out, const SampleMap::Zone* previous) {
+        out.count = static_cast<int>(zone.size());
+        out.first = 0;
+        if (zone.empty()) return;
+        if (previous && previous->count == out.count &&
+            std::equal(zone.begin(), zone.end(), regions.begin() + previous->first)) {
+            out.first = previous->first;
+            return;
+        }
+        out.first = static_cast<int>(regions.size());
+        regions.insert(regions.end(), zone.begin(), zone.end());
+    };
+
+    for (int note = 0; note < 128; ++note) {
+        map->zoneLayers[note] = 0;
+        for (int bucket = 0; bucket < 128; ++bucket) {
+            map->zoneTable[note][bucket] = {0, 0};
+        }
+    }
+
+    if (map->useSfzVelocity) {
+        // SFZ: regions whose key and velocity ranges contain the note
+        for (int note = 0; note < 128; ++note) {
+            candidates.clear();
+            for (int i = 0; i < map->sampleCount; ++i) {
+                const WavSample& s = map->samples[i];
+                if (note >= s.lokey && note <= s.hikey && !s.isRelease) {
+                    candidates.push_back(i);
+                }
+            }
+            for (int vel = 0; vel < 128; ++vel) {
+                zone.clear();
+                for (int i : candidates) {
+                    const WavSample& s = map->samples[i];
+                    if (vel >= s.lovel && vel <= s.hivel) zone.push_back(i);
+                }
+                addZone(map->zoneTable[note][vel], vel > 0 ? &map->zoneTable[note][vel - 1] : nullptr);
+            }
+        }
+    } else {
+        // mx.samples: nearest sampled note (lower wins a tie), then velocity layer
+        for (int note = 0; note < 128; ++note) {
+            int closestNote = -1;
+            for (int offset = 0; offset < 128; ++offset) {
+                int lo = note - offset;
+                int hi = note + offset;
+                if (lo >= 0 && map->noteTable[lo].sampleCount > 0) {
+                    closestNote = lo;
+                    break;
+                }
+                if (hi <= 127 && map->noteTable[hi].sampleCount > 0) {
+                    closestNote = hi;
+                    break;
+                }
+            }
+            if (closestNote < 0) continue;
+
+            // Release samples only play when a note has nothing else
+            const auto& entry = map->noteTable[closestNote];
+            candidates.clear();
+            for (int i = 0; i < entry.sampleCount; ++i) {
+                if (!map->samples[entry.firstSampleIndex + i].isRelease) {
+                    candidates.push_back(entry.firstSampleIndex + i);
+                }
+            }
+            if (candidates.empty()) {
+                for (int i = 0; i < entry.sampleCount; ++i) {
+                    candidates.push_back(entry.firstSampleIndex + i);
+                }
+            }
+            if (candidates.empty()) continue;
+
+            const int layers = std::min(map->samples[candidates[0]].totalDynamics, 127);
+            map->zoneLayers[note] = layers;
+            for (int layer = 1; layer <= layers; ++layer) {
+                // Exact layer, else the closest one present
+                int bestLayer = layer;
+                int bestLayerDist = 999;
+                for (int i : candidates) {
+                    int dist = std::abs(map->samples[i].dynamicLayer - layer);
+                    if (dist < bestLayerDist) {
+                        bestLayerDist = dist;
+                        bestLayer = map->samples[i].dynamicLayer;
+                    }
+                }
+                zone.clear();
+                for (int i : candidates) {
+                    if (map->samples[i].dynamicLayer == bestLayer) zone.push_back(i);
+                }
+                addZone(map->zoneTable[note][layer], layer > 1 ? &map->zoneTable[note][layer - 1] : nullptr);
+            }
+        }
+    }
+
+    map->regionListSize = static_cast<int>(regions.size());
+    map->regionList = new int[std::max(map->regionListSize, 1)];
+    std::copy(regions.begin(), regions.end(), map->regionList);
+}
+
 // --- Constructor / Destructor ---
 
 WavSamplerVoice::WavSamplerVoice()
@@ -159,6 +278,7 @@ WavSamplerVoice::WavSamplerVoice()
     , m_mapLoading(nullptr)
     , m_swapPending(false)
     , m_pendingFree(nullptr)
+    , m_pendingFreePass(0)
     , m_maxPolyphony(16)
     , m_voiceCounter(0)
     , m_level(0.8f)
@@ -172,8 +292,21 @@ WavSamplerVoice::WavSamplerVoice()
     , m_useSfzEnvelopes(false)
     , m_filterStateL(0.0f)
     , m_filterStateR(0.0f)
+    , m_streamer(nullptr)
+    , m_streamingEnabled(false)
+    , m_offlineRendering(false)
+    , m_streamStarvations(0)
+    , m_compactStorage(false)
 {
+    static_assert(kMaxVoices <= SampleStreamer::kMaxStreams, "one stream per voice slot");
+
     std::memset(m_voices, 0, sizeof(m_voices));
+    std::memset(m_envLevel, 0, sizeof(m_envLevel));
+    std::memset(m_envPhase, 0, sizeof(m_envPhase));
+    std::memset(m_svfIc1L, 0, sizeof(m_svfIc1L));
+    std::memset(m_svfIc2L, 0, sizeof(m_svfIc2L));
+    std::memset(m_svfIc1R, 0, sizeof(m_svfIc1R));
+    std::memset(m_svfIc2R, 0, sizeof(m_svfIc2R));
     std::memset(m_roundRobin, 0, sizeof(m_roundRobin));
     for (int i = 0; i < kMaxVoices; ++i) {
         m_voices[i].state = SamplerVoiceSlot::State::Off;
@@ -181,6 +314,7 @@ WavSamplerVoice::WavSamplerVoice()
 }
 
 WavSamplerVoice::~WavSamplerVoice() {
+    delete m_streamer.load(std::memory_order_acquire);  // Joins the I/O thread before the samples it reads go
     FreeSampleMap(m_mapActive);
     FreeSampleMap(m_mapLoading);
     FreeSampleMap(m_pendingFree);
@@ -190,6 +324,7 @@ void WavSamplerVoice::Init(float sample_rate) {
     m_sampleRate = sample_rate;
     m_filterStateL = 0.0f;
     m_filterStateR = 0.0f;
+    m_silence.Init(sample_rate);
     m_voiceCounter = 0;
 }
 
@@ -197,6 +332,14 @@ void WavSamplerVoice::Init(float sample_rate) {
 
 void WavSamplerVoice::CheckSwap() {
     if (m_swapPending.load(std::memory_order_acquire)) {
+        // A fill the I/O thread began before the last swap may still be reading
+        // the pending map's samples (a cached map's paths live in its mapping):
+        // hold the swap until that pass is over
+        SampleStreamer* streamer = m_streamer.load(std::memory_order_acquire);
+        if (m_pendingFree && streamer && !streamer->HasPassed(m_pendingFreePass)) {
+            return;
+        }
+
         // Free previously pending old map (deferred from last swap)
         if (m_pendingFree) {
             FreeSampleMap(m_pendingFree);
@@ -211,6 +354,15 @@ void WavSamplerVoice::CheckSwap() {
 
         // Kill all playing voices when instrument changes
         AllNotesOff();
+
+        // The I/O thread must let go of the old map's samples before it is freed
+        for (int i = 0; i < kMaxVoices; ++i) {
+            if (m_voices[i].streaming) {
+                streamer->Disarm(i);
+                m_voices[i].streaming = false;
+            }
+        }
+        m_pendingFreePass = streamer ? streamer->RequestPass() : 0;
     }
 }
 
@@ -218,62 +370,74 @@ void WavSamplerVoice::CheckSwap() {
 
 bool WavSamplerVoice::LoadFromDirectory(const char* dirPath) {
     // This runs on a background thread — allocations are fine here.
+    m_loadControl.Begin();
+    const SampleLoadOptions options = CurrentLoadOptions();
+
+    std::string cachePath;
+    if (!m_cacheDirectory.empty()) {
+        cachePath = InstrumentCachePath(m_cacheDirectory, dirPath, options);
+        if (SampleMap* cached = LoadInstrumentCache(cachePath, options, &m_loadControl)) {
+            PublishMap(cached);
+            return true;
+        }
+        if (m_loadControl.IsCancelled()) return false;
+    }
+
     DIR* dir = opendir(dirPath);
     if (!dir) return false;
 
-    std::vector<WavSample> loadedSamples;
-    size_t totalBytes = 0;
+    struct InstrumentFile {
+        std::string path;
+        ParsedFilename parsed;
+    };
+    std::vector<InstrumentFile> files;
 
     struct dirent* entry;
     while ((entry = readdir(dir)) != nullptr) {
         std::string fname(entry->d_name);
         ParsedFilename parsed = parseMxSamplesFilename(fname);
         if (!parsed.valid) continue;
+        files.push_back({std::string(dirPath) + "/" + fname, parsed});
+    }
 
-        // Build full path
-        std::string fullPath = std::string(dirPath) + "/" + fname;
-
-        // Load WAV with dr_wav
-        drwav wav;
-        if (!drwav_init_file(&wav, fullPath.c_str(), nullptr)) continue;
-
-        // Read all frames as float
-        size_t totalFrames = wav.totalPCMFrameCount;
-        unsigned int channels = wav.channels;
-        unsigned int wavSampleRate = wav.sampleRate;
-
-        // Allocate stereo interleaved buffer
-        float* stereoData = new float[totalFrames * 2];
+    closedir(dir);
 
-        if (channels == 1) {
-            // Mono: read then duplicate to stereo
-            float* monoData = new float[totalFrames];
-            drwav_read_pcm_frames_f32(&wav, totalFrames, monoData);
-            for (size_t i = 0; i < totalFrames; ++i) {
-                stereoData[i * 2]     = monoData[i];
-                stereoData[i * 2 + 1] = monoData[i];
-            }
-            delete[] monoData;
-        } else if (channels == 2) {
-            // Stereo: read directly into interleaved buffer
-            drwav_read_pcm_frames_f32(&wav, totalFrames, stereoData);
-        } else {
-            // Multi-channel: take first two channels
-            float* rawData = new float[totalFrames * channels];
-            drwav_read_pcm_frames_f32(&wav, totalFrames, rawData);
-            for (size_t i = 0; i < totalFrames; ++i) {
-                stereoData[i * 2]     = rawData[i * channels];
-                stereoData[i * 2 + 1] = rawData[i * channels + 1];
-            }
-            delete[] rawData;
+    if (files.empty()) return false;
+
+    // Decode every file on the load pool (only the head when streaming)
+    const int fileCount = static_cast<int>(files.size());
+    const size_t maxFrames = options.streamHeadFrames > 0
+        ? options.streamHeadFrames : std::numeric_limits<size_t>::max();
+    std::vector<DecodedWav> decoded(files.size());
+    m_loadControl.total.store(fileCount, std::memory_order_relaxed);
+    RunLoadJobs(fileCount, [&](int i) {
+        decoded[i] = DecodeWavFile(files[i].path, maxFrames, options.compact);
+    }, &m_loadControl);
+
+    if (m_loadControl.IsCancelled()) {
+        for (auto& wav : decoded) {
+            if (wav.valid) FreeSampleData(wav.data);
         }
+        return false;
+    }
 
-        drwav_uninit(&wav);
+    std::vector<WavSample> loadedSamples;
+    std::vector<std::string> dependencies{dirPath};
+    size_t totalBytes = 0;
+
+    for (int f = 0; f < fileCount; ++f) {
+        const DecodedWav& wav = decoded[f];
+        if (!wav.valid) continue;
+        const ParsedFilename& parsed = files[f].parsed;
+        const std::string& fullPath = files[f].path;
+        const size_t fileFrames = wav.frameCount;
+        const size_t totalFrames = wav.headFrames;
 
         WavSample sample{};
-        sample.data = stereoData;
-        sample.frameCount = totalFrames;
-        sample.sampleRate = static_cast<int>(wavSampleRate);
+        sample.data = wav.data;
+        sample.encoding = wav.encoding;
+        sample.frameCount = fileFrames;
+        sample.sampleRate = wav.sampleRate;
         sample.rootNote = parsed.midiNote;
         sample.dynamicLayer = parsed.dynamicLayer;
         sample.totalDynamics = parsed.totalDynamics;
@@ -287,7 +451,7 @@ bool WavSamplerVoice::LoadFromDirectory(const char* dirPath) {
         sample.hivel = 127;
         sample.loopMode = WavSample::NoLoop;
         sample.loopStart = 0;
-        sample.loopEnd = totalFrames > 0 ? totalFrames - 1 : 0;
+        sample.loopEnd = fileFrames > 0 ? fileFrames - 1 : 0;
         sample.offset = 0;
         sample.volume = 0.0f;
         sample.pan = 0.0f;
@@ -308,12 +472,18 @@ bool WavSamplerVoice::LoadFromDirectory(const char* dirPath) {
         sample.fil_type = 0;
         sample.pitch_keytrack = -1.0f;
 
-        totalBytes += totalFrames * 2 * sizeof(float);
+        sample.headFrames = totalFrames;
+        sample.streamPath = nullptr;
+        if (totalFrames < fileFrames) {
+            sample.streamPath = new char[fullPath.size() + 1];
+            std::memcpy(sample.streamPath, fullPath.c_str(), fullPath.size() + 1);
+        }
+
+        totalBytes += totalFrames * SampleFrameBytes(wav.encoding);
         loadedSamples.push_back(sample);
+        dependencies.push_back(fullPath);
     }
 
-    closedir(dir);
-
     if (loadedSamples.empty()) return false;
 
     // Sort by rootNote, then dynamicLayer, then variation
@@ -360,15 +530,29 @@ bool WavSamplerVoice::LoadFromDirectory(const char* dirPath) {
     std::strncpy(map->instrumentName, name.c_str(), sizeof(map->instrumentName) - 1);
     map->instrumentName[sizeof(map->instrumentName) - 1] = '\0';
 
-    // Signal audio thread to swap
-    m_mapLoading = map;
-    m_swapPending.store(true, std::memory_order_release);
+    if (!cachePath.empty()) {
+        WriteInstrumentCache(cachePath, options, *map, dependencies);
+    }
 
+    PublishMap(map);
     return true;
 }
 
 bool WavSamplerVoice::LoadFromSfzFile(const char* sfzPath) {
-    SfzParseResult result = ParseSfzFile(sfzPath);
+    m_loadControl.Begin();
+    const SampleLoadOptions options = CurrentLoadOptions();
+
+    std::string cachePath;
+    if (!m_cacheDirectory.empty()) {
+        cachePath = InstrumentCachePath(m_cacheDirectory, sfzPath, options);
+        if (SampleMap* cached = LoadInstrumentCache(cachePath, options, &m_loadControl)) {
+            PublishMap(cached);
+            return true;
+        }
+        if (m_loadControl.IsCancelled()) return false;
+    }
+
+    SfzParseResult result = ParseSfzFile(sfzPath, options, &m_loadControl);
     if (!result.success || result.samples.empty()) return false;
 
     // Sort by lokey, then lovel for consistent ordering
@@ -387,7 +571,7 @@ bool WavSamplerVoice::LoadFromSfzFile(const char* sfzPath) {
     map->totalMemoryBytes = result.totalMemoryBytes;
     map->useSfzVelocity = true;
 
-    // Note table left empty — FindSample does linear scan for SFZ mode
+    // Note table unused in SFZ mode: regions match by key range
     for (int n = 0; n < 128; ++n) {
         map->noteTable[n].firstSampleIndex = -1;
         map->noteTable[n].sampleCount = 0;
@@ -398,10 +582,33 @@ bool WavSamplerVoice::LoadFromSfzFile(const char* sfzPath) {
                  sizeof(map->instrumentName) - 1);
     map->instrumentName[sizeof(map->instrumentName) - 1] = '\0';
 
+    if (!cachePath.empty()) {
+        std::vector<std::string> dependencies{sfzPath};
+        dependencies.insert(dependencies.end(), result.samplePaths.begin(), result.samplePaths.end());
+        WriteInstrumentCache(cachePath, options, *map, dependencies);
+    }
+
+    PublishMap(map);
+    return true;
+}
+
+void WavSamplerVoice::PublishMap(SampleMap* map) {
+    BuildRegionTable(map);
+
     // Signal audio thread to swap
     m_mapLoading = map;
     m_swapPending.store(true, std::memory_order_release);
-    return true;
+}
+
+SampleLoadOptions WavSamplerVoice::CurrentLoadOptions() const {
+    SampleLoadOptions options;
+    options.streamHeadFrames = m_streamingEnabled.load(std::memory_order_acquire) ? SampleStreamer::kHeadFrames : 0;
+    options.compact = m_compactStorage;
+    return options;
+}
+
+void WavSamplerVoice::SetInstrumentCacheDirectory(const char* path) {
+    m_cacheDirectory = path ? path : "";
 }
 
 void WavSamplerVoice::Unload() {
@@ -424,108 +631,24 @@ const WavSample* WavSamplerVoice::FindSample(int note, float velocity) {
     SampleMap* map = m_mapActive;
     if (!map || note < 0 || note > 127) return nullptr;
 
-    // SFZ mode: direct key+velocity range matching
+    int bucket;
     if (map->useSfzVelocity) {
-        int vel127 = static_cast<int>(velocity * 127.0f);
-        if (vel127 < 0) vel127 = 0;
-        if (vel127 > 127) vel127 = 127;
-
-        // Linear scan: collect samples matching key range and velocity range
-        std::vector<const WavSample*> candidates;
-        candidates.reserve(16);
-        for (int i = 0; i < map->sampleCount; ++i) {
-            const WavSample& s = map->samples[i];
-            if (note >= s.lokey && note <= s.hikey &&
-                vel127 >= s.lovel && vel127 <= s.hivel &&
-                !s.isRelease) {
-                candidates.push_back(&s);
-            }
-        }
-        if (candidates.empty()) return nullptr;
-
-        // Round-robin among matching candidates
-        int rr = m_roundRobin[note] % static_cast<int>(candidates.size());
-        m_roundRobin[note] = rr + 1;
-        return candidates[rr];
-    }
-
-    // mx.samples mode: nearest note + velocity layer lookup
-
-    // Search for nearest note that has samples
-    int closestNote = -1;
-    for (int offset = 0; offset < 128; ++offset) {
-        int lo = note - offset;
-        int hi = note + offset;
-        if (lo >= 0 && map->noteTable[lo].sampleCount > 0) {
-            closestNote = lo;
-            break;
-        }
-        if (hi <= 127 && map->noteTable[hi].sampleCount > 0) {
-            closestNote = hi;
-            break;
-        }
-    }
-
-    if (closestNote < 0) return nullptr;
-
-    const auto& entry = map->noteTable[closestNote];
-    const WavSample* base = &map->samples[entry.firstSampleIndex];
-    int count = entry.sampleCount;
-
-    // Filter out release samples
-    std::vector<const WavSample*> candidates; // Note: small, bounded by sample count per note
-    candidates.reserve(count);
-    for (int i = 0; i < count; ++i) {
-        if (!base[i].isRelease) {
-            candidates.push_back(&base[i]);
-        }
-    }
-    if (candidates.empty()) {
-        // Fall back to including release samples
-        for (int i = 0; i < count; ++i) {
-            candidates.push_back(&base[i]);
-        }
-    }
-    if (candidates.empty()) return nullptr;
-
-    // Select by velocity layer
-    int totalDynamics = candidates[0]->totalDynamics;
-    int targetLayer = static_cast<int>(velocity * totalDynamics);
-    targetLayer = std::clamp(targetLayer, 1, totalDynamics);
-
-    // Filter to matching dynamic layer
-    std::vector<const WavSample*> layerCandidates;
-    for (auto* s : candidates) {
-        if (s->dynamicLayer == targetLayer) {
-            layerCandidates.push_back(s);
-        }
-    }
-
-    // Fall back to closest layer if exact match not found
-    if (layerCandidates.empty()) {
-        int bestLayerDist = 999;
-        int bestLayer = 1;
-        for (auto* s : candidates) {
-            int dist = std::abs(s->dynamicLayer - targetLayer);
-            if (dist < bestLayerDist) {
-                bestLayerDist = dist;
-                bestLayer = s->dynamicLayer;
-            }
-        }
-        for (auto* s : candidates) {
-            if (s->dynamicLayer == bestLayer) {
-                layerCandidates.push_back(s);
-            }
-        }
+        // SFZ mode: key+velocity range matching
+        bucket = std::clamp(static_cast<int>(velocity * 127.0f), 0, 127);
+    } else {
+        // mx.samples mode: velocity layer of the nearest sampled note
+        const int layers = map->zoneLayers[note];
+        if (layers == 0) return nullptr;
+        bucket = std::clamp(static_cast<int>(velocity * layers), 1, layers);
     }
 
-    if (layerCandidates.empty()) return candidates[0];
+    const SampleMap::Zone& zone = map->zoneTable[note][bucket];
+    if (zone.count == 0) return nullptr;
 
-    // Round-robin among variations
-    int rr = m_roundRobin[note] % static_cast<int>(layerCandidates.size());
+    // Round-robin among the zone's candidates
+    int rr = m_roundRobin[note] % zone.count;
     m_roundRobin[note] = rr + 1;
-
-    return layerCandidates[rr];
+    return &map->samples[map->regionList[zone.first + rr]];
 }
 
 // --- Voice allocation ---
@@ -568,7 +691,7 @@ float WavSamplerVoice::ComputePlaybackRate(int targetNote, const WavSample* smp)
 
 // --- ADSR Envelope ---
 
-float WavSamplerVoice::AdvanceEnvelope(SamplerVoiceSlot& voice, float dt) {
+WavSamplerVoice::EnvelopeTimes WavSamplerVoice::GetEnvelopeTimes(const WavSample* sample) const {
     // Map 0-1 params to time values:
     // attack:  0→0.001s, 1→2.0s
     // decay:   0→0.001s, 1→2.0s
@@ -580,85 +703,29 @@ float WavSamplerVoice::AdvanceEnvelope(SamplerVoiceSlot& voice, float dt) {
     };
 
     // Use per-region SFZ values if available, else global knob values
-    float attackTime, holdTime, decayTime, sustainLevel, releaseTime;
-
-    if (m_useSfzEnvelopes && voice.sample) {
-        const auto& s = *voice.sample;
-        attackTime   = (s.ampeg_attack >= 0)  ? s.ampeg_attack  : paramToTime(m_attack, 2.0f);
-        holdTime     = (s.ampeg_hold >= 0)    ? s.ampeg_hold    : 0.0f;
-        decayTime    = (s.ampeg_decay >= 0)   ? s.ampeg_decay   : paramToTime(m_decay, 2.0f);
-        sustainLevel = (s.ampeg_sustain >= 0) ? s.ampeg_sustain / 100.0f : m_sustain;
-        releaseTime  = (s.ampeg_release >= 0) ? s.ampeg_release : paramToTime(m_release, 3.0f);
+    EnvelopeTimes e;
+
+    if (m_useSfzEnvelopes && sample) {
+        const auto& s = *sample;
+        e.attack  = (s.ampeg_attack >= 0)  ? s.ampeg_attack  : paramToTime(m_attack, 2.0f);
+        e.hold    = (s.ampeg_hold >= 0)    ? s.ampeg_hold    : 0.0f;
+        e.decay   = (s.ampeg_decay >= 0)   ? s.ampeg_decay   : paramToTime(m_decay, 2.0f);
+        e.sustain = (s.ampeg_sustain >= 0) ? s.ampeg_sustain / 100.0f : m_sustain;
+        e.release = (s.ampeg_release >= 0) ? s.ampeg_release : paramToTime(m_release, 3.0f);
     } else {
-        attackTime   = paramToTime(m_attack, 2.0f);
-        holdTime     = 0.0f;
-        decayTime    = paramToTime(m_decay, 2.0f);
-        sustainLevel = m_sustain;
-        releaseTime  = paramToTime(m_release, 3.0f);
+        e.attack  = paramToTime(m_attack, 2.0f);
+        e.hold    = 0.0f;
+        e.decay   = paramToTime(m_decay, 2.0f);
+        e.sustain = m_sustain;
+        e.release = paramToTime(m_release, 3.0f);
     }
 
     // Clamp minimum times to avoid division by zero
-    if (attackTime < 0.0001f) attackTime = 0.0001f;
-    if (decayTime < 0.0001f) decayTime = 0.0001f;
-    if (releaseTime < 0.0001f) releaseTime = 0.0001f;
-
-    voice.envPhase += dt;
-
-    switch (voice.state) {
-        case SamplerVoiceSlot::State::Attack: {
-            float t = voice.envPhase / attackTime;
-            if (t >= 1.0f) {
-                voice.envLevel = 1.0f;
-                voice.envPhase = 0.0f;
-                if (holdTime > 0.0f) {
-                    voice.state = SamplerVoiceSlot::State::Hold;
-                } else {
-                    voice.state = SamplerVoiceSlot::State::Decay;
-                }
-            } else {
-                voice.envLevel = t;
-            }
-            break;
-        }
-        case SamplerVoiceSlot::State::Hold: {
-            voice.envLevel = 1.0f;
-            if (voice.envPhase >= holdTime) {
-                voice.state = SamplerVoiceSlot::State::Decay;
-                voice.envPhase = 0.0f;
-            }
-            break;
-        }
-        case SamplerVoiceSlot::State::Decay: {
-            float t = voice.envPhase / decayTime;
-            if (t >= 1.0f) {
-                voice.envLevel = sustainLevel;
-                voice.state = SamplerVoiceSlot::State::Sustain;
-                voice.envPhase = 0.0f;
-            } else {
-                voice.envLevel = 1.0f - t * (1.0f - sustainLevel);
-            }
-            break;
-        }
-        case SamplerVoiceSlot::State::Sustain:
-            voice.envLevel = sustainLevel;
-            break;
-        case SamplerVoiceSlot::State::Release: {
-            float t = voice.envPhase / releaseTime;
-            if (t >= 1.0f) {
-                voice.envLevel = 0.0f;
-                voice.state = SamplerVoiceSlot::State::Off;
-            } else {
-                // Release starts from wherever the level was when note-off happened
-                voice.envLevel = voice.envLevel * (1.0f - t);
-            }
-            break;
-        }
-        case SamplerVoiceSlot::State::Off:
-            voice.envLevel = 0.0f;
-            break;
-    }
+    if (e.attack < 0.0001f) e.attack = 0.0001f;
+    if (e.decay < 0.0001f) e.decay = 0.0001f;
+    if (e.release < 0.0001f) e.release = 0.0001f;
 
-    return voice.envLevel;
+    return e;
 }
 
 // --- Note control ---
@@ -676,7 +743,7 @@ void WavSamplerVoice::NoteOn(int note, float velocity) {
             if (slot.state != SamplerVoiceSlot::State::Off &&
                 slot.sample && slot.sample->off_by == sample->group) {
                 slot.state = SamplerVoiceSlot::State::Off;
-                slot.envLevel = 0.0f;
+                m_envLevel[i] = 0.0f;
             }
         }
     }
@@ -690,13 +757,45 @@ void WavSamplerVoice::NoteOn(int note, float velocity) {
     v.playbackRate = ComputePlaybackRate(note, sample);
     v.playhead = static_cast<double>(sample->offset);
     v.sample = sample;
-    v.envLevel = 0.0f;
-    v.envPhase = 0.0f;
-    v.svfIc1eqL = 0.0f;
-    v.svfIc2eqL = 0.0f;
-    v.svfIc1eqR = 0.0f;
-    v.svfIc2eqR = 0.0f;
     v.startTime = ++m_voiceCounter;
+
+    // Per-sample volume (dB to linear) and pan (-100..+100)
+    const float volGain = std::pow(10.0f, sample->volume / 20.0f);
+    const float panNorm = sample->pan / 100.0f;  // -1 to +1
+    v.gainL = volGain * std::min(1.0f, 1.0f - panNorm);
+    v.gainR = volGain * std::min(1.0f, 1.0f + panNorm);
+
+    // Per-voice SVF filter coefficients
+    v.svfA1 = v.svfA2 = v.svfA3 = v.svfK = 0.0f;
+    if (sample->cutoff > 0.0f) {
+        float cutHz = sample->cutoff;
+        if (cutHz > m_sampleRate * 0.49f) cutHz = m_sampleRate * 0.49f;
+        const float g = std::tan(3.14159265f * cutHz / m_sampleRate);
+        // resonance in dB (0-40 range typical) → damping factor
+        v.svfK = 2.0f - 2.0f * std::min(sample->resonance, 40.0f) / 40.0f;
+        if (v.svfK < 0.01f) v.svfK = 0.01f;
+        v.svfA1 = 1.0f / (1.0f + g * (g + v.svfK));
+        v.svfA2 = g * v.svfA1;
+        v.svfA3 = g * v.svfA2;
+    }
+
+    m_envLevel[slot] = 0.0f;
+    m_envPhase[slot] = 0.0f;
+    m_svfIc1L[slot] = 0.0f;
+    m_svfIc2L[slot] = 0.0f;
+    m_svfIc1R[slot] = 0.0f;
+    m_svfIc2R[slot] = 0.0f;
+
+    // Streamed samples read past their head from this slot's stream. A map
+    // with streamed samples was loaded after the streamer was published.
+    SampleStreamer* streamer = m_streamer.load(std::memory_order_acquire);
+    if (sample->streamPath && streamer) {
+        streamer->Arm(slot, sample, sample->offset, v.playbackRate);
+        v.streaming = true;
+    } else if (v.streaming) {
+        streamer->Disarm(slot);
+        v.streaming = false;
+    }
 }
 
 void WavSamplerVoice::NoteOff(int note) {
@@ -706,11 +805,9 @@ void WavSamplerVoice::NoteOff(int note) {
             v.state != SamplerVoiceSlot::State::Release) {
             // OneShot samples ignore note-off — play to completion
             if (v.sample && v.sample->loopMode == WavSample::OneShot) continue;
-            // Store current level before transitioning so release can fade from it
-            float currentLevel = v.envLevel;
+            // The level is kept so release fades from it
             v.state = SamplerVoiceSlot::State::Release;
-            v.envPhase = 0.0f;
-            v.envLevel = currentLevel;
+            m_envPhase[i] = 0.0f;
         }
     }
 }
@@ -718,7 +815,7 @@ void WavSamplerVoice::NoteOff(int note) {
 void WavSamplerVoice::AllNotesOff() {
     for (int i = 0; i < kMaxVoices; ++i) {
         m_voices[i].state = SamplerVoiceSlot::State::Off;
-        m_voices[i].envLevel = 0.0f;
+        m_envLevel[i] = 0.0f;
     }
 }
 
@@ -732,6 +829,11 @@ int WavSamplerVoice::GetActiveVoiceCount() const {
     return count;
 }
 
+bool WavSamplerVoice::IsSilent() const {
+    return !m_swapPending.load(std::memory_order_acquire) && GetActiveVoiceCount() == 0 &&
+           m_silence.IsSilent();
+}
+
 // --- Parameters ---
 
 void WavSamplerVoice::SetLevel(float value) { m_level = std::clamp(value, 0.0f, 1.0f); }
@@ -748,16 +850,132 @@ void WavSamplerVoice::SetTuning(float semitones) {
 
 void WavSamplerVoice::SetUseSfzEnvelopes(bool use) { m_useSfzEnvelopes = use; }
 
+void WavSamplerVoice::SetStreamingEnabled(bool enabled) {
+    // The I/O thread stays up once started: a streamed map may still be playing.
+    // The streamer is published before the flag the loader reads, so any map
+    // built with streamed samples reaches the audio thread after it.
+    if (enabled && !m_streamer.load(std::memory_order_relaxed)) {
+        SampleStreamer* streamer = new SampleStreamer();
+        streamer->Start(m_sampleRate);
+        m_streamer.store(streamer, std::memory_order_release);
+    }
+    m_streamingEnabled.store(enabled, std::memory_order_release);
+}
+
 void WavSamplerVoice::SetMaxPolyphony(int voices) {
     m_maxPolyphony = std::clamp(voices, 1, kMaxVoices);
-    // Turn off any voices beyond the new limit
+    // Turn off any voices beyond the new limit. Render() only sweeps slots
+    // below the limit, so their streams are let go here.
+    SampleStreamer* streamer = m_streamer.load(std::memory_order_acquire);
     for (int i = m_maxPolyphony; i < kMaxVoices; ++i) {
         m_voices[i].state = SamplerVoiceSlot::State::Off;
+        if (m_voices[i].streaming) {
+            streamer->Disarm(i);
+            m_voices[i].streaming = false;
+        }
     }
 }
 
 // --- Render ---
 
+constexpr float kInt16Scale = 1.0f / 32768.0f;
+constexpr float kInt24Scale = 1.0f / 8388608.0f;
+
+// One resident frame, as floats, into out[0..1]
+static void readFrame(const void* data, SampleEncoding encoding, size_t f, float* out) {
+    switch (encoding) {
+        case SampleEncoding::Float32: {
+            const float* p = static_cast<const float*>(data) + f * 2;
+            out[0] = p[0];
+            out[1] = p[1];
+            break;
+        }
+        case SampleEncoding::Int16: {
+            const int16_t* p = static_cast<const int16_t*>(data) + f * 2;
+            out[0] = static_cast<float>(p[0]) * kInt16Scale;
+            out[1] = static_cast<float>(p[1]) * kInt16Scale;
+            break;
+        }
+        case SampleEncoding::Int24: {
+            const uint8_t* p = static_cast<const uint8_t*>(data) + f * 6;
+            for (int c = 0; c < 2; ++c, p += 3) {
+                const uint32_t bits = (uint32_t(p[0]) << 8) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 24);
+                out[c] = static_cast<float>(static_cast<int32_t>(bits) >> 8) * kInt24Scale;
+            }
+            break;
+        }
+    }
+}
+
+// The four Hermite taps first..first+3 as interleaved floats into y[0..7].
+// Away from the sample edges the taps are contiguous and integer data is
+// converted eight values at a time.
+static void readTaps(const void* data, SampleEncoding encoding, size_t first, float* y) {
+    switch (encoding) {
+        case SampleEncoding::Float32: {
+            const float* p = static_cast<const float*>(data) + first * 2;
+            simd::store(y, simd::load(p));
+            simd::store(y + 4, simd::load(p + 4));
+            break;
+        }
+        case SampleEncoding::Int16: {
+            const int16_t* p = static_cast<const int16_t*>(data) + first * 2;
+            const simd::f4 scale = simd::set1(kInt16Scale);
+            simd::store(y, simd::mul(simd::load_s16(p), scale));
+            simd::store(y + 4, simd::mul(simd::load_s16(p + 4), scale));
+            break;
+        }
+        case SampleEncoding::Int24: {
+            const uint8_t* p = static_cast<const uint8_t*>(data) + first * 6;
+            const simd::f4 scale = simd::set1(kInt24Scale);
+            simd::store(y, simd::mul(simd::load_s24(p), scale));
+            simd::store(y + 4, simd::mul(simd::load_s24(p + 12), scale));
+            break;
+        }
+    }
+}
+
+// 4-point Hermite on one channel of a lane group, in the scalar form's operation order
+static inline simd::f4 hermite(simd::f4 y0, simd::f4 y1, simd::f4 y2, simd::f4 y3, simd::f4 frac) {
+    using namespace simd;
+    const f4 half = set1(0.5f);
+    const f4 c1 = mul(half, sub(y2, y0));
+    const f4 c2 = sub(add(sub(y0, mul(set1(2.5f), y1)), mul(set1(2.0f), y2)), mul(half, y3));
+    const f4 c3 = add(mul(half, sub(y3, y0)), mul(set1(1.5f), sub(y1, y2)));
+    return add(mul(add(mul(add(mul(c3, frac), c2), frac), c1), frac), y1);
+}
+
+// Per-lane SVF (Cytomic/Zavalishin topology). The output is a per-lane mix
+// of the input and the three nodes, which selects lpf (v2), bpf (v1),
+// hpf (v3 - k * v1) or, for lanes without a filter, the input unchanged.
+struct LaneSvf {
+    simd::f4 a1, a2, a3;
+    simd::f4 mixIn, mixV1, mixV2, mixV3;
+
+    simd::f4 Process(simd::f4 x, simd::f4& ic1, simd::f4& ic2) const {
+        using namespace simd;
+        const f4 two = set1(2.0f);
+        const f4 v3 = sub(x, ic2);
+        const f4 v1 = add(mul(a1, ic1), mul(a2, v3));
+        const f4 v2 = add(add(ic2, mul(a2, ic1)), mul(a3, v3));
+        ic1 = sub(mul(two, v1), ic1);
+        ic2 = sub(mul(two, v2), ic2);
+        return add(add(add(mul(mixIn, x), mul(mixV1, v1)), mul(mixV2, v2)), mul(mixV3, v3));
+    }
+};
+
+// Frames until a timed envelope stage ends, counting the frame that ends it,
+// or limit + 1 if that is further away. The phase is stepped exactly as the
+// render loop steps it, so the stage changes on the same frame.
+static size_t framesToStageEnd(bool hold, float phase, float time, float dt, size_t limit) {
+    if (time - phase > dt * static_cast<float>(limit + 2)) return limit + 1;
+    for (size_t n = 1; n <= limit; ++n) {
+        phase += dt;
+        if (hold ? phase >= time : phase / time >= 1.0f) return n;
+    }
+    return limit + 1;
+}
+
 void WavSamplerVoice::Render(float* out_left, float* out_right, size_t size) {
     // Check for pending instrument swap
     CheckSwap();
@@ -765,6 +983,7 @@ void WavSamplerVoice::Render(float* out_left, float* out_right, size_t size) {
     if (!m_mapActive || size == 0) {
         std::memset(out_left, 0, size * sizeof(float));
         std::memset(out_right, 0, size * sizeof(float));
+        m_silence.ProcessPeak(0.0f, size);
         return;
     }
 
@@ -772,23 +991,88 @@ void WavSamplerVoice::Render(float* out_left, float* out_right, size_t size) {
     std::memset(out_left, 0, size * sizeof(float));
     std::memset(out_right, 0, size * sizeof(float));
 
-    const float dt = 1.0f / m_sampleRate;
-
-    // Render each active voice and accumulate
+    // Voices only stream once NoteOn has seen the streamer
+    SampleStreamer* streamer = m_streamer.load(std::memory_order_acquire);
     for (int v = 0; v < m_maxPolyphony; ++v) {
         auto& voice = m_voices[v];
-        if (voice.state == SamplerVoiceSlot::State::Off) continue;
-        if (!voice.sample || !voice.sample->data) continue;
+        if (voice.state == SamplerVoiceSlot::State::Off && voice.streaming) {
+            streamer->Disarm(v);
+            voice.streaming = false;
+        }
+    }
 
-        const WavSample* smp = voice.sample;
-        const float* data = smp->data;   // Interleaved stereo
-        const size_t frames = smp->frameCount;
+    // A bounce runs faster than real time: let the disk catch up with every
+    // frame this block reads (the Hermite taps reach two past the playhead)
+    if (m_offlineRendering.load(std::memory_order_relaxed)) {
+        for (int v = 0; v < m_maxPolyphony; ++v) {
+            const auto& voice = m_voices[v];
+            if (voice.streaming) {
+                const double end = voice.playhead + static_cast<double>(size) * voice.playbackRate;
+                streamer->WaitForFill(v, static_cast<size_t>(end) + 3);
+            }
+        }
+    }
+
+    // Render each group of voices and accumulate
+    bool anyStreaming = false;
+    for (int first = 0; first < m_maxPolyphony; first += kLanes) {
+        anyStreaming |= RenderLaneGroup(first, out_left, out_right, size);
+    }
+    if (anyStreaming) {
+        streamer->Wake();
+    }
+
+    // Apply post-render one-pole low-pass filter if cutoff < 1.0
+    if (m_filterCutoff < 0.999f) {
+        const float freq = 20.0f * std::pow(1000.0f, m_filterCutoff);
+        const float w = 2.0f * 3.14159265f * freq / m_sampleRate;
+        const float coeff = std::clamp(w / (1.0f + w), 0.0f, 1.0f);
+
+        for (size_t i = 0; i < size; ++i) {
+            m_filterStateL += coeff * (out_left[i] - m_filterStateL);
+            m_filterStateR += coeff * (out_right[i] - m_filterStateR);
+            out_left[i] = m_filterStateL;
+            out_right[i] = m_filterStateR;
+        }
+    }
+
+    m_silence.Process(out_left, out_right, size);
+}
 
-        // Per-sample volume (dB to linear) and pan (-100..+100)
-        const float volGain = std::pow(10.0f, smp->volume / 20.0f);
-        const float panNorm = smp->pan / 100.0f;  // -1 to +1
-        const float gainL = volGain * std::min(1.0f, 1.0f - panNorm);
-        const float gainR = volGain * std::min(1.0f, 1.0f + panNorm);
+bool WavSamplerVoice::RenderLaneGroup(int first, float* out_left, float* out_right, size_t size) {
+    using namespace simd;
+    using State = SamplerVoiceSlot::State;
+    static_assert(kLanes == kWidth, "one voice per SIMD lane");
+    static_assert(kMaxVoices % kLanes == 0, "lane groups cover the voice pool");
+
+    bool active[kLanes];
+    bool anyActive = false;
+    for (int l = 0; l < kLanes; ++l) {
+        const SamplerVoiceSlot& voice = m_voices[first + l];
+        active[l] = voice.state != State::Off && voice.sample && voice.sample->data;
+        anyActive |= active[l];
+    }
+    if (!anyActive) return false;
+
+    // Lane constants for this block; lanes without a voice get zero gain
+    alignas(16) float velGain[kLanes], gainL[kLanes], gainR[kLanes];
+    alignas(16) float svfA1[kLanes], svfA2[kLanes], svfA3[kLanes];
+    alignas(16) float mixIn[kLanes], mixV1[kLanes], mixV2[kLanes], mixV3[kLanes];
+    EnvelopeTimes times[kLanes];
+    bool starved[kLanes] = {};
+    bool anySvf = false;
+    bool anyStreaming = false;
+    for (int l = 0; l < kLanes; ++l) {
+        const SamplerVoiceSlot& voice = m_voices[first + l];
+        velGain[l] = gainL[l] = gainR[l] = 0.0f;
+        svfA1[l] = svfA2[l] = svfA3[l] = 0.0f;
+        mixIn[l] = 1.0f;
+        mixV1[l] = mixV2[l] = mixV3[l] = 0.0f;
+        if (!active[l]) continue;
+
+        const WavSample* smp = voice.sample;
+        anyStreaming |= voice.streaming;
+        times[l] = GetEnvelopeTimes(smp);
 
         // Velocity tracking: amp_veltrack controls how much velocity affects volume
         float veltrack = 1.0f;
@@ -796,140 +1080,295 @@ void WavSamplerVoice::Render(float* out_left, float* out_right, size_t size) {
             veltrack = smp->amp_veltrack / 100.0f;
         }
         // velGain: when veltrack=100%, equals velocity; when veltrack=0%, equals 1.0
-        float velGain = 1.0f - veltrack + veltrack * voice.velocity;
-
-        // Per-voice SVF filter coefficients (computed once per voice per block)
-        bool hasSvf = m_useSfzEnvelopes && smp->cutoff > 0.0f;
-        float svfG = 0.0f, svfK = 0.0f, svfA1 = 0.0f, svfA2 = 0.0f, svfA3 = 0.0f;
-        if (hasSvf) {
-            float cutHz = smp->cutoff;
-            if (cutHz > m_sampleRate * 0.49f) cutHz = m_sampleRate * 0.49f;
-            svfG = std::tan(3.14159265f * cutHz / m_sampleRate);
-            // resonance in dB (0-40 range typical) → damping factor
-            svfK = 2.0f - 2.0f * std::min(smp->resonance, 40.0f) / 40.0f;
-            if (svfK < 0.01f) svfK = 0.01f;
-            svfA1 = 1.0f / (1.0f + svfG * (svfG + svfK));
-            svfA2 = svfG * svfA1;
-            svfA3 = svfG * svfA2;
+        velGain[l] = 1.0f - veltrack + veltrack * voice.velocity;
+        gainL[l] = voice.gainL;
+        gainR[l] = voice.gainR;
+
+        if (m_useSfzEnvelopes && smp->cutoff > 0.0f) {
+            anySvf = true;
+            svfA1[l] = voice.svfA1;
+            svfA2[l] = voice.svfA2;
+            svfA3[l] = voice.svfA3;
+            // Select output based on fil_type: 0=lpf, 1=hpf, 2=bpf
+            mixIn[l] = 0.0f;
+            if (smp->fil_type == 1) {
+                mixV1[l] = -voice.svfK;
+                mixV3[l] = 1.0f;
+            } else if (smp->fil_type == 2) {
+                mixV1[l] = 1.0f;
+            } else {
+                mixV2[l] = 1.0f;
+            }
         }
+    }
 
-        for (size_t i = 0; i < size; ++i) {
-            // Advance envelope
-            float env = AdvanceEnvelope(voice, dt);
-            if (voice.state == SamplerVoiceSlot::State::Off) break;
-
-            // Get sample position
-            double pos = voice.playhead;
-
-            // Loop handling
-            if (smp->loopMode == WavSample::LoopContinuous) {
-                double loopS = static_cast<double>(smp->loopStart);
-                double loopE = static_cast<double>(smp->loopEnd);
-                double loopLen = loopE - loopS;
-                if (loopLen > 0.0 && pos >= loopE) {
-                    pos = loopS + std::fmod(pos - loopS, loopLen);
-                    voice.playhead = pos;
-                }
-            } else if (smp->loopMode == WavSample::LoopSustain) {
-                // Loop only during Attack/Hold/Decay/Sustain — release plays through to end
-                if (voice.state != SamplerVoiceSlot::State::Release) {
-                    double loopS = static_cast<double>(smp->loopStart);
-                    double loopE = static_cast<double>(smp->loopEnd);
-                    double loopLen = loopE - loopS;
-                    if (loopLen > 0.0 && pos >= loopE) {
-                        pos = loopS + std::fmod(pos - loopS, loopLen);
-                        voice.playhead = pos;
-                    }
-                }
+    const float dt = 1.0f / m_sampleRate;
+    const f4 vDt = set1(dt);
+    const f4 vVelGain = load(velGain);
+    const f4 vLevel = set1(m_level);
+    const f4 vGainL = load(gainL);
+    const f4 vGainR = load(gainR);
+    const LaneSvf svf = {load(svfA1), load(svfA2), load(svfA3),
+                         load(mixIn), load(mixV1), load(mixV2), load(mixV3)};
+
+    size_t done = 0;
+    while (done < size) {
+        size_t frames = std::min(kBatchFrames, size - done);
+
+        // Each lane's envelope stage as
+        //   level = clamp((base + slope * phase / time) * (release ? level : 1), floor, ceil)
+        // which is the stage's own formula, and its end level on its last
+        // frame. The run stops at the first stage change, so the loop below
+        // has no per-lane branches.
+        alignas(16) float segTime[kLanes], segBase[kLanes], segSlope[kLanes];
+        alignas(16) float segFeedback[kLanes], segFloor[kLanes], segCeil[kLanes];
+        size_t stageEnd[kLanes];
+        for (int l = 0; l < kLanes; ++l) {
+            segTime[l] = 1.0f;
+            segBase[l] = segSlope[l] = segFeedback[l] = segFloor[l] = segCeil[l] = 0.0f;
+            stageEnd[l] = frames + 1;
+            if (!active[l]) continue;
+
+            const EnvelopeTimes& t = times[l];
+            const State state = m_voices[first + l].state;
+            segCeil[l] = 1.0f;
+            switch (state) {
+                case State::Attack:
+                    segTime[l] = t.attack;
+                    segSlope[l] = 1.0f;
+                    break;
+                case State::Hold:
+                    segTime[l] = t.hold;
+                    segBase[l] = 1.0f;
+                    break;
+                case State::Decay:
+                    segTime[l] = t.decay;
+                    segBase[l] = 1.0f;
+                    segSlope[l] = -(1.0f - t.sustain);
+                    segFloor[l] = std::min(t.sustain, 1.0f);
+                    segCeil[l] = std::max(t.sustain, 1.0f);
+                    break;
+                case State::Sustain:
+                    segBase[l] = segFloor[l] = segCeil[l] = t.sustain;
+                    break;
+                case State::Release:
+                    // Release starts from wherever the level was when note-off happened
+                    segTime[l] = t.release;
+                    segBase[l] = 1.0f;
+                    segSlope[l] = -1.0f;
+                    segFeedback[l] = 1.0f;
+                    segCeil[l] = std::numeric_limits<float>::max();
+                    break;
+                case State::Off:
+                    break;
+            }
+            if (state != State::Sustain) {
+                stageEnd[l] = framesToStageEnd(state == State::Hold, m_envPhase[first + l],
+                                               segTime[l], dt, frames);
+                frames = std::min(frames, stageEnd[l]);
             }
-            // NoLoop and OneShot: no loop wrapping
+        }
 
-            // End-of-sample check
-            if (pos >= static_cast<double>(frames - 1)) {
-                if (voice.state != SamplerVoiceSlot::State::Release) {
-                    voice.state = SamplerVoiceSlot::State::Release;
-                    voice.envPhase = 0.0f;
+        // Pass 1, per lane: loop wrapping, sample end and tap reads
+        for (int l = 0; l < kLanes; ++l) {
+            if (active[l] && ResampleLane(first + l, l, frames, starved[l])) {
+                // Past the last frame the voice is silent; it ends here
+                m_voices[first + l].state = State::Off;
+                stageEnd[l] = frames + 1;
+            } else if (!active[l]) {
+                std::memset(m_batchTaps[l], 0, frames * sizeof(m_batchTaps[l][0]));
+                for (size_t j = 0; j < frames; ++j) {
+                    m_batchFrac[j][l] = 0.0f;
+                    m_batchLive[j][l] = 0.0f;
                 }
-                env = AdvanceEnvelope(voice, dt);
-                if (voice.state == SamplerVoiceSlot::State::Off) break;
-                continue;
             }
+        }
 
-            // 4-point Hermite interpolation for quality pitched playback
-            size_t idx0 = static_cast<size_t>(pos);
-            size_t idx_m1 = (idx0 > 0) ? idx0 - 1 : 0;
-            size_t idx1 = idx0 + 1;
-            size_t idx2 = idx0 + 2;
-            if (idx1 >= frames) idx1 = idx0;
-            if (idx2 >= frames) idx2 = idx1;
-            float frac = static_cast<float>(pos - static_cast<double>(idx0));
-
-            // Hermite cubic for left channel (interleaved stereo: L at even indices)
-            float y0L = data[idx_m1 * 2], y1L = data[idx0 * 2], y2L = data[idx1 * 2], y3L = data[idx2 * 2];
-            float c1L = 0.5f * (y2L - y0L);
-            float c2L = y0L - 2.5f * y1L + 2.0f * y2L - 0.5f * y3L;
-            float c3L = 0.5f * (y3L - y0L) + 1.5f * (y1L - y2L);
-            float sampleL = ((c3L * frac + c2L) * frac + c1L) * frac + y1L;
-
-            // Hermite cubic for right channel (interleaved stereo: R at odd indices)
-            float y0R = data[idx_m1 * 2 + 1], y1R = data[idx0 * 2 + 1], y2R = data[idx1 * 2 + 1], y3R = data[idx2 * 2 + 1];
-            float c1R = 0.5f * (y2R - y0R);
-            float c2R = y0R - 2.5f * y1R + 2.0f * y2R - 0.5f * y3R;
-            float c3R = 0.5f * (y3R - y0R) + 1.5f * (y1R - y2R);
-            float sampleR = ((c3R * frac + c2R) * frac + c1R) * frac + y1R;
-
-            // Per-voice SVF filter (Cytomic/Zavalishin topology)
-            if (hasSvf) {
-                // Left channel
-                float v3L = sampleL - voice.svfIc2eqL;
-                float v1L = svfA1 * voice.svfIc1eqL + svfA2 * v3L;
-                float v2L = voice.svfIc2eqL + svfA2 * voice.svfIc1eqL + svfA3 * v3L;
-                voice.svfIc1eqL = 2.0f * v1L - voice.svfIc1eqL;
-                voice.svfIc2eqL = 2.0f * v2L - voice.svfIc2eqL;
-
-                // Right channel (independent state for true stereo)
-                float v3R = sampleR - voice.svfIc2eqR;
-                float v1R = svfA1 * voice.svfIc1eqR + svfA2 * v3R;
-                float v2R = voice.svfIc2eqR + svfA2 * voice.svfIc1eqR + svfA3 * v3R;
-                voice.svfIc1eqR = 2.0f * v1R - voice.svfIc1eqR;
-                voice.svfIc2eqR = 2.0f * v2R - voice.svfIc2eqR;
-
-                // Select output based on fil_type: 0=lpf, 1=hpf, 2=bpf
-                if (smp->fil_type == 1) {
-                    sampleL = v3L - svfK * v1L;  // HPF
-                    sampleR = v3R - svfK * v1R;
-                } else if (smp->fil_type == 2) {
-                    sampleL = v1L;  // BPF
-                    sampleR = v1R;
-                } else {
-                    sampleL = v2L;  // LPF
-                    sampleR = v2R;
-                }
+        // Pass 2, all lanes at once: envelope, interpolation, filter, gain
+        const f4 segT = load(segTime);
+        const f4 segB = load(segBase);
+        const f4 segS = load(segSlope);
+        const f4 segF = load(segFeedback);
+        const f4 segK = sub(set1(1.0f), segF);
+        const f4 segLo = load(segFloor);
+        const f4 segHi = load(segCeil);
+        f4 env = load(m_envLevel + first);
+        f4 phase = load(m_envPhase + first);
+        f4 ic1L = load(m_svfIc1L + first);
+        f4 ic2L = load(m_svfIc2L + first);
+        f4 ic1R = load(m_svfIc1R + first);
+        f4 ic2R = load(m_svfIc2R + first);
+        alignas(16) float laneL[kLanes], laneR[kLanes];
+
+        for (size_t j = 0; j < frames; ++j) {
+            phase = add(phase, vDt);
+            const f4 t = div(phase, segT);
+            env = mul(add(segB, mul(segS, t)), add(mul(segF, env), segK));
+            env = min(max(env, segLo), segHi);
+
+            // Lane-major taps to one vector per tap and channel
+            f4 yL0 = load(m_batchTaps[0][j]), yR0 = load(m_batchTaps[1][j]);
+            f4 yL1 = load(m_batchTaps[2][j]), yR1 = load(m_batchTaps[3][j]);
+            f4 yL2 = load(m_batchTaps[0][j] + 4), yR2 = load(m_batchTaps[1][j] + 4);
+            f4 yL3 = load(m_batchTaps[2][j] + 4), yR3 = load(m_batchTaps[3][j] + 4);
+            transpose(yL0, yR0, yL1, yR1);
+            transpose(yL2, yR2, yL3, yR3);
+            const f4 frac = load(m_batchFrac[j]);
+            f4 sampleL = hermite(yL0, yL1, yL2, yL3, frac);
+            f4 sampleR = hermite(yR0, yR1, yR2, yR3, frac);
+            if (anySvf) {
+                sampleL = svf.Process(sampleL, ic1L, ic2L);
+                sampleR = svf.Process(sampleR, ic1R, ic2R);
             }
 
             // Apply envelope, velocity tracking, level, and per-sample volume/pan
-            float baseGain = env * velGain * m_level;
-            out_left[i]  += sampleL * baseGain * gainL;
-            out_right[i] += sampleR * baseGain * gainR;
+            const f4 baseGain = mul(mul(mul(env, vVelGain), vLevel), load(m_batchLive[j]));
+            store(laneL, mul(mul(sampleL, baseGain), vGainL));
+            store(laneR, mul(mul(sampleR, baseGain), vGainR));
+
+            // Added one voice at a time, in slot order
+            float& outL = out_left[done + j];
+            float& outR = out_right[done + j];
+            for (int l = 0; l < kLanes; ++l) {
+                outL += laneL[l];
+                outR += laneR[l];
+            }
+        }
+
+        store(m_envLevel + first, env);
+        store(m_envPhase + first, phase);
+        store(m_svfIc1L + first, ic1L);
+        store(m_svfIc2L + first, ic2L);
+        store(m_svfIc1R + first, ic1R);
+        store(m_svfIc2R + first, ic2R);
+
+        // Stage changes on the run's last frame
+        anyActive = false;
+        for (int l = 0; l < kLanes; ++l) {
+            if (!active[l]) continue;
+            const int slot = first + l;
+            SamplerVoiceSlot& voice = m_voices[slot];
+            if (stageEnd[l] == frames) {
+                m_envPhase[slot] = 0.0f;
+                switch (voice.state) {
+                    case State::Attack:
+                        m_envLevel[slot] = 1.0f;
+                        voice.state = times[l].hold > 0.0f ? State::Hold : State::Decay;
+                        break;
+                    case State::Hold:
+                        voice.state = State::Decay;
+                        break;
+                    case State::Decay:
+                        m_envLevel[slot] = times[l].sustain;
+                        voice.state = State::Sustain;
+                        break;
+                    default:
+                        voice.state = State::Off;
+                        break;
+                }
+            }
+            if (voice.state == State::Off) {
+                m_envLevel[slot] = 0.0f;
+                active[l] = false;
+            }
+            anyActive |= active[l];
+        }
+        done += frames;
+        if (!anyActive) break;
+    }
 
-            // Advance playhead
-            voice.playhead += voice.playbackRate;
+    for (int l = 0; l < kLanes; ++l) {
+        SamplerVoiceSlot& voice = m_voices[first + l];
+        if (voice.streaming) {
+            // Frames behind the interpolation window may be recycled
+            const size_t pos = static_cast<size_t>(voice.playhead);
+            m_streamer.load(std::memory_order_relaxed)->SetReadPosition(first + l, pos > 0 ? pos - 1 : 0);
+            if (starved[l]) m_streamStarvations.fetch_add(1, std::memory_order_relaxed);
         }
     }
+    return anyStreaming;
+}
 
-    // Apply post-render one-pole low-pass filter if cutoff < 1.0
-    if (m_filterCutoff < 0.999f) {
-        const float freq = 20.0f * std::pow(1000.0f, m_filterCutoff);
-        const float w = 2.0f * 3.14159265f * freq / m_sampleRate;
-        const float coeff = std::clamp(w / (1.0f + w), 0.0f, 1.0f);
+bool WavSamplerVoice::ResampleLane(int slot, int lane, size_t frames, bool& starved) {
+    SamplerVoiceSlot& voice = m_voices[slot];
+    const WavSample* smp = voice.sample;
+    const void* data = smp->data;    // Interleaved stereo in smp->encoding
+    const SampleEncoding encoding = smp->encoding;
+    const size_t sampleFrames = smp->frameCount;
+
+    // Streamed voices read frames past the head from their ring; frames
+    // the I/O thread has not reached yet play as silence
+    const size_t head = voice.streaming ? smp->headFrames : sampleFrames;
+    const SampleStreamer* streamer = voice.streaming ? m_streamer.load(std::memory_order_relaxed) : nullptr;
+    const size_t streamed = streamer ? streamer->Available(slot) : sampleFrames;
+    const float* ring = streamer ? streamer->Ring(slot) : nullptr;
+    constexpr size_t kRingMask = SampleStreamer::kRingFrames - 1;
+    auto frameAt = [&](size_t f, float* out) {
+        if (f < head) {
+            readFrame(data, encoding, f, out);
+        } else {
+            const float* p = ring + (f & kRingMask) * 2;
+            out[0] = p[0];
+            out[1] = p[1];
+        }
+    };
 
-        for (size_t i = 0; i < size; ++i) {
-            m_filterStateL += coeff * (out_left[i] - m_filterStateL);
-            m_filterStateR += coeff * (out_right[i] - m_filterStateR);
-            out_left[i] = m_filterStateL;
-            out_right[i] = m_filterStateR;
+    // Loop handling: continuous loops always wrap, sustain loops until the
+    // release (which plays through to the end); NoLoop and OneShot never do
+    const bool looping = smp->loopMode == WavSample::LoopContinuous
+        || (smp->loopMode == WavSample::LoopSustain && voice.state != SamplerVoiceSlot::State::Release);
+    const double loopS = static_cast<double>(smp->loopStart);
+    const double loopE = static_cast<double>(smp->loopEnd);
+    const double loopLen = loopE - loopS;
+    const bool wraps = looping && loopLen > 0.0;
+    const double last = static_cast<double>(sampleFrames - 1);
+
+    double pos = voice.playhead;
+    bool ended = false;
+    for (size_t j = 0; j < frames; ++j) {
+        if (wraps && pos >= loopE) {
+            pos = loopS + std::fmod(pos - loopS, loopLen);
+        }
+
+        // Taps as floats, L/R interleaved: y[0..1] = idx_m1 ... y[6..7] = idx2
+        float* y = m_batchTaps[lane][j];
+        float frac = 0.0f;
+        float live = 0.0f;
+        if (!ended && pos >= last) {
+            ended = true;
         }
+        if (!ended) {
+            // 4-point Hermite interpolation for quality pitched playback
+            size_t idx0 = static_cast<size_t>(pos);
+            size_t idx_m1 = (idx0 > 0) ? idx0 - 1 : 0;
+            size_t idx1 = idx0 + 1;
+            size_t idx2 = idx0 + 2;
+            if (idx1 >= sampleFrames) idx1 = idx0;
+            if (idx2 >= sampleFrames) idx2 = idx1;
+            frac = static_cast<float>(pos - static_cast<double>(idx0));
+
+            if (idx2 < head && idx2 == idx_m1 + 3) {
+                readTaps(data, encoding, idx_m1, y);
+                live = 1.0f;
+            } else if (idx2 < streamed) {
+                frameAt(idx_m1, y);
+                frameAt(idx0, y + 2);
+                frameAt(idx1, y + 4);
+                frameAt(idx2, y + 6);
+                live = 1.0f;
+            } else {
+                starved = true;
+            }
+            pos += voice.playbackRate;
+        }
+        if (live == 0.0f) std::memset(y, 0, 8 * sizeof(float));
+
+        m_batchFrac[j][lane] = frac;
+        m_batchLive[j][lane] = live;
     }
+
+    voice.playhead = pos;
+    return ended;
 }
 
 } // namespace Grainulator
@@ -15,13 +15,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <string>
+
+#include "SampleLoader.h"
+#include "SilenceDetector.h"
 
 namespace Grainulator {
 
+class SampleStreamer;
+
 // --- Sample data structures (built during load, read-only on audio thread) ---
 
 struct WavSample {
-    float* data;            // Interleaved stereo PCM (even mono is stored as stereo)
+    void* data;             // Interleaved stereo PCM (even mono is stored as stereo)
+    SampleEncoding encoding;// Format of data (the streaming ring is always float)
     size_t frameCount;      // Total frames
     int sampleRate;         // Original sample rate
     int rootNote;           // MIDI note this sample was recorded at
@@ -73,6 +80,12 @@ struct WavSample {
 
     // SFZ pitch
     float pitch_keytrack;   // cents/key, -1 = use 100 (default: -1)
+
+    // Disk streaming: data holds only frames [0, headFrames) and the rest is
+    // decoded from streamPath while a voice plays. streamPath is nullptr
+    // (and headFrames == frameCount) for a sample that is fully in memory.
+    size_t headFrames;
+    char* streamPath;       // Owned by the SampleMap
 };
 
 struct SampleMap {
@@ -91,8 +104,26 @@ struct SampleMap {
     // When true, FindSample uses lovel/hivel ranges instead of dynamicLayer/totalDynamics
     bool useSfzVelocity;
 
+    // Region lookup, built with the map so note-on is O(1) and allocation-free.
+    // zoneTable[note][bucket] is a run of regionList: the candidate sample
+    // indices in round-robin order. The bucket is the 0-127 velocity in SFZ
+    // mode, and the dynamic layer (1..zoneLayers[note]) in mx.samples mode.
+    struct Zone {
+        int first;              // Index into regionList
+        int count;              // 0 = nothing plays
+    };
+    Zone zoneTable[128][128];
+    int zoneLayers[128];        // mx.samples: dynamic layers at the nearest sampled note
+    int* regionList;            // Sample indices (owned)
+    int regionListSize;
+
     // Instrument name (derived from directory or SFZ filename)
     char instrumentName[256];
+
+    // Set when the map was loaded from the instrument cache: sample data and
+    // stream paths point into this read-only mapping instead of being owned
+    void* cacheMapping;
+    size_t cacheMappingBytes;
 };
 
 // --- Polyphonic voice slot ---
@@ -107,18 +138,18 @@ struct SamplerVoiceSlot {
     double playhead;        // Current position in sample (fractional frames)
     const WavSample* sample;// Pointer to the sample being played
 
-    // ADSR envelope state
-    float envLevel;         // Current envelope level (0.0-1.0)
-    float envPhase;         // Time in current envelope phase (seconds)
-
-    // Per-voice SVF filter state (used when sample has cutoff > 0)
-    float svfIc1eqL;        // left integrator state 1
-    float svfIc2eqL;        // left integrator state 2
-    float svfIc1eqR;        // right integrator state 1
-    float svfIc2eqR;        // right integrator state 2
+    // Fixed for the note, computed at note-on: the sample's volume/pan gains
+    // and the coefficients of its SVF (used when sample has cutoff > 0).
+    // Envelope and filter state live in WavSamplerVoice's lane arrays.
+    float gainL;
+    float gainR;
+    float svfA1, svfA2, svfA3, svfK;
 
     // Timestamp for voice stealing (lower = older)
     uint64_t startTime;
+
+    // Reading from the SampleStreamer stream with this slot's index
+    bool streaming;
 };
 
 // --- Main voice class ---
@@ -143,6 +174,16 @@ class WavSamplerVoice {
     // atomically swaps when ready.
     bool LoadFromSfzFile(const char* sfzPath);
 
+    // Both loaders decode on a thread pool, report progress and can be
+    // cancelled from another thread; a cancelled load returns false and
+    // keeps the current instrument.
+    float GetLoadProgress() const { return m_loadControl.Progress(); }
+    void CancelLoad() { m_loadControl.cancelled.store(true, std::memory_order_relaxed); }
+
+    // Directory for the binary instrument cache (see InstrumentCache.h);
+    // empty disables it. Set before loading, not while a load runs.
+    void SetInstrumentCacheDirectory(const char* path);
+
     void Unload();
     bool IsLoaded() const;
     const char* GetInstrumentName() const;
@@ -155,6 +196,10 @@ class WavSamplerVoice {
     // Active voice count (for metering/diagnostics)
     int GetActiveVoiceCount() const;
 
+    // True once no voice is sounding, no swap is pending and the output
+    // filter has rung out; Render() may be skipped until the next note.
+    bool IsSilent() const;
+
     // Parameters (all 0.0-1.0 normalized unless noted)
     void SetLevel(float value);
     void SetAttack(float value);
@@ -167,7 +212,31 @@ class WavSamplerVoice {
     void SetMaxPolyphony(int voices);      // 1-32, default 16
     void SetUseSfzEnvelopes(bool use);     // Enable per-region SFZ envelopes
 
+    // Compact storage for instruments loaded after this call (off by default):
+    // sample data stays 16- or 24-bit and is converted while interpolating.
+    // Lossless for 16- and 24-bit sources; wider and float ones keep 24 bits.
+    void SetCompactStorageEnabled(bool enabled) { m_compactStorage = enabled; }
+    bool IsCompactStorageEnabled() const { return m_compactStorage; }
+
+    // Disk streaming for instruments loaded after this call (off by default):
+    // samples keep a short head in memory and unlooped ones stream the rest
+    // from disk. Enabling starts the I/O thread. Not real-time safe.
+    void SetStreamingEnabled(bool enabled);
+    bool IsStreamingEnabled() const { return m_streamingEnabled.load(std::memory_order_relaxed); }
+
+    // Offline renders wait for the I/O thread to cover each block instead of
+    // playing unread frames as silence. Set by AudioEngine::renderOffline().
+    void SetOfflineRendering(bool offline) { m_offlineRendering.store(offline, std::memory_order_relaxed); }
+
+    // Blocks in which a voice needed frames the I/O thread had not read yet
+    // (the voice plays silence for them rather than stalling)
+    uint64_t GetStreamStarvationCount() const {
+        return m_streamStarvations.load(std::memory_order_relaxed);
+    }
+
 private:
+    friend struct RegionTableCheck;  // Tools/region_table_check.cpp
+
     static constexpr int kMaxVoices = 32;
 
     float m_sampleRate;
@@ -178,10 +247,32 @@ class WavSamplerVoice {
     SampleMap* m_mapLoading;
     std::atomic<bool> m_swapPending;
     SampleMap* m_pendingFree;   // Old map awaiting deferred free
+    uint64_t m_pendingFreePass; // SampleStreamer pass that must finish before it is freed
+
+    // Voices render in groups of kLanes adjacent slots, one SIMD lane each
+    static constexpr int kLanes = 4;
+    static constexpr size_t kBatchFrames = 64;
 
     // Polyphonic voice pool (pre-allocated, no audio-thread allocs)
     SamplerVoiceSlot m_voices[kMaxVoices];
     int m_maxPolyphony;
+
+    // Per-voice envelope and SVF state by slot, structure-of-arrays so a
+    // lane group loads as one vector
+    alignas(16) float m_envLevel[kMaxVoices];   // 0.0-1.0
+    alignas(16) float m_envPhase[kMaxVoices];   // Seconds into the current stage
+    alignas(16) float m_svfIc1L[kMaxVoices];
+    alignas(16) float m_svfIc2L[kMaxVoices];
+    alignas(16) float m_svfIc1R[kMaxVoices];
+    alignas(16) float m_svfIc2R[kMaxVoices];
+
+    // Render scratch for one lane group and up to kBatchFrames frames: each
+    // lane's four Hermite taps (L, R interleaved), and per frame the lanes'
+    // fractions and 1 for frames that play or 0 for frames past the sample
+    // end or not yet streamed
+    alignas(16) float m_batchTaps[kLanes][kBatchFrames][8];
+    alignas(16) float m_batchFrac[kBatchFrames][kLanes];
+    alignas(16) float m_batchLive[kBatchFrames][kLanes];
     uint64_t m_voiceCounter;    // Monotonic counter for voice age
 
     // Round-robin state per note
@@ -197,6 +288,18 @@ class WavSamplerVoice {
     // Post-render one-pole low-pass filter state
     float m_filterStateL;
     float m_filterStateR;
+    SilenceDetector m_silence;
+
+    // Disk streaming (owned; created on first enable, published with release)
+    std::atomic<SampleStreamer*> m_streamer;
+    std::atomic<bool> m_streamingEnabled;
+    std::atomic<bool> m_offlineRendering;
+    std::atomic<uint64_t> m_streamStarvations;
+
+    // Loader thread
+    bool m_compactStorage;
+    SampleLoadControl m_loadControl;
+    std::string m_cacheDirectory;
 
     // Apply the pending SampleMap swap if flagged (called at top of Render)
     void CheckSwap();
@@ -204,7 +307,17 @@ class WavSamplerVoice {
     // Free a SampleMap and all its sample data
     static void FreeSampleMap(SampleMap* map);
 
-    // Find the best sample for a given note + velocity from the active map
+    // Fill zoneTable/zoneLayers/regionList from the sorted samples (loader thread)
+    static void BuildRegionTable(SampleMap* map);
+
+    // Finish a loaded map and hand it to the audio thread
+    void PublishMap(SampleMap* map);
+
+    // Storage settings for the next load
+    SampleLoadOptions CurrentLoadOptions() const;
+
+    // Find the best sample for a given note + velocity from the active map.
+    // Advances the note's round-robin cursor.
     const WavSample* FindSample(int note, float velocity);
 
     // Find a free voice slot, or steal the oldest
@@ -213,8 +326,21 @@ class WavSamplerVoice {
     // Compute playback rate for pitch shifting (includes sample transpose/tune)
     float ComputePlaybackRate(int targetNote, const WavSample* smp) const;
 
-    // Advance ADSR envelope for a voice slot, returns current level
-    float AdvanceEnvelope(SamplerVoiceSlot& voice, float dt);
+    // ADSR stage times in seconds and the sustain level for a voice: the
+    // region's SFZ ampeg_* values when enabled, else the knobs
+    struct EnvelopeTimes {
+        float attack, hold, decay, sustain, release;
+    };
+    EnvelopeTimes GetEnvelopeTimes(const WavSample* sample) const;
+
+    // Render the kLanes voices from slot first and add them to the output.
+    // Returns true if any of them streams.
+    bool RenderLaneGroup(int first, float* out_left, float* out_right, size_t size);
+
+    // Resample the next frames of a voice into its lane of the batch
+    // scratch. Returns true if the voice reached the end of its sample;
+    // sets starved if the stream had not delivered a frame yet.
+    bool ResampleLane(int slot, int lane, size_t frames, bool& starved);
 
     WavSamplerVoice(const WavSamplerVoice&) = delete;
     WavSamplerVoice& operator=(const WavSamplerVoice&) = delete;
@@ -89,6 +89,16 @@ struct tsf_stream
 // Generic SoundFont loading method using the stream structure above
 TSFDEF tsf* tsf_load(struct tsf_stream* stream);
 
+// Grainulator: loading with flags. TSF_LOAD_COMPACT_SAMPLES keeps the 16-bit
+// sample data as it is in the file (half the memory of the float expansion)
+// and converts it while rendering, with identical output. Ignored for
+// Ogg Vorbis compressed fonts, which are always decoded to float.
+enum { TSF_LOAD_COMPACT_SAMPLES = 1 };
+TSFDEF tsf* tsf_load_ex(struct tsf_stream* stream, int flags);
+#ifndef TSF_NO_STDIO
+TSFDEF tsf* tsf_load_filename_ex(const char* filename, int flags);
+#endif
+
 // Copy a tsf instance from an existing one, use tsf_close to close it as well.
 // All copied tsf instances and their original instance are linked, and share the underlying soundfont.
 // This allows loading a soundfont only once, but using it for multiple independent playbacks.
@@ -331,6 +341,7 @@ struct tsf
 {
 	struct tsf_preset* presets;
 	float* fontSamples;
+	short* fontSamplesShort; // Grainulator: set instead of fontSamples by TSF_LOAD_COMPACT_SAMPLES
 	struct tsf_voice* voices;
 	struct tsf_channels* channels;
 
@@ -349,6 +360,11 @@ struct tsf
 static int tsf_stream_stdio_read(FILE* f, void* ptr, unsigned int size) { return (int)fread(ptr, 1, size, f); }
 static int tsf_stream_stdio_skip(FILE* f, unsigned int count) { return !fseek(f, count, SEEK_CUR); }
 TSFDEF tsf* tsf_load_filename(const char* filename)
+{
+	return tsf_load_filename_ex(filename, 0);
+}
+
+TSFDEF tsf* tsf_load_filename_ex(const char* filename, int flags)
 {
 	tsf* res;
 	struct tsf_stream stream = { TSF_NULL, (int(*)(void*,void*,unsigned int))&tsf_stream_stdio_read, (int(*)(void*,unsigned int))&tsf_stream_stdio_skip };
@@ -363,7 +379,7 @@ TSFDEF tsf* tsf_load_filename(const char* filename)
 		return TSF_NULL;
 	}
 	stream.data = f;
-	res = tsf_load(&stream);
+	res = tsf_load_ex(&stream, flags);
 	fclose(f);
 	return res;
 }
@@ -972,11 +988,12 @@ static int tsf_decode_sf3_samples(const void* rawBuffer, float** pFloatBuffer, u
 }
 #endif
 
-static int tsf_load_samples(void** pRawBuffer, float** pFloatBuffer, unsigned int* pSmplCount, struct tsf_riffchunk *chunkSmpl, struct tsf_stream* stream)
+static int tsf_load_samples(void** pRawBuffer, float** pFloatBuffer, short** pShortBuffer, unsigned int* pSmplCount, struct tsf_riffchunk *chunkSmpl, struct tsf_stream* stream, int flags)
 {
 	#ifdef STB_VORBIS_INCLUDE_STB_VORBIS_H
 	// With OGG Vorbis support we cannot pre-allocate the memory for tsf_decode_sf3_samples
 	tsf_u32 resNum, resMax; float* oldres;
+	(void)pShortBuffer; (void)flags;
 	*pSmplCount = chunkSmpl->size;
 	*pRawBuffer = (void*)TSF_MALLOC(*pSmplCount);
 	if (!*pRawBuffer || !stream->read(stream->data, *pRawBuffer, chunkSmpl->size)) return 0;
@@ -994,6 +1011,13 @@ static int tsf_load_samples(void** pRawBuffer, float** pFloatBuffer, unsigned in
 	float *res, *out; const short *in;
 	(void)pRawBuffer;
 	*pSmplCount = chunkSmpl->size / (unsigned int)sizeof(short);
+	if (flags & TSF_LOAD_COMPACT_SAMPLES)
+	{
+		// Grainulator: keep the samples as shorts; a trailing odd byte is skipped
+		*pShortBuffer = (short*)TSF_MALLOC(*pSmplCount * sizeof(short));
+		if (!*pShortBuffer || !stream->read(stream->data, *pShortBuffer, *pSmplCount * sizeof(short))) return 0;
+		return (chunkSmpl->size % sizeof(short) ? stream->skip(stream->data, 1) : 1);
+	}
 	*pFloatBuffer = (float*)TSF_MALLOC(*pSmplCount * sizeof(float));
 	if (!*pFloatBuffer || !stream->read(stream->data, *pFloatBuffer, chunkSmpl->size)) return 0;
 	for (res = *pFloatBuffer, out = res + *pSmplCount, in = (short*)res + *pSmplCount; out != res;)
@@ -1217,10 +1241,35 @@ static void tsf_voice_calcpitchratio(struct tsf_voice* v, float pitchShift, floa
 	v->pitchOutputFactor = v->region->sample_rate / (tsf_timecents2Secsd(v->region->pitch_keycenter * 100.0) * outSampleRate);
 }
 
+// Grainulator: a font sample as float. Compact samples are scaled by a float
+// multiply (within an ulp of tsf_load_samples' divide), and the short or float
+// source is picked once per block rather than tested per sample.
+#define TSF_FLOAT_SAMPLE(i) (input[i])
+#define TSF_SHORT_SAMPLE(i) ((float)inputShort[i] * (1.0f / 32767.0f))
+
+#define TSF_VOICE_RENDER_LOOP(TSF_INPUT_SAMPLE, TSF_OUTPUT) \
+	while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl) \
+	{ \
+		unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1); \
+		/* Simple linear interpolation. */ \
+		float alpha = (float)(tmpSourceSamplePosition - pos), val = (TSF_INPUT_SAMPLE(pos) * (1.0f - alpha) + TSF_INPUT_SAMPLE(nextPos) * alpha); \
+		/* Low-pass filter. */ \
+		if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val); \
+		TSF_OUTPUT; \
+		/* Next sample. */ \
+		tmpSourceSamplePosition += pitchRatio; \
+		if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0); \
+	}
+
+#define TSF_VOICE_RENDER_BLOCK(TSF_OUTPUT) \
+	if (inputShort) { TSF_VOICE_RENDER_LOOP(TSF_SHORT_SAMPLE, TSF_OUTPUT) } \
+	else { TSF_VOICE_RENDER_LOOP(TSF_FLOAT_SAMPLE, TSF_OUTPUT) }
+
 static void tsf_voice_render(tsf* f, struct tsf_voice* v, float* outputBuffer, int numSamples)
 {
 	struct tsf_region* region = v->region;
 	float* input = f->fontSamples;
+	const short* inputShort = f->fontSamplesShort;
 	float* outL = outputBuffer;
 	float* outR = (f->outputmode == TSF_STEREO_UNWEAVED ? outL + numSamples : TSF_NULL);
 
@@ -1287,63 +1336,16 @@ static void tsf_voice_render(tsf* f, struct tsf_voice* v, float* outputBuffer, i
 		{
 			case TSF_STEREO_INTERLEAVED:
 				gainLeft = gainMono * v->panFactorLeft, gainRight = gainMono * v->panFactorRight;
-				while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl)
-				{
-					unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1);
-
-					// Simple linear interpolation.
-					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-
-					// Low-pass filter.
-					if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-					*outL++ += val * gainLeft;
-					*outL++ += val * gainRight;
-
-					// Next sample.
-					tmpSourceSamplePosition += pitchRatio;
-					if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0);
-				}
+				TSF_VOICE_RENDER_BLOCK(*outL++ += val * gainLeft; *outL++ += val * gainRight)
 				break;
 
 			case TSF_STEREO_UNWEAVED:
 				gainLeft = gainMono * v->panFactorLeft, gainRight = gainMono * v->panFactorRight;
-				while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl)
-				{
-					unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1);
-
-					// Simple linear interpolation.
-					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-
-					// Low-pass filter.
-					if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-					*outL++ += val * gainLeft;
-					*outR++ += val * gainRight;
-
-					// Next sample.
-					tmpSourceSamplePosition += pitchRatio;
-					if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0);
-				}
+				TSF_VOICE_RENDER_BLOCK(*outL++ += val * gainLeft; *outR++ += val * gainRight)
 				break;
 
 			case TSF_MONO:
-				while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl)
-				{
-					unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1);
-
-					// Simple linear interpolation.
-					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-
-					// Low-pass filter.
-					if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-					*outL++ += val * gainMono;
-
-					// Next sample.
-					tmpSourceSamplePosition += pitchRatio;
-					if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0);
-				}
+				TSF_VOICE_RENDER_BLOCK(*outL++ += val * gainMono)
 				break;
 		}
 
@@ -1358,7 +1360,17 @@ static void tsf_voice_render(tsf* f, struct tsf_voice* v, float* outputBuffer, i
 	if (tmpLowpass.active || dynamicLowpass) v->lowpass = tmpLowpass;
 }
 
+#undef TSF_VOICE_RENDER_BLOCK
+#undef TSF_VOICE_RENDER_LOOP
+#undef TSF_SHORT_SAMPLE
+#undef TSF_FLOAT_SAMPLE
+
 TSFDEF tsf* tsf_load(struct tsf_stream* stream)
+{
+	return tsf_load_ex(stream, 0);
+}
+
+TSFDEF tsf* tsf_load_ex(struct tsf_stream* stream, int flags)
 {
 	tsf* res = TSF_NULL;
 	struct tsf_riffchunk chunkHead;
@@ -1366,6 +1378,7 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 	struct tsf_hydra hydra;
 	void* rawBuffer = TSF_NULL;
 	float* floatBuffer = TSF_NULL;
+	short* shortBuffer = TSF_NULL;
 	tsf_u32 smplCount = 0;
 
 	if (!tsf_riffchunk_read(TSF_NULL, &chunkHead, stream) || !TSF_FourCCEquals(chunkHead.id, "sfbk"))
@@ -1412,9 +1425,9 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 						#ifdef STB_VORBIS_INCLUDE_STB_VORBIS_H
 						|| TSF_FourCCEquals(chunk.id, "smpo")
 						#endif
-					) && !rawBuffer && !floatBuffer && chunk.size >= sizeof(short))
+					) && !rawBuffer && !floatBuffer && !shortBuffer && chunk.size >= sizeof(short))
 				{
-					if (!tsf_load_samples(&rawBuffer, &floatBuffer, &smplCount, &chunk, stream)) goto out_of_memory;
+					if (!tsf_load_samples(&rawBuffer, &floatBuffer, &shortBuffer, &smplCount, &chunk, stream, flags)) goto out_of_memory;
 				}
 				else stream->skip(stream->data, chunk.size);
 			}
@@ -1425,21 +1438,23 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 	{
 		//if (e) *e = TSF_INVALID_INCOMPLETE;
 	}
-	else if (!rawBuffer && !floatBuffer)
+	else if (!rawBuffer && !floatBuffer && !shortBuffer)
 	{
 		//if (e) *e = TSF_INVALID_NOSAMPLEDATA;
 	}
 	else
 	{
 		#ifdef STB_VORBIS_INCLUDE_STB_VORBIS_H
-		if (!floatBuffer && !tsf_decode_sf3_samples(rawBuffer, &floatBuffer, &smplCount, &hydra)) goto out_of_memory;
+		if (!floatBuffer && !shortBuffer && !tsf_decode_sf3_samples(rawBuffer, &floatBuffer, &smplCount, &hydra)) goto out_of_memory;
 		#endif
 		res = (tsf*)TSF_MALLOC(sizeof(tsf));
 		if (res) TSF_MEMSET(res, 0, sizeof(tsf));
 		if (!res || !tsf_load_presets(res, &hydra, smplCount)) goto out_of_memory;
 		res->outSampleRate = 44100.0f;
 		res->fontSamples = floatBuffer;
+		res->fontSamplesShort = shortBuffer;
 		floatBuffer = TSF_NULL; // don't free below
+		shortBuffer = TSF_NULL;
 	}
 	if (0)
 	{
@@ -1451,7 +1466,7 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 	TSF_FREE(hydra.phdrs); TSF_FREE(hydra.pbags); TSF_FREE(hydra.pmods);
 	TSF_FREE(hydra.pgens); TSF_FREE(hydra.insts); TSF_FREE(hydra.ibags);
 	TSF_FREE(hydra.imods); TSF_FREE(hydra.igens); TSF_FREE(hydra.shdrs);
-	TSF_FREE(rawBuffer);   TSF_FREE(floatBuffer);
+	TSF_FREE(rawBuffer);   TSF_FREE(floatBuffer);  TSF_FREE(shortBuffer);
 	return res;
 }
 
@@ -1484,6 +1499,7 @@ TSFDEF void tsf_close(tsf* f)
 		for (; preset != presetEnd; preset++) TSF_FREE(preset->regions);
 		TSF_FREE(f->presets);
 		TSF_FREE(f->fontSamples);
+		TSF_FREE(f->fontSamplesShort);
 		TSF_FREE(f->refCount);
 	}
 	TSF_FREE(f->channels);
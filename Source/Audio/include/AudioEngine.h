@@ -11,21 +11,34 @@
 #include <cstdint>
 #include <atomic>
 #include <array>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <cstring>
+#include <mutex>
 
-// Forward declaration for LadderFilterBase (in global namespace)
-class LadderFilterBase;
+// Forward declaration for LadderFilterBank (in global namespace)
+class LadderFilterBank;
 
 namespace Grainulator {
 
 // Forward declarations
 class PlaitsVoice;
+struct PlaitsVoiceArena;
 class DaisyDrumVoice;
+class DrumHitCache;
 class SoundFontVoice;
 class WavSamplerVoice;
 class MasterCompressor;
+class RenderProfiler;
+struct RenderStageStats;
+class RenderWorkerPool;
+class Freeverb;
+class TapeDelay;
+struct TapeDelayParams;
+class EventTimeline;
+struct TimelineEvent;
+template <typename T, uint32_t Capacity> class MpscQueue;
 
 // Scope buffer constants (for oscilloscope visualization)
 constexpr int kScopeBufferSize = 32768;  // ~682ms @ 48kHz
@@ -92,6 +105,8 @@ class MasterCaptureRingBuffer {
 
 class GranularVoice;
 class ReelBuffer;
+class ReelPagePool;
+class ReelFileLoader;
 class RingsVoice;
 class LooperVoice;
 
@@ -101,7 +116,8 @@ constexpr int kMaxGrains = 128;
 constexpr int kNumGranularVoices = 4;
 constexpr int kNumLooperVoices = 2;
 constexpr int kMaxBufferSize = 2048;
-constexpr int kNumPlaitsVoices = 1;  // Start with single canonical Plaits voice
+constexpr int kMaxPlaitsVoices = 16;     // Plaits voice pool size
+constexpr int kDefaultPlaitsVoices = 1;  // Mono until setPlaitsVoiceCount(), as before the pool
 constexpr int kNumClockOutputs = 8;  // Master clock outputs (Pam's style)
 constexpr int kNumLegacyOutputBuses = 3; // 0=dry, 1=send A, 2=send B
 
@@ -274,7 +290,29 @@ class AudioEngine {
         MasterCompMix,          // 0-1 → dry/wet
         MasterCompEnabled,      // 0 or 1
         MasterCompLimiter,      // 0 or 1
-        MasterCompAutoMakeup    // 0 or 1
+        MasterCompAutoMakeup,   // 0 or 1
+
+        // Behind the dedicated setters below (voiceIndex = mixer channel, drum
+        // lane or clock output; values in the setter's own units), so they
+        // reach the audio thread through the queue and can be scheduled
+        VoiceSendB,             // 0-1 per-channel send B level (VoiceSend is send A)
+        DrumSeqLaneLevel,
+        DrumSeqLaneHarmonics,   // 0-1
+        DrumSeqLaneTimbre,      // 0-1
+        DrumSeqLaneMorph,       // 0-1
+        ClockStartSample,       // Applies the sample passed to setClockStartSample()
+        ClockOutputMode,        // 0=clock, 1=LFO
+        ClockOutputWaveform,    // ClockWaveform enum
+        ClockOutputDivision,    // Division index
+        ClockOutputLevel,       // 0-1
+        ClockOutputOffset,      // -1 to +1
+        ClockOutputPhase,       // 0-1
+        ClockOutputWidth,       // 0-1
+        ClockOutputDestination, // ModulationDestination enum
+        ClockOutputModAmount,   // 0-1
+        ClockOutputMuted,       // 0 or 1
+        ClockOutputSlowMode,    // 0 or 1
+        ClockOutputEuclidean    // Applies the pattern passed to setClockOutputEuclidean()
     };
 
     // Sampler engine mode: SoundFont (.sf2), SFZ, or WAV-based (mx.samples)
@@ -311,6 +349,7 @@ class AudioEngine {
         DelayFeedback,
         DelayWow,
         DelayFlutter,
+        DelayMix,
         // Granular 1
         Granular1Speed,
         Granular1Pitch,
@@ -375,13 +414,18 @@ class AudioEngine {
         }
     }
 
+    /// Queues a parameter change; the audio thread applies it at the top of the next buffer.
+    /// While no audio callback is running the change is applied immediately.
     void setParameter(ParameterID id, int voiceIndex, float value);
     float getParameter(ParameterID id, int voiceIndex) const;
+    /// Parameter changes lost to a full command queue (audio thread not keeping up)
+    uint64_t getDroppedParameterCommandCount() const;
 
     // Channel metering (returns peak level 0-1)
     float getChannelLevel(int channelIndex) const;  // 0=Plaits, 1=Rings, 2-5=tracks
+    float getChannelRMSLevel(int channelIndex) const;  // Post-gain RMS, same smoothing as peak
     float getMasterLevel(int channel) const;        // 0=left, 1=right
-    void setChannelSendLevel(int channelIndex, int sendIndex, float level);
+    void setChannelSendLevel(int channelIndex, int sendIndex, float level);  // Queued (VoiceSend / VoiceSendB)
 
     // Per-channel insert processing (for VST3/AU plugin hosting in C++)
     void setInsertProcessCallback(InsertProcessCallback callback);
@@ -400,7 +444,8 @@ class AudioEngine {
     void triggerPlaits(bool state);
     void triggerDaisyDrum(bool state);
 
-    // Drum sequencer lane control (4 dedicated voices)
+    // Drum sequencer lane control (4 dedicated voices). The setters are queued
+    // like setParameter() (ParameterID::DrumSeqLane*).
     static constexpr int kNumDrumSeqLanes = 4;
     void triggerDrumSeqLane(int laneIndex, bool state);
     void setDrumSeqLaneLevel(int laneIndex, float level);
@@ -419,6 +464,18 @@ class AudioEngine {
     bool loadSfzFile(const char* sfzPath);
     void unloadWavSampler();
     const char* getWavSamplerInstrumentName() const;
+    /// Stream sample bodies from disk on the next load instead of decoding them whole
+    void setSamplerStreamingEnabled(bool enabled);
+    bool isSamplerStreamingEnabled() const;
+    uint64_t getSamplerStreamStarvationCount() const;
+    /// Keep SF2/WAV/SFZ samples as 16/24-bit integers on the next load instead of float
+    void setSamplerCompactStorageEnabled(bool enabled);
+    bool isSamplerCompactStorageEnabled() const;
+    /// Binary instrument cache location (empty disables); set before loading
+    void setSamplerCacheDirectory(const char* path);
+    /// Progress (0-1) of the current or last WAV/SFZ load, and a cancel for it
+    float getSamplerLoadProgress() const;
+    void cancelSamplerLoad();
     void setSamplerMode(SamplerMode mode);
     SamplerMode getSamplerMode() const { return m_samplerMode; }
 
@@ -434,13 +491,27 @@ class AudioEngine {
     void clearScheduledNotes();
     uint64_t getCurrentSampleTime() const;
 
+    // Sample-accurate typed events (dispatched on the audio thread at sampleTime)
+    void scheduleParameter(ParameterID id, int voiceIndex, float value, uint64_t sampleTime);
+    /// Exact form of scheduleParameter(ClockStartSample, ...) for start samples past float precision
+    void scheduleClockStartSample(uint64_t startSample, uint64_t sampleTime);
+    // trigger: 0=Plaits, 1=DaisyDrum, 2=DrumSeqLane (laneIndex selects the lane)
+    void scheduleTrigger(int trigger, int laneIndex, bool state, uint64_t sampleTime);
+    // operation: 0=play, 1=stop, 2=seek (value = 0-1 position), 3=stop recording (index = reel)
+    void scheduleReelOperation(int operation, int index, float value, uint64_t sampleTime);
+
     // Buffer management
+    // Streams WAV/AIFF on a background thread; false if the file can't be opened
     bool loadAudioFile(const char* filePath, int reelIndex);
+    float getReelLoadProgress(int reelIndex) const;  // 0-1 while loading, 1 = idle/done, -1 = failed
     bool loadAudioData(int reelIndex, const float* leftChannel, const float* rightChannel, size_t numSamples, float sampleRate);
     void clearReel(int reelIndex);
     size_t getReelLength(int reelIndex) const;
     float getReelSampleRate(int reelIndex) const;
     size_t copyReelData(int reelIndex, float* leftOut, float* rightOut, size_t maxSamples) const;
+    size_t getReelMemoryUsage(int reelIndex) const;  // Resident bytes of one reel (pages, guards, object)
+    size_t getTotalReelMemoryUsage() const;          // Resident bytes across all reels and the warm page reserve
+    uint64_t getReelDroppedRecordFrames(int reelIndex) const;  // Recorded frames lost to an exhausted page pool
     void getWaveformOverview(int reelIndex, float* output, size_t outputSize) const;
 
     // Wavetable loading
@@ -473,6 +544,20 @@ class AudioEngine {
     bool isMasterCaptureActive() const;
     int readMasterCaptureBuffer(float* left, float* right, int maxFrames);
 
+    // Offline (faster than real time) render of the master mix to a WAV file.
+    // Blocks the caller until done; live render callbacks output silence meanwhile.
+    // The drum hit cache is bypassed and streamed sampler voices wait for the disk,
+    // so a bounce renders the same every time.
+    // The callback runs before each block with the block's start on the engine's
+    // sample clock, so a sequencer can schedule that block's events in time.
+    using OfflineBlockCallback = void (*)(void* context, uint64_t blockStartSample, int numFrames);
+    // bitsPerSample: 16 or 24 (PCM) or 32 (float). Fails if multi-channel processing is running.
+    bool renderOffline(const char* wavPath, uint64_t numFrames, int bitsPerSample,
+                       OfflineBlockCallback callback = nullptr, void* context = nullptr);
+    void cancelOfflineRender();                // Thread-safe; the partial file is deleted
+    bool isOfflineRenderActive() const;
+    float getOfflineRenderProgress() const;    // 0-1
+
     // Quantization
     enum class QuantizationMode {
         None = 0,
@@ -493,7 +578,31 @@ class AudioEngine {
     float getCPULoad() const;
     int getActiveGrainCount() const;
 
-    // Master clock control
+    // Render profiler (path: 0=process(), 1=processMultiChannel(); stage: RenderStage)
+    enum class RenderPath { Mixed = 0, MultiChannel = 1 };
+    bool getRenderStageStats(int path, int stage, RenderStageStats& out) const;
+    uint64_t getDeadlineMissCount(int path) const;
+    void resetRenderProfiler();
+
+    // Parallel voice rendering: number of worker threads helping the render
+    // callback (0 = render all voices on the calling thread). Real-time safe.
+    void setRenderWorkerCount(int count);
+    int getRenderWorkerCount() const;
+
+    // Plaits polyphony: voices available to new notes (1-kMaxPlaitsVoices,
+    // default 1). The channel is scaled by 1/sqrt(count). Real-time safe.
+    void setPlaitsVoiceCount(int count);
+    int getPlaitsVoiceCount() const;
+
+    // Drum sequencer lanes play repeated, unmodulated hits from pre-rendered
+    // buffers (on by default). Real-time safe.
+    void setDrumHitCacheEnabled(bool enabled);
+    bool isDrumHitCacheEnabled() const;
+
+    // Master clock control. The setters here and for the outputs below are
+    // queued like setParameter(), so the audio thread never sees a half-applied
+    // change. The exceptions write single atomics the audio thread polls:
+    // resetClockOutput(), setClockOutputQuantize() and setTimeSignature().
     void setClockBPM(float bpm);
     void setClockRunning(bool running);
     void setClockStartSample(uint64_t startSample);  // Sync clock to sequencer
@@ -535,17 +644,6 @@ class AudioEngine {
     float getQuarterNotesPerBar() const;
 
 private:
-    struct ScheduledNoteEvent {
-        uint64_t sampleTime;
-        uint8_t note;
-        uint8_t velocity;
-        bool isNoteOn;
-        uint8_t targetMask;
-        uint8_t trackId;  // 0 = keyboard/untagged, 1+ = sequencer track
-    };
-
-    static constexpr uint32_t kScheduledEventCapacity = 4096;
-
     // Internal state
     int m_sampleRate;
     int m_bufferSize;
@@ -555,22 +653,51 @@ class AudioEngine {
     // Performance monitoring
     std::atomic<float> m_cpuLoad;
     std::atomic<int> m_activeGrains;
+    std::unique_ptr<RenderProfiler> m_renderProfiler;        // process()
+    std::unique_ptr<RenderProfiler> m_multiChannelProfiler;  // processMultiChannel()
+    std::unique_ptr<RenderProfiler> m_offlineProfiler;       // Offline bounces, kept out of the live stats
+    void publishCPULoad(float callbackLoad);
+    void processBlock(float** inputBuffers, float** outputBuffers, int numChannels, int numFrames);
+
+    // Offline render state. Live render entry points register in
+    // m_liveRendersInFlight and back off while a bounce owns the engine.
+    std::atomic<bool> m_offlineRenderActive{false};
+    std::atomic<bool> m_offlineRenderCancelled{false};
+    std::atomic<float> m_offlineRenderProgress{0.0f};
+    std::atomic<int> m_liveRendersInFlight{0};
+    // Set while a control thread applies parameters directly (engine stopped)
+    std::atomic<bool> m_directParameterApply{false};
+    std::atomic<int64_t> m_lastLiveRenderNanos{0};
+    struct LiveRenderScope {
+        AudioEngine& engine;
+        bool entered;
+        explicit LiveRenderScope(AudioEngine& e) : engine(e) {
+            engine.m_liveRendersInFlight.fetch_add(1);
+            entered = !engine.m_offlineRenderActive.load() && !engine.m_directParameterApply.load();
+            if (!entered) engine.m_liveRendersInFlight.fetch_sub(1);
+            engine.m_lastLiveRenderNanos.store(steadyNanos(), std::memory_order_relaxed);
+        }
+        ~LiveRenderScope() {
+            if (entered) engine.m_liveRendersInFlight.fetch_sub(1, std::memory_order_release);
+        }
+    };
 
     // Processing buffers
     float* m_processingBuffer[2];
-    float* m_voiceBuffer[2];  // Temp buffer for individual voice rendering
-    float m_tempVoiceL[kMaxBufferSize];  // Pre-allocated temp buffer for voice rendering (avoids stack allocation)
-    float m_tempVoiceR[kMaxBufferSize];
-    float m_tempDrumSeq[kMaxBufferSize]; // Pre-allocated temp buffer for drum seq rendering
     static constexpr int kMaxOutputChannels = 16;
     float* m_chunkOutputPtrs[kMaxOutputChannels];  // Pre-allocated pointer array for chunked processing
 
-    // Polyphonic Plaits voices
-    std::unique_ptr<PlaitsVoice> m_plaitsVoices[kNumPlaitsVoices];
+    // Polyphonic Plaits voices. Their engine buffers live in one arena array;
+    // only the first m_plaitsVoiceCount voices take new notes.
+    std::unique_ptr<PlaitsVoiceArena[]> m_plaitsArenas;
+    std::unique_ptr<PlaitsVoice> m_plaitsVoices[kMaxPlaitsVoices];
+    std::atomic<int> m_plaitsVoiceCount;
+    float m_plaitsPoolGain;  // Audio thread: 1/sqrt(count) as last applied, ramped on count changes
     std::unique_ptr<RingsVoice> m_ringsVoice;
     std::unique_ptr<DaisyDrumVoice> m_daisyDrumVoice;
     // Drum sequencer: 4 dedicated voices (AnalogKick, SynthKick, AnalogSnare, HiHat)
     std::unique_ptr<DaisyDrumVoice> m_drumSeqVoices[kNumDrumSeqLanes];
+    std::unique_ptr<DrumHitCache> m_drumHitCache;  // Shared by the lanes; updated in the drum job
     // SoundFont sampler voice
     std::unique_ptr<SoundFontVoice> m_soundFontVoice;
     // WAV sampler voice (mx.samples)
@@ -590,15 +717,18 @@ class AudioEngine {
     float m_drumSeqHarmonics[kNumDrumSeqLanes];
     float m_drumSeqTimbre[kNumDrumSeqLanes];
     float m_drumSeqMorph[kNumDrumSeqLanes];
-    int m_voiceNote[kNumPlaitsVoices];         // MIDI note for each voice (-1 = free)
-    uint8_t m_voiceTrackId[kNumPlaitsVoices];  // Track that owns this voice (0 = keyboard)
-    uint32_t m_voiceAge[kNumPlaitsVoices];     // For voice stealing (older = lower priority)
+    int m_voiceNote[kMaxPlaitsVoices];         // MIDI note for each voice (-1 = free)
+    uint8_t m_voiceTrackId[kMaxPlaitsVoices];  // Track that owns this voice (0 = keyboard)
+    uint32_t m_voiceAge[kMaxPlaitsVoices];     // For voice stealing (older = lower priority)
     uint32_t m_voiceCounter;                    // Increments on each note-on
 
     // Granular voices (4 tracks)
     std::unique_ptr<GranularVoice> m_granularVoices[kNumGranularVoices];
     std::unique_ptr<LooperVoice> m_looperVoices[kNumLooperVoices];
+    std::unique_ptr<ReelPagePool> m_reelPagePool;   // Page memory for all reels (declared first: outlives them)
     std::unique_ptr<ReelBuffer> m_reelBuffers[32];  // Up to 32 reel buffers
+    std::unique_ptr<ReelFileLoader> m_reelLoader;   // Declared after the reels: stops before they go
+    void assignReelToVoices(int reelIndex);
     int m_activeGranularVoice;  // Currently selected granular voice for parameter control
 
     // Recording state (up to 6 concurrent sessions, one per mixer channel target)
@@ -691,36 +821,27 @@ class AudioEngine {
     float m_reverbDamping;  // 0-1 high freq damping
     float m_reverbMix;      // 0-1 dry/wet
 
-    // Tape echo state (RE-201 style multi-head delay)
-    static constexpr size_t kMaxDelayLength = 192000;  // 4 seconds @ 48kHz
-    float* m_delayBufferL;
-    float* m_delayBufferR;
-    size_t m_delayWritePos;
-    float m_delayTimeSmoothed;
-    float m_tapeWowPhase;
-    float m_tapeFlutterPhase;
-    float m_tapeDrift;
-    float m_tapeFeedbackLP;
-    float m_tapeFeedbackHPIn;
-    float m_tapeFeedbackHPOut;
-    float m_tapeToneL;
-    float m_tapeToneR;
-    uint32_t m_tapeNoiseState;
-
-    // Simple reverb state (Freeverb-style comb + allpass)
-    static constexpr size_t kNumCombs = 8;
-    static constexpr size_t kNumAllpasses = 4;
-    float* m_combBuffersL[kNumCombs];
-    float* m_combBuffersR[kNumCombs];
-    size_t m_combLengths[kNumCombs];
-    size_t m_combPos[kNumCombs];
-    float m_combFilters[kNumCombs];
-    float m_combFiltersR[kNumCombs];  // Right channel damping (symmetric with left)
-
-    float* m_allpassBuffersL[kNumAllpasses];
-    float* m_allpassBuffersR[kNumAllpasses];
-    size_t m_allpassLengths[kNumAllpasses];
-    size_t m_allpassPos[kNumAllpasses];
+    // Tape echo (RE-201 style multi-head delay, block-based)
+    static constexpr size_t kMaxDelayLength = 192000;  // 4 seconds @ 48kHz (TapeDelay::kMaxDelayLength)
+    std::unique_ptr<TapeDelay> m_tapeDelay;
+    float m_delayTimeMod;      // Clock output modulation, set once per buffer
+    float m_delayFeedbackMod;
+    float m_delayMixMod;
+    float m_delayWowMod;
+    float m_delayFlutterMod;
+
+    // Reverb (Freeverb-style comb + allpass, block-based)
+    std::unique_ptr<Freeverb> m_reverb;
+
+    // Effect tail tracking: delay/reverb are skipped once their input and wet
+    // output have both stayed below the floor for the hold time
+    static constexpr float kEffectTailFloor = 1.0e-4f;             // -80 dBFS, above the tape hiss
+    static constexpr int kDelayTailHoldFrames = static_cast<int>(kMaxDelayLength);  // Every head has read past the tail
+    static constexpr int kReverbTailHoldFrames = 12000;            // Several passes through the longest comb
+    float m_delayWetPeak;
+    float m_reverbWetPeak;
+    int m_delayQuietFrames;
+    int m_reverbQuietFrames;
 
     // Effects send buffers (A and B)
     float* m_sendBufferAL;
@@ -750,6 +871,47 @@ class AudioEngine {
     std::array<std::array<float, kMaxChannelDelaySamples + 1>, kNumMixerChannels> m_channelDelayBufferR;
     bool m_channelMute[kNumMixerChannels];
     bool m_channelSolo[kNumMixerChannels];
+    float m_channelPanGainL[kNumMixerChannels];     // Pan law gains for m_channelPanSmoothed
+    float m_channelPanGainR[kNumMixerChannels];
+    int m_mixerSmoothFrames;                        // Chunk length m_mixerSmoothAlpha was computed for
+    float m_mixerSmoothAlpha;
+    float m_stripL[kMaxBufferSize];                 // Channel strip scratch (post gain/pan)
+    float m_stripR[kMaxBufferSize];
+    float m_stripDelayedL[kMaxBufferSize];          // Channel strip scratch (post micro-delay)
+    float m_stripDelayedR[kMaxBufferSize];
+    bool m_channelSilent[kNumMixerChannels];        // Set by the voice jobs when every voice slept this chunk
+    int m_channelSilentFrames[kNumMixerChannels];   // Silent frames fed through the strip (capped at the delay history)
+
+    // Parallel voice rendering. Each job renders one channel's voices into its own
+    // scratch buffers; mixing/recording then runs serially on the callback thread.
+    // Plaits and Rings share a job because both draw from stmlib's global Random.
+    enum VoiceRenderJob {
+        JobPlaitsRings = 0,
+        JobTrack0,
+        JobTrack1,
+        JobTrack2,
+        JobTrack3,
+        JobDrums,
+        JobSampler,
+        kNumVoiceRenderJobs
+    };
+    struct VoiceRenderContext {
+        AudioEngine* engine;
+        int frameCount;
+        bool renderRings;
+    };
+    std::unique_ptr<RenderWorkerPool> m_renderWorkers;
+    float m_channelRenderL[kNumMixerChannels][kMaxBufferSize];
+    float m_channelRenderR[kNumMixerChannels][kMaxBufferSize];
+    float m_drumLaneRender[kNumDrumSeqLanes][kMaxBufferSize];
+    float m_ringsExciterMono[kMaxBufferSize];
+    int m_trackActiveGrains[kNumGranularVoices];
+    uint64_t m_voiceJobTicks[kNumVoiceRenderJobs];
+    uint64_t m_ringsRenderTicks;
+    static void voiceRenderJob(void* context, int jobIndex);
+    void renderVoiceJob(int jobIndex, int frameCount, bool renderRings);
+    void renderRingsVoice(int frameCount);
+    bool renderVoiceChannels(int frameCount, RenderProfiler& profiler);  // Returns true if Rings was rendered
 
     // Per-channel insert slots (for external plugin processing via callback)
     struct ChannelInsertSlot {
@@ -775,11 +937,9 @@ class AudioEngine {
     float m_masterFilterCutoff;     // 20-20000 Hz
     float m_masterFilterResonance;  // 0-1
     int m_masterFilterModel;        // Index of selected filter model
-    std::unique_ptr<LadderFilterBase> m_masterFilterL;
-    std::unique_ptr<LadderFilterBase> m_masterFilterR;
+    std::unique_ptr<LadderFilterBank> m_masterFilter;
     void initMasterFilter();
-    void updateMasterFilterParameters();
-    void processMasterFilter(float& left, float& right);
+    void processMasterFilter(float* left, float* right, int numFrames);
 
     // Master compressor
     std::unique_ptr<MasterCompressor> m_masterCompressor;
@@ -788,6 +948,7 @@ class AudioEngine {
 
     // Channel metering (peak levels, updated per buffer)
     std::atomic<float> m_channelLevels[kNumMixerChannels];
+    std::atomic<float> m_channelRmsLevels[kNumMixerChannels];
     std::atomic<float> m_masterLevelL;
     std::atomic<float> m_masterLevelR;
 
@@ -796,11 +957,12 @@ class AudioEngine {
     std::atomic<size_t> m_scopeWriteIndex{0};
 
     // Effects processing helpers
-    void processDelay(float& left, float& right);
-    void processReverb(float& left, float& right);
+    TapeDelayParams delayParams() const;
+    void processDelay(float* left, float* right, int numFrames, const TapeDelayParams& params);
+    void processReverb(float* left, float* right, int numFrames);
     void initEffects();
     void cleanupEffects();
-    bool enqueueScheduledEvent(const ScheduledNoteEvent& event);
+    void dispatchTimelineEvent(const TimelineEvent& event);
     void noteOnTarget(int note, int velocity, uint8_t targetMask);
     void noteOnTarget(int note, int velocity, uint8_t targetMask, uint8_t trackId);
     void noteOffTarget(int note, uint8_t targetMask);
@@ -809,12 +971,48 @@ class AudioEngine {
     // Voice allocation helper
     int allocateVoice(int note, uint8_t trackId);
 
-    // Scheduled event queue state.
-    // Producers are serialized with m_scheduledWriteLock; consumer is the audio thread.
-    std::array<ScheduledNoteEvent, kScheduledEventCapacity> m_scheduledEvents;
-    std::atomic<uint32_t> m_scheduledReadIndex;
-    std::atomic<uint32_t> m_scheduledWriteIndex;
-    std::atomic_flag m_scheduledWriteLock = ATOMIC_FLAG_INIT;
+    // Scheduled events: lock-free MPSC producers, time-ordered heap on the audio thread.
+    std::unique_ptr<EventTimeline> m_eventTimeline;
+
+    // Parameter commands: any thread pushes, the audio thread drains once per buffer.
+    struct ParameterCommand {
+        ParameterID id;
+        int voiceIndex;
+        float value;
+        uint64_t payload;  // ClockStartSample: start sample; ClockOutputEuclidean: packed pattern
+    };
+    static constexpr uint32_t kParameterCommandCapacity = 4096;
+    std::unique_ptr<MpscQueue<ParameterCommand, kParameterCommandCapacity>> m_parameterCommands;
+    std::atomic<uint64_t> m_droppedParameterCommands{0};
+    void drainParameterCommands();
+    void applyParameter(const ParameterCommand& command);
+    void submitParameter(const ParameterCommand& command);
+    static uint64_t parameterPayload(ParameterID id, float value);
+
+    // With no live callback for this long the engine counts as stopped and
+    // setParameter() applies changes itself instead of queuing them.
+    static constexpr int64_t kParameterIdleNanos = 250000000;
+    std::mutex m_directParameterMutex;
+    bool tryApplyParameterDirect(const ParameterCommand& command);
+    static int64_t steadyNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Control-side copy of each queued value, read back by getParameter()
+    // until the audio thread has applied it. Indexed [id][voiceIndex]; only
+    // IDs whose set value is the normalized value getParameter() returns.
+    static constexpr int kNumParameterIDs = static_cast<int>(ParameterID::ClockOutputEuclidean) + 1;
+    static constexpr int kParameterMirrorSlots = 8;
+    std::atomic<float> m_parameterMirror[kNumParameterIDs][kParameterMirrorSlots];
+    std::atomic<int> m_parameterPending[kNumParameterIDs][kParameterMirrorSlots];
+    static bool parameterReadsBackNormalized(ParameterID id);
+    static bool parameterMirrorIndex(const ParameterCommand& command, int& id, int& slot) {
+        id = static_cast<int>(command.id);
+        slot = command.voiceIndex;
+        return id >= 0 && id < kNumParameterIDs && slot >= 0 && slot < kParameterMirrorSlots
+            && parameterReadsBackNormalized(command.id);
+    }
 
     // Master clock state (Pam's Pro Workout-style)
     struct ClockOutputState {
@@ -871,6 +1069,8 @@ class AudioEngine {
     float m_modulationValues[static_cast<int>(ModulationDestination::NumDestinations)];
 
     // Clock processing helpers
+    void resetClockPhases(uint64_t startSample);
+    void applyClockOutputParameter(ParameterID id, ClockOutputState& out, float value, uint64_t payload);
     void processClockOutputs(int numFrames);
     float generateWaveform(int waveform, double phase, float width, ClockOutputState& state);
     void applyModulation();
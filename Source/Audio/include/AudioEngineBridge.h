@@ -54,6 +54,29 @@ void AudioEngine_SetSendReturnLevel(AudioEngineHandle handle, int sendIndex, flo
 // Performance metrics
 float AudioEngine_GetCPULoad(AudioEngineHandle handle);
 
+// Render profiler
+// path: 0=AudioEngine_Process, 1=multi-channel render
+// stage: 0..AudioEngine_GetRenderStageCount()-1 (last stage is the whole callback)
+// Loads are fractions of the callback deadline (1.0 = full budget); max is the peak since reset.
+int AudioEngine_GetRenderStageCount(void);
+const char* AudioEngine_GetRenderStageName(int stage);
+bool AudioEngine_GetRenderStageStats(AudioEngineHandle handle, int path, int stage,
+                                     float* meanLoad, float* p99Load, float* maxLoad, float* meanNsPerSample);
+uint64_t AudioEngine_GetDeadlineMissCount(AudioEngineHandle handle, int path);
+void AudioEngine_ResetRenderProfiler(AudioEngineHandle handle);
+
+// Parallel voice rendering (0 = render all voices on the audio thread)
+void AudioEngine_SetRenderWorkerCount(AudioEngineHandle handle, int count);
+int AudioEngine_GetRenderWorkerCount(AudioEngineHandle handle);
+
+// Plaits polyphony (1-16 voices available to new notes)
+void AudioEngine_SetPlaitsVoiceCount(AudioEngineHandle handle, int count);
+int AudioEngine_GetPlaitsVoiceCount(AudioEngineHandle handle);
+
+// Pre-rendered hits for the drum sequencer lanes (on by default)
+void AudioEngine_SetDrumHitCacheEnabled(AudioEngineHandle handle, bool enabled);
+bool AudioEngine_IsDrumHitCacheEnabled(AudioEngineHandle handle);
+
 // Trigger control
 void AudioEngine_TriggerPlaits(AudioEngineHandle handle, bool state);
 
@@ -67,12 +90,22 @@ void AudioEngine_ScheduleNoteOffTarget(AudioEngineHandle handle, int note, uint6
 void AudioEngine_ScheduleNoteOnTargetTagged(AudioEngineHandle handle, int note, int velocity, uint64_t sampleTime, uint8_t targetMask, uint8_t trackId);
 void AudioEngine_ScheduleNoteOffTargetTagged(AudioEngineHandle handle, int note, uint64_t sampleTime, uint8_t targetMask, uint8_t trackId);
 void AudioEngine_ClearScheduledNotes(AudioEngineHandle handle);
+void AudioEngine_ScheduleParameter(AudioEngineHandle handle, int parameterId, int voiceIndex, float value, uint64_t sampleTime);
+void AudioEngine_ScheduleTrigger(AudioEngineHandle handle, int trigger, int laneIndex, bool state, uint64_t sampleTime);
+void AudioEngine_ScheduleReelOperation(AudioEngineHandle handle, int operation, int index, float value, uint64_t sampleTime);
 uint64_t AudioEngine_GetCurrentSampleTime(AudioEngineHandle handle);
 
 // Granular buffer management
 bool AudioEngine_LoadAudioData(AudioEngineHandle handle, int reelIndex, const float* leftChannel, const float* rightChannel, size_t numSamples, float sampleRate);
+// Streams a WAV/AIFF file into a reel on a background thread. Returns false if
+// the file can't be opened (fall back to decoding it and AudioEngine_LoadAudioData).
+bool AudioEngine_LoadAudioFile(AudioEngineHandle handle, int reelIndex, const char* filePath);
+// 0-1 while loading, 1 when idle/complete, -1 if the last load failed
+float AudioEngine_GetReelLoadProgress(AudioEngineHandle handle, int reelIndex);
 void AudioEngine_ClearReel(AudioEngineHandle handle, int reelIndex);
 size_t AudioEngine_GetReelLength(AudioEngineHandle handle, int reelIndex);
+size_t AudioEngine_GetReelMemoryUsage(AudioEngineHandle handle, int reelIndex);
+size_t AudioEngine_GetTotalReelMemoryUsage(AudioEngineHandle handle);
 float AudioEngine_GetReelSampleRate(AudioEngineHandle handle, int reelIndex);
 size_t AudioEngine_CopyReelData(AudioEngineHandle handle, int reelIndex, float* leftOut, float* rightOut, size_t maxSamples);
 void AudioEngine_GetWaveformOverview(AudioEngineHandle handle, int reelIndex, float* output, size_t outputSize);
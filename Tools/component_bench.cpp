@@ -0,0 +1,611 @@
+//
+//  component_bench.cpp
+//  Grainulator
+//
+//  Per-component render cost for GrainulatorCore. Every component runs in the
+//  same fixture: built and set up untimed, warmed up, then timed rendering
+//  blocks of kBlockSize frames at 48 kHz from a fixed noise input. The best
+//  of --repeat passes is reported as ns per output sample (frame) and as the
+//  share of one core that component needs in real time, so the cost of a
+//  patch can be estimated by adding up its parts.
+//
+//  Components: each ladder filter model (stereo, through LadderFilterBank),
+//  the granular voice at each grain window, ReelBuffer Hermite reads, each
+//  Plaits engine, Rings at polyphony 1/2/4 per resonator model, each DaisySP
+//  drum engine (synthesized, and played from DrumHitCache), the WAV sampler with 32 voices sounding, the master
+//  compressor, and the tape delay and reverb that AudioEngine::processDelay
+//  and AudioEngine::processReverb run.
+//
+//  cmake -S . -B build && cmake --build build
+//  build/component_bench [--filter text] [--seconds s] [--repeat N]
+//                        [--json file] [--list]
+//
+
+#include "DaisyDrumVoice.h"
+#include "DrumHitCache.h"
+#include "Freeverb.h"
+#include "Grain.h"
+#include "GranularVoice.h"
+#include "MoogLadders/LadderFilterBank.h"
+#include "MasterCompressor.h"
+#include "PlaitsVoice.h"
+#include "ReelBuffer.h"
+#include "RingsVoice.h"
+#include "TapeDelay.h"
+#include "WavSamplerVoice.h"
+#include "stmlib/utils/random.h"
+#include "test_signals.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Grainulator;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kBlockSize = 256;
+constexpr uint32_t kSeed = 0x21;
+constexpr double kWarmupSeconds = 0.1;
+constexpr size_t kNoiseFrames = 1 << 16;  // Power of two
+
+// ---- Fixture ----
+
+// Stereo input shared by every component that processes audio: white noise
+// at -6 dBFS, read at a different offset for each block
+struct Noise {
+    std::vector<float> left;
+    std::vector<float> right;
+
+    Noise() : left(kNoiseFrames), right(kNoiseFrames) {
+        tools::NoiseGenerator generator;
+        for (size_t i = 0; i < kNoiseFrames; ++i) {
+            left[i] = generator.next() * 0.5f;
+            right[i] = generator.next() * 0.5f;
+        }
+    }
+
+    void copy(int block, float* l, float* r) const {
+        const size_t offset = (static_cast<size_t>(block) * kBlockSize) & (kNoiseFrames - 1);
+        std::memcpy(l, left.data() + offset, kBlockSize * sizeof(float));
+        std::memcpy(r, right.data() + offset, kBlockSize * sizeof(float));
+    }
+};
+
+const Noise& noise() {
+    static const Noise instance;
+    return instance;
+}
+
+// One component under test. setup() runs untimed; run() renders block
+// `block` (counting from 0 after setup) into left/right and is timed.
+class Bench {
+public:
+    virtual ~Bench() = default;
+    virtual bool setup() { return true; }
+    virtual void run(int block) = 0;
+
+    float left[kBlockSize] = {};
+    float right[kBlockSize] = {};
+};
+
+struct Component {
+    std::string name;
+    std::function<std::unique_ptr<Bench>()> make;
+};
+
+// ---- Components ----
+
+const char* const kLadderNames[LadderFilterBank::kNumModels] = {
+    "stilson", "microtracker", "krajeski", "musicdsp", "oberheim_variation",
+    "improved", "rk_simulation", "hyperion", "daisy_ladder", "cytomic_svf",
+};
+
+// Filters the noise with the cutoff swept per block and resonance at 0.6
+class LadderBench : public Bench {
+public:
+    explicit LadderBench(int model) : bank_(static_cast<float>(kSampleRate), model) {}
+
+    bool setup() override {
+        bank_.SetResonance(0.6f);
+        return true;
+    }
+
+    void run(int block) override {
+        noise().copy(block, left, right);
+        const float cutoff = 200.0f + 4000.0f * (0.5f + 0.5f * std::sin(static_cast<float>(block) * 0.05f));
+        bank_.Process(left, right, kBlockSize, cutoff);
+    }
+
+private:
+    LadderFilterBank bank_;
+};
+
+// Three seconds of the noise, looped, for the reel readers
+void loadReel(ReelBuffer& reel) {
+    const size_t frames = static_cast<size_t>(kSampleRate) * 3;
+    std::vector<float> l(frames);
+    std::vector<float> r(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        l[i] = noise().left[i & (kNoiseFrames - 1)];
+        r[i] = noise().right[i & (kNoiseFrames - 1)];
+    }
+    reel.Load(l.data(), r.data(), frames);
+}
+
+const char* const kWindowNames[] = {
+    "hanning", "gaussian", "trapezoid", "triangle", "tukey", "pluck", "pluck_soft", "exp_decay",
+};
+
+// A playing granular voice at about eight overlapping grains (64 Hz density,
+// 120 ms grains). The voice filter is the Cytomic SVF, the cheapest model, so
+// the grains dominate; add the ladder/ figure for another model.
+class GrainBench : public Bench {
+public:
+    explicit GrainBench(WindowType window) : window_(window) {}
+
+    bool setup() override {
+        loadReel(reel_);
+        voice_.Init(static_cast<float>(kSampleRate));
+        voice_.SetBuffer(&reel_);
+        voice_.SetWindowType(window_);
+        voice_.SetFilterModel(GranularVoice::FilterModel::CytomicSVF);
+        voice_.SetDensity(64.0f);
+        voice_.SetSize(0.12f);
+        voice_.SetSpread(0.5f);
+        voice_.SetGate(true);
+        return true;
+    }
+
+    void run(int) override { voice_.Render(left, right, kBlockSize); }
+
+private:
+    WindowType window_;
+    ReelBuffer reel_;
+    GranularVoice voice_;
+};
+
+// One stereo Hermite read per sample at a non-integer rate
+class HermiteBench : public Bench {
+public:
+    bool setup() override {
+        loadReel(reel_);
+        return true;
+    }
+
+    void run(int) override {
+        const double length = static_cast<double>(reel_.GetLength());
+        for (int i = 0; i < kBlockSize; ++i) {
+            position_ += 1.37;
+            if (position_ >= length) position_ -= length;
+            const size_t index = static_cast<size_t>(position_);
+            reel_.ReadHermite(index, static_cast<float>(position_ - static_cast<double>(index)), left[i], right[i]);
+        }
+    }
+
+private:
+    ReelBuffer reel_;
+    double position_ = 0.0;
+};
+
+const char* const kPlaitsNames[] = {
+    "va_vcf", "phase_distortion", "six_op_a", "six_op_b", "six_op_c", "wave_terrain",
+    "string_machine", "chiptune", "virtual_analog", "waveshaper", "two_op_fm",
+    "granular_formant", "harmonic", "wavetable", "chords", "speech", "granular_cloud",
+    "filtered_noise", "particle_noise", "string", "modal", "bass_drum", "snare_drum", "hi_hat",
+};
+constexpr int kNumPlaitsEngines = static_cast<int>(sizeof(kPlaitsNames) / sizeof(kPlaitsNames[0]));
+
+// Retrigger period for the voices, so percussive engines and envelopes keep
+// sounding through the measurement (about 64 ms)
+constexpr int kRetriggerBlocks = 12;
+
+class PlaitsBench : public Bench {
+public:
+    explicit PlaitsBench(int engine)
+        : arena_(std::make_unique<PlaitsVoiceArena>())
+        , voice_(std::make_unique<PlaitsVoice>(arena_.get()))
+        , engine_(engine) {}
+
+    bool setup() override {
+        voice_->Init(static_cast<float>(kSampleRate));
+        voice_->SetEngine(engine_);
+        voice_->SetNote(48.0f);
+        voice_->SetHarmonics(0.5f);
+        voice_->SetTimbre(0.5f);
+        voice_->SetMorph(0.5f);
+        return true;
+    }
+
+    void run(int block) override {
+        if (block % kRetriggerBlocks == 0) {
+            voice_->SetNote(static_cast<float>(48 + (block / kRetriggerBlocks) % 12));
+            voice_->Trigger(true);
+        } else if (block % kRetriggerBlocks == 1) {
+            voice_->Trigger(false);
+        }
+        std::fill(left, left + kBlockSize, 0.0f);
+        std::fill(right, right + kBlockSize, 0.0f);
+        voice_->RenderAdd(left, right, kBlockSize, 1.0f);
+    }
+
+private:
+    std::unique_ptr<PlaitsVoiceArena> arena_;
+    std::unique_ptr<PlaitsVoice> voice_;
+    int engine_;
+};
+
+const char* const kRingsNames[] = {
+    "modal", "sympathetic_string", "string", "fm_voice", "sympathetic_string_quantized",
+    "string_and_reverb",
+};
+constexpr int kNumRingsModels = static_cast<int>(sizeof(kRingsNames) / sizeof(kRingsNames[0]));
+
+// Notes arrive every kRetriggerBlocks / 2 blocks, so every polyphony voice
+// is ringing
+class RingsBench : public Bench {
+public:
+    RingsBench(int model, int polyphony)
+        : voice_(std::make_unique<RingsVoice>())
+        , model_(model)
+        , polyphony_(polyphony) {}
+
+    bool setup() override {
+        voice_->Init(static_cast<float>(kSampleRate));
+        voice_->SetPolyphony(polyphony_);
+        voice_->SetModel(model_);
+        voice_->SetStructure(0.4f);
+        voice_->SetBrightness(0.6f);
+        voice_->SetDamping(0.6f);
+        return true;
+    }
+
+    void run(int block) override {
+        const int period = kRetriggerBlocks / 2;
+        if (block % period == 0) {
+            const int note = 40 + ((block / period) * 7) % 24;
+            voice_->NoteOn(note, 100);
+        } else if (block % period == 1) {
+            voice_->NoteOff(40 + (((block - 1) / period) * 7) % 24);
+        }
+        voice_->Render(nullptr, left, right, kBlockSize);
+    }
+
+private:
+    std::unique_ptr<RingsVoice> voice_;
+    int model_;
+    int polyphony_;
+};
+
+const char* const kDrumNames[DaisyDrumVoice::NumEngines] = {
+    "analog_kick", "synthetic_kick", "analog_snare", "synthetic_snare", "hihat",
+};
+
+class DrumBench : public Bench {
+public:
+    DrumBench(int engine, bool cached)
+        : voice_(std::make_unique<DaisyDrumVoice>()), engine_(engine), cached_(cached) {}
+
+    ~DrumBench() override {
+        voice_->SetHitCache(nullptr);
+        if (cache_) cache_->Stop();
+    }
+
+    bool setup() override {
+        voice_->Init(static_cast<float>(kSampleRate));
+        voice_->SetEngine(engine_);
+        voice_->SetNote(36.0f);
+        voice_->SetHarmonics(0.5f);
+        voice_->SetTimbre(0.5f);
+        voice_->SetMorph(0.6f);
+        if (!cached_) return true;
+
+        // Trigger until the hit has been rendered and adopted (admitted on its second miss)
+        cache_ = std::make_unique<DrumHitCache>();
+        cache_->Start(static_cast<float>(kSampleRate));
+        voice_->SetHitCache(cache_.get());
+        for (int attempt = 0; attempt < 1000 && cache_->GetNumHits() == 0; ++attempt) {
+            cache_->Update();
+            voice_->Trigger(true);
+            voice_->Render(left, right, kBlockSize);
+            voice_->Trigger(false);
+            voice_->Render(left, right, kBlockSize);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return cache_->GetNumHits() > 0;
+    }
+
+    void run(int block) override {
+        if (cache_) cache_->Update();
+        if (block % kRetriggerBlocks == 0) voice_->Trigger(true);
+        else if (block % kRetriggerBlocks == 1) voice_->Trigger(false);
+        voice_->Render(left, right, kBlockSize);
+    }
+
+private:
+    std::unique_ptr<DaisyDrumVoice> voice_;
+    std::unique_ptr<DrumHitCache> cache_;
+    int engine_;
+    bool cached_;
+};
+
+
+// The sampler's full polyphony sustaining on a looped region, each voice at
+// its own pitch
+constexpr int kSamplerVoices = 32;  // SetMaxPolyphony's upper limit
+
+class SamplerBench : public Bench {
+public:
+    SamplerBench() : voice_(std::make_unique<WavSamplerVoice>()) {}
+
+    bool setup() override {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "grainulator_component_bench";
+        std::filesystem::create_directories(dir);
+        if (!tools::writeSampleWav(dir / "c4.wav", kSampleRate, 261.63, 2.0, 0.5)) return false;
+
+        // sample= comes last; the parser reads it to the end of the line
+        const std::filesystem::path sfzPath = dir / "bench.sfz";
+        FILE* sfz = std::fopen(sfzPath.string().c_str(), "w");
+        if (!sfz) return false;
+        std::fputs("<region> lokey=0 hikey=127 pitch_keycenter=60 loop_mode=loop_continuous "
+                   "loop_start=4800 loop_end=72000 sample=c4.wav\n", sfz);
+        std::fclose(sfz);
+
+        voice_->Init(static_cast<float>(kSampleRate));
+        voice_->SetMaxPolyphony(kSamplerVoices);
+        voice_->SetSustain(1.0f);
+        if (!voice_->LoadFromSfzFile(sfzPath.string().c_str())) return false;
+        voice_->Render(left, right, kBlockSize);  // Picks up the loaded map
+
+        for (int v = 0; v < kSamplerVoices; ++v) {
+            voice_->NoteOn(36 + v, 0.8f);
+        }
+        voice_->Render(left, right, kBlockSize);
+        return voice_->GetActiveVoiceCount() == kSamplerVoices;
+    }
+
+    void run(int) override { voice_->Render(left, right, kBlockSize); }
+
+private:
+    std::unique_ptr<WavSamplerVoice> voice_;
+};
+
+class CompressorBench : public Bench {
+public:
+    bool setup() override {
+        compressor_.prepare(static_cast<float>(kSampleRate));
+        compressor_.setEnabled(true);
+        compressor_.setThreshold(0.6f);
+        compressor_.setRatio(0.4f);
+        compressor_.setMix(0.8f);
+        compressor_.setLimiterEnabled(true);
+        return true;
+    }
+
+    void run(int block) override {
+        noise().copy(block, left, right);
+        for (int i = 0; i < kBlockSize; ++i) {
+            compressor_.processSample(left[i], right[i]);
+        }
+    }
+
+private:
+    MasterCompressor compressor_;
+};
+
+// The tape delay as AudioEngine::processDelay runs it, mixed in with wow and
+// flutter
+class DelayBench : public Bench {
+public:
+    DelayBench() : delay_(std::make_unique<TapeDelay>(static_cast<double>(kSampleRate))) {}
+
+    bool setup() override {
+        params_.mix = 0.5f;
+        params_.feedback = 0.5f;
+        delay_->reset(params_);
+        return true;
+    }
+
+    void run(int block) override {
+        noise().copy(block, left, right);
+        delay_->process(left, right, kBlockSize, params_);
+    }
+
+private:
+    std::unique_ptr<TapeDelay> delay_;
+    TapeDelayParams params_;
+};
+
+// The reverb as AudioEngine::processReverb runs it
+class ReverbBench : public Bench {
+public:
+    ReverbBench() : reverb_(std::make_unique<Freeverb>(kBlockSize)) {}
+
+    void run(int block) override {
+        noise().copy(block, left, right);
+        reverb_->process(left, right, kBlockSize, 0.7f, 0.4f, 0.5f);
+    }
+
+private:
+    std::unique_ptr<Freeverb> reverb_;
+};
+
+template <typename T, typename... Args>
+std::function<std::unique_ptr<Bench>()> maker(Args... args) {
+    return [=]() { return std::unique_ptr<Bench>(new T(args...)); };
+}
+
+std::vector<Component> components() {
+    std::vector<Component> list;
+    for (int m = 0; m < LadderFilterBank::kNumModels; ++m) {
+        list.push_back({std::string("ladder/") + kLadderNames[m], maker<LadderBench>(m)});
+    }
+    for (int w = 0; w < static_cast<int>(sizeof(kWindowNames) / sizeof(kWindowNames[0])); ++w) {
+        list.push_back({std::string("grain/") + kWindowNames[w], maker<GrainBench>(static_cast<WindowType>(w))});
+    }
+    list.push_back({"reel/hermite", maker<HermiteBench>()});
+    for (int e = 0; e < kNumPlaitsEngines; ++e) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "plaits/%02d_%s", e, kPlaitsNames[e]);
+        list.push_back({name, maker<PlaitsBench>(e)});
+    }
+    for (int m = 0; m < kNumRingsModels; ++m) {
+        for (int poly : {1, 2, 4}) {
+            list.push_back({std::string("rings/") + kRingsNames[m] + "/poly" + std::to_string(poly),
+                            maker<RingsBench>(m, poly)});
+        }
+    }
+    for (int e = 0; e < DaisyDrumVoice::NumEngines; ++e) {
+        list.push_back({std::string("drums/") + kDrumNames[e], maker<DrumBench>(e, false)});
+        list.push_back({std::string("drums/") + kDrumNames[e] + "/cached", maker<DrumBench>(e, true)});
+    }
+    list.push_back({"sampler/32_voices", maker<SamplerBench>()});
+    list.push_back({"master/compressor", maker<CompressorBench>()});
+    list.push_back({"fx/tape_delay", maker<DelayBench>()});
+    list.push_back({"fx/reverb", maker<ReverbBench>()});
+    return list;
+}
+
+// ---- Runner ----
+
+struct Options {
+    std::string filter;
+    std::string jsonPath;
+    double seconds = 1.0;
+    int repeat = 3;
+    bool list = false;
+};
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--list") {
+            options.list = true;
+        } else if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--seconds" && hasValue) {
+            options.seconds = std::max(0.001, std::atof(argv[++i]));
+        } else if (arg == "--repeat" && hasValue) {
+            options.repeat = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter text] [--seconds s] [--repeat N] [--json file] [--list]\n",
+                         argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Result {
+    std::string name;
+    const char* status;
+    double nsPerSample;
+    double corePercent;  // Share of one core at kSampleRate
+};
+
+volatile float g_sink;  // Keeps the rendered output observable
+
+Result measure(const Component& component, const Options& options) {
+    Result result{component.name, "ok", 0.0, 0.0};
+
+    // Same random state for every component, as in render_regression
+    std::srand(kSeed);
+    stmlib::Random::Seed(kSeed);
+
+    std::unique_ptr<Bench> bench = component.make();
+    if (!bench->setup()) {
+        result.status = "ERROR";
+        return result;
+    }
+
+    const int warmupBlocks = static_cast<int>(std::ceil(kWarmupSeconds * kSampleRate / kBlockSize));
+    const int blocks = std::max(1, static_cast<int>(std::ceil(options.seconds * kSampleRate / kBlockSize)));
+    int block = 0;
+    float sink = 0.0f;
+    for (int b = 0; b < warmupBlocks; ++b, ++block) {
+        bench->run(block);
+        sink += bench->left[0] + bench->right[kBlockSize - 1];
+    }
+
+    double best = INFINITY;
+    for (int pass = 0; pass < options.repeat; ++pass) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocks; ++b, ++block) {
+            bench->run(block);
+            sink += bench->left[0] + bench->right[kBlockSize - 1];
+        }
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    g_sink = sink;
+
+    result.nsPerSample = best * 1.0e9 / (static_cast<double>(blocks) * kBlockSize);
+    result.corePercent = result.nsPerSample * kSampleRate * 1.0e-7;
+    return result;
+}
+
+void writeJson(const std::string& path, const Options& options, const std::vector<Result>& results) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "cannot write %s\n", path.c_str());
+        return;
+    }
+    std::fprintf(f, "{\n  \"sampleRate\": %d,\n  \"blockSize\": %d,\n  \"seconds\": %.3f,\n  \"repeat\": %d,\n"
+                    "  \"components\": [\n", kSampleRate, kBlockSize, options.seconds, options.repeat);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::fprintf(f, "    {\"name\": \"%s\", \"status\": \"%s\", \"nsPerSample\": %.2f, \"corePercent\": %.3f}%s\n",
+                     r.name.c_str(), r.status, r.nsPerSample, r.corePercent, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) return 2;
+
+    std::vector<Component> selected;
+    for (Component& c : components()) {
+        if (options.filter.empty() || c.name.find(options.filter) != std::string::npos) {
+            selected.push_back(std::move(c));
+        }
+    }
+    if (options.list) {
+        for (const Component& c : selected) std::printf("%s\n", c.name.c_str());
+        return 0;
+    }
+    if (selected.empty()) {
+        std::fprintf(stderr, "no component matches %s\n", options.filter.c_str());
+        return 2;
+    }
+
+    std::printf("%-44s %8s %10s %8s\n", "component", "status", "ns/sample", "% core");
+    std::vector<Result> results;
+    int errors = 0;
+    for (const Component& c : selected) {
+        const Result r = measure(c, options);
+        errors += std::strcmp(r.status, "ok") == 0 ? 0 : 1;
+        std::printf("%-44s %8s %10.1f %8.3f\n", r.name.c_str(), r.status, r.nsPerSample, r.corePercent);
+        std::fflush(stdout);
+        results.push_back(r);
+    }
+
+    if (!options.jsonPath.empty()) writeJson(options.jsonPath, options, results);
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+//
+//  fastmath_check.cpp
+//  Grainulator
+//
+//  Accuracy and throughput check for Source/Audio/Core/FastMath.h. Sweeps
+//  each approximation (scalar and 4-lane) against double-precision libm,
+//  fails if an error exceeds the bound documented in FastMath.h, and
+//  reports ns/value against the float libm call it replaces.
+//
+//  c++ -std=c++17 -O2 -ISource/Audio/Core Tools/fastmath_check.cpp -o fastmath_check
+//  ./fastmath_check [--no-bench]
+//
+
+#include "FastMath.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace Grainulator;
+namespace approx = fastmath::approx;
+
+namespace {
+
+struct Case {
+    const char* name;
+    float lo;
+    float hi;
+    bool relative;
+    double bound;
+    double (*reference)(double);
+    float (*scalar)(float);
+    simd::f4 (*vector)(simd::f4);
+};
+
+double refTanh(double x) { return std::tanh(x); }
+double refExp2(double x) { return std::exp2(x); }
+double refExp(double x) { return std::exp(x); }
+double refLog2(double x) { return std::log2(x); }
+double refSin(double x) { return std::sin(x); }
+double refCos(double x) { return std::cos(x); }
+
+float scalarTanh(float x) { return approx::tanh(x); }
+float scalarExp2(float x) { return approx::exp2(x); }
+float scalarExp(float x) { return approx::exp(x); }
+float scalarLog2(float x) { return approx::log2(x); }
+float scalarSin(float x) { return approx::sin(x); }
+float scalarCos(float x) { return approx::cos(x); }
+
+simd::f4 vectorTanh(simd::f4 x) { return approx::tanh(x); }
+simd::f4 vectorExp2(simd::f4 x) { return approx::exp2(x); }
+simd::f4 vectorExp(simd::f4 x) { return approx::exp(x); }
+simd::f4 vectorSin(simd::f4 x) { return approx::sin(x); }
+simd::f4 vectorCos(simd::f4 x) { return approx::cos(x); }
+
+const Case kCases[] = {
+    {"tanh", -20.0f, 20.0f, false, 1.0e-4, refTanh, scalarTanh, vectorTanh},
+    {"exp2", -126.0f, 126.0f, true, 3.0e-7, refExp2, scalarExp2, vectorExp2},
+    {"exp", -87.0f, 87.0f, true, 3.0e-7, refExp, scalarExp, vectorExp},
+    {"log2", 0.0625f, 16.0f, false, 3.0e-7, refLog2, scalarLog2, nullptr},
+    {"sin", -1000.0f, 1000.0f, false, 5.0e-7, refSin, scalarSin, vectorSin},
+    {"cos", -1000.0f, 1000.0f, false, 5.0e-7, refCos, scalarCos, vectorCos},
+};
+
+constexpr int kSweepPoints = 1 << 21;
+
+std::vector<float> sweep(const Case& c) {
+    std::vector<float> xs(kSweepPoints);
+    const bool logarithmic = c.lo > 0.0f;
+    for (int i = 0; i < kSweepPoints; ++i) {
+        const double t = static_cast<double>(i) / (kSweepPoints - 1);
+        xs[i] = logarithmic
+            ? static_cast<float>(c.lo * std::pow(static_cast<double>(c.hi) / c.lo, t))
+            : static_cast<float>(c.lo + (c.hi - c.lo) * t);
+    }
+    return xs;
+}
+
+double error(const Case& c, float x, float y) {
+    const double ref = c.reference(x);
+    const double diff = std::fabs(static_cast<double>(y) - ref);
+    return c.relative ? diff / std::fabs(ref) : diff;
+}
+
+template <typename Fn>
+double nsPerValue(const std::vector<float>& xs, Fn fn) {
+    std::vector<float> out(xs.size());
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < 8; ++rep) fn(xs.data(), out.data(), xs.size());
+    const auto end = std::chrono::steady_clock::now();
+    volatile float sink = out[out.size() / 2];
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / (8.0 * xs.size());
+}
+
+template <typename Libm, typename Scalar, typename Vector>
+void benchmark(const Case& c, Libm libm, Scalar scalar, Vector vector) {
+    const std::vector<float> xs = sweep(c);
+    const double libmNs = nsPerValue(xs, [&](const float* in, float* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) out[i] = libm(in[i]);
+    });
+    const double scalarNs = nsPerValue(xs, [&](const float* in, float* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) out[i] = scalar(in[i]);
+    });
+    double vectorNs = 0.0;
+    if constexpr (!std::is_same_v<Vector, std::nullptr_t>) {
+        vectorNs = nsPerValue(xs, [&](const float* in, float* out, size_t n) {
+            for (size_t i = 0; i + simd::kWidth <= n; i += simd::kWidth) {
+                simd::store(out + i, vector(simd::load(in + i)));
+            }
+        });
+    }
+    std::printf("%-5s %10.2f %10.2f %10.2f\n", c.name, libmNs, scalarNs, vectorNs);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool bench = !(argc > 1 && std::strcmp(argv[1], "--no-bench") == 0);
+    int failures = 0;
+
+    std::printf("%-5s %-9s %12s %12s %9s\n", "fn", "kind", "max error", "bound", "");
+    for (const Case& c : kCases) {
+        const std::vector<float> xs = sweep(c);
+
+        double scalarError = 0.0;
+        for (float x : xs) scalarError = std::max(scalarError, error(c, x, c.scalar(x)));
+
+        double vectorError = 0.0;
+        if (c.vector) {
+            for (size_t i = 0; i + simd::kWidth <= xs.size(); i += simd::kWidth) {
+                float y[simd::kWidth];
+                simd::store(y, c.vector(simd::load(&xs[i])));
+                for (int lane = 0; lane < simd::kWidth; ++lane) {
+                    vectorError = std::max(vectorError, error(c, xs[i + lane], y[lane]));
+                }
+            }
+        }
+
+        const char* kind = c.relative ? "relative" : "absolute";
+        const bool scalarOk = scalarError < c.bound;
+        const bool vectorOk = vectorError < c.bound;
+        std::printf("%-5s %-9s %12.3g %12.3g %9s\n", c.name, kind, scalarError, c.bound, scalarOk ? "ok" : "FAIL");
+        if (c.vector) {
+            std::printf("%-5s %-9s %12.3g %12.3g %9s\n", "", "x4", vectorError, c.bound, vectorOk ? "ok" : "FAIL");
+        }
+        failures += (scalarOk ? 0 : 1) + (vectorOk ? 0 : 1);
+    }
+
+    // pow(x, y) over the pitch/cutoff ranges it is used for
+    double powError = 0.0;
+    for (float x = 0.01f; x < 100.0f; x *= 1.01f) {
+        for (float y = -4.0f; y <= 4.0f; y += 0.0625f) {
+            const double ref = std::pow(static_cast<double>(x), static_cast<double>(y));
+            powError = std::max(powError, std::fabs(approx::pow(x, y) - ref) / ref);
+        }
+    }
+    const bool powOk = powError < 2.0e-6;
+    std::printf("%-5s %-9s %12.3g %12.3g %9s\n", "pow", "relative", powError, 2.0e-6, powOk ? "ok" : "FAIL");
+    failures += powOk ? 0 : 1;
+
+    // Shape checks for the saturator
+    for (float x = 0.0f; x < 20.0f; x += 0.001f) {
+        if (approx::tanh(-x) != -approx::tanh(x) || approx::tanh(x) > 1.0f ||
+            approx::tanh(x + 0.001f) < approx::tanh(x)) {
+            std::printf("tanh is not odd/monotonic/bounded at %g  FAIL\n", x);
+            ++failures;
+            break;
+        }
+    }
+
+    // A NaN from an unstable filter must come out finite, not reach the int conversion
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    if (!std::isfinite(approx::exp2(nan)) || !std::isfinite(approx::exp(nan)) ||
+        !std::isfinite(approx::pow(2.0f, nan))) {
+        std::printf("exp2/exp/pow of NaN is not finite  FAIL\n");
+        ++failures;
+    }
+
+    if (bench) {
+        // Lambdas rather than the table's function pointers so every variant inlines
+        std::printf("\n%-5s %10s %10s %10s  (ns/value)\n", "fn", "libm", "scalar", "x4");
+        benchmark(kCases[0], [](float x) { return std::tanh(x); }, [](float x) { return approx::tanh(x); },
+                  [](simd::f4 x) { return approx::tanh(x); });
+        benchmark(kCases[1], [](float x) { return std::exp2(x); }, [](float x) { return approx::exp2(x); },
+                  [](simd::f4 x) { return approx::exp2(x); });
+        benchmark(kCases[2], [](float x) { return std::exp(x); }, [](float x) { return approx::exp(x); },
+                  [](simd::f4 x) { return approx::exp(x); });
+        benchmark(kCases[3], [](float x) { return std::log2(x); }, [](float x) { return approx::log2(x); },
+                  nullptr);
+        benchmark(kCases[4], [](float x) { return std::sin(x); }, [](float x) { return approx::sin(x); },
+                  [](simd::f4 x) { return approx::sin(x); });
+        benchmark(kCases[5], [](float x) { return std::cos(x); }, [](float x) { return approx::cos(x); },
+                  [](simd::f4 x) { return approx::cos(x); });
+    }
+
+    std::printf("\n%s\n", failures == 0 ? "all bounds met" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
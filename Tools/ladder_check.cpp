@@ -0,0 +1,146 @@
+//
+//  ladder_check.cpp
+//  Grainulator
+//
+//  Accuracy check for the 2-lane SIMD ladders in
+//  Source/Audio/Synthesis/Granular/MoogLadders/StereoLadders.h. Runs each
+//  SIMD model and two scalar instances of the model it mirrors on the same
+//  noise, over a grid of cutoff and resonance settings, and fails if the
+//  difference rises above kBoundDb relative to the scalar output. At each
+//  model's resonance limit the loop is close to self-oscillation and the
+//  float state drifts from the double-precision scalar state, so there the
+//  check only asserts that the two stay together (kResonantBoundDb).
+//
+//  c++ -std=c++17 -O2 -ISource/Audio/Core -ISource/Audio/Synthesis/Granular/MoogLadders \
+//      Tools/ladder_check.cpp -o ladder_check
+//  ./ladder_check
+//
+
+#include "StereoLadders.h"
+#include "KrajeskiModel.h"
+#include "MicrotrackerModel.h"
+#include "MusicDSPModel.h"
+#include "ImprovedModel.h"
+#include "CytomicSvfModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr uint32_t kBlock = 256;
+constexpr int kBlocks = 96;
+constexpr double kBoundDb = -115.0;          // Error energy relative to the scalar output
+constexpr double kResonantBoundDb = -60.0;   // Same, at the resonance limit
+
+// Highest cutoff (fraction of Nyquist) and resonance LadderFilterBank lets each model run at
+struct Model {
+    const char* name;
+    float cutoffLimit;
+    float resonanceLimit;
+};
+
+std::vector<float> noise(uint32_t seed, size_t n) {
+    std::vector<float> out(n);
+    for (float& x : out) {
+        seed = seed * 1664525u + 1013904223u;
+        x = 0.5f * (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f);
+    }
+    return out;
+}
+
+// Returns 20 log10(rms(simd - scalar) / rms(scalar)) over both channels.
+// cutoff < 0 sweeps the cutoff per block from 40 Hz up to the model's limit.
+template <typename Stereo, typename Scalar>
+double errorDb(const Model& model, float cutoff, float resonance) {
+    const size_t total = static_cast<size_t>(kBlock) * kBlocks;
+    std::vector<float> left = noise(1, total), right = noise(2, total);
+    std::vector<float> refLeft = left, refRight = right;
+
+    Stereo stereo(kSampleRate);
+    Scalar scalarLeft(kSampleRate), scalarRight(kSampleRate);
+    const float maxCutoff = 0.5f * kSampleRate * model.cutoffLimit;
+
+    for (int b = 0; b < kBlocks; ++b) {
+        const float c = cutoff >= 0.0f
+            ? std::min(cutoff, maxCutoff)
+            : 40.0f * std::pow(maxCutoff / 40.0f, static_cast<float>(b) / (kBlocks - 1));
+        // Cutoff first: Krajeski's resonance gain depends on the cutoff
+        stereo.SetCutoff(c);
+        stereo.SetResonance(resonance);
+        scalarLeft.SetCutoff(c);
+        scalarLeft.SetResonance(resonance);
+        scalarRight.SetCutoff(c);
+        scalarRight.SetResonance(resonance);
+
+        const size_t offset = static_cast<size_t>(b) * kBlock;
+        stereo.Process(&left[offset], &right[offset], kBlock);
+        scalarLeft.Process(&refLeft[offset], kBlock);
+        scalarRight.Process(&refRight[offset], kBlock);
+    }
+
+    double errorEnergy = 0.0;
+    double signalEnergy = 0.0;
+    for (size_t i = 0; i < total; ++i) {
+        const double dl = static_cast<double>(left[i]) - refLeft[i];
+        const double dr = static_cast<double>(right[i]) - refRight[i];
+        errorEnergy += dl * dl + dr * dr;
+        signalEnergy += static_cast<double>(refLeft[i]) * refLeft[i] + static_cast<double>(refRight[i]) * refRight[i];
+        if (!std::isfinite(left[i]) || !std::isfinite(right[i])) return 0.0;
+    }
+    if (errorEnergy == 0.0) return -300.0;
+    return 10.0 * std::log10(errorEnergy / std::max(signalEnergy, 1.0e-30));
+}
+
+// Prints and checks the worst error over the cutoff grid at each resonance
+template <typename Stereo, typename Scalar>
+int check(const Model& model) {
+    const float cutoffs[] = {80.0f, 500.0f, 2000.0f, 8000.0f, 24000.0f, -1.0f};
+    const float resonances[] = {0.0f, 0.5f, model.resonanceLimit};
+
+    int failures = 0;
+    for (float resonance : resonances) {
+        double worst = -300.0;
+        float worstCutoff = 0.0f;
+        for (float cutoff : cutoffs) {
+            const double db = errorDb<Stereo, Scalar>(model, cutoff, resonance);
+            if (db > worst) {
+                worst = db;
+                worstCutoff = cutoff;
+            }
+        }
+
+        const double bound = resonance == model.resonanceLimit ? kResonantBoundDb : kBoundDb;
+        const bool ok = worst < bound;
+        char cutoffLabel[16];
+        if (worstCutoff < 0.0f) std::snprintf(cutoffLabel, sizeof(cutoffLabel), "sweep");
+        else std::snprintf(cutoffLabel, sizeof(cutoffLabel), "%.0f", worstCutoff);
+        std::printf("%-13s %6.2f %10.1f %8s %8.1f %6s\n", model.name, resonance, worst, cutoffLabel,
+                    bound, ok ? "ok" : "FAIL");
+        failures += ok ? 0 : 1;
+    }
+    return failures;
+}
+
+} // namespace
+
+int main() {
+    int failures = 0;
+
+    std::printf("%-13s %6s %10s %8s %8s\n", "model", "res", "error dB", "cutoff", "bound");
+    failures += check<StereoMicrotracker, MicrotrackerMoog>({"Microtracker", 0.45f, 0.92f});
+    failures += check<StereoKrajeski, KrajeskiMoog>({"Krajeski", 0.45f, 0.93f});
+    failures += check<StereoMusicDSP, MusicDSPMoog>({"MusicDSP", 0.42f, 0.88f});
+    failures += check<StereoImproved, ImprovedMoog>({"Improved", 0.40f, 0.82f});
+    failures += check<StereoCytomicSvf, CytomicSvfMoog>({"CytomicSVF", 0.49f, 1.0f});
+
+    if (failures > 0) {
+        std::printf("%d setting(s) over the bound\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,262 @@
+//
+//  region_table_check.cpp
+//  Grainulator
+//
+//  Checks the sampler's precomputed region table (WavSamplerVoice::
+//  BuildRegionTable) against the linear scan it replaced. Builds randomized
+//  SFZ and mx.samples maps the way the loaders do, then plays the same
+//  sequence of notes and velocities through WavSamplerVoice::FindSample and
+//  through the reference scan, and fails on the first note-on where they
+//  pick different samples. Sample data is not needed, so the maps hold none.
+//
+//  The mx.samples maps leave velocity layers out and include notes with
+//  only release samples, so the closest-layer and release-only fallbacks are
+//  covered; repeated notes cover the round-robin order.
+//
+//  cmake -S . -B build && cmake --build build && ctest --test-dir build
+//  build/region_table_check [--maps N] [--seed N]
+//
+
+#include "WavSamplerVoice.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace Grainulator {
+
+// Friend of WavSamplerVoice: reaches the map, FindSample and BuildRegionTable
+struct RegionTableCheck {
+    // The note-on lookup before the region table: a linear scan per call,
+    // with its own round-robin cursors
+    static const WavSample* ReferenceFind(const SampleMap* map, int (&roundRobin)[128], int note, float velocity) {
+        if (!map || note < 0 || note > 127) return nullptr;
+
+        std::vector<const WavSample*> candidates;
+        if (map->useSfzVelocity) {
+            const int vel127 = std::clamp(static_cast<int>(velocity * 127.0f), 0, 127);
+            for (int i = 0; i < map->sampleCount; ++i) {
+                const WavSample& s = map->samples[i];
+                if (note >= s.lokey && note <= s.hikey && vel127 >= s.lovel && vel127 <= s.hivel && !s.isRelease) {
+                    candidates.push_back(&s);
+                }
+            }
+            if (candidates.empty()) return nullptr;
+            const int rr = roundRobin[note] % static_cast<int>(candidates.size());
+            roundRobin[note] = rr + 1;
+            return candidates[rr];
+        }
+
+        int closestNote = -1;
+        for (int offset = 0; offset < 128; ++offset) {
+            const int lo = note - offset;
+            const int hi = note + offset;
+            if (lo >= 0 && map->noteTable[lo].sampleCount > 0) {
+                closestNote = lo;
+                break;
+            }
+            if (hi <= 127 && map->noteTable[hi].sampleCount > 0) {
+                closestNote = hi;
+                break;
+            }
+        }
+        if (closestNote < 0) return nullptr;
+
+        const auto& entry = map->noteTable[closestNote];
+        const WavSample* base = &map->samples[entry.firstSampleIndex];
+        for (int i = 0; i < entry.sampleCount; ++i) {
+            if (!base[i].isRelease) candidates.push_back(&base[i]);
+        }
+        if (candidates.empty()) {
+            for (int i = 0; i < entry.sampleCount; ++i) candidates.push_back(&base[i]);
+        }
+        if (candidates.empty()) return nullptr;
+
+        const int totalDynamics = candidates[0]->totalDynamics;
+        const int targetLayer = std::clamp(static_cast<int>(velocity * totalDynamics), 1, totalDynamics);
+
+        std::vector<const WavSample*> layerCandidates;
+        for (const WavSample* s : candidates) {
+            if (s->dynamicLayer == targetLayer) layerCandidates.push_back(s);
+        }
+        if (layerCandidates.empty()) {
+            int bestLayerDist = 999;
+            int bestLayer = 1;
+            for (const WavSample* s : candidates) {
+                const int dist = std::abs(s->dynamicLayer - targetLayer);
+                if (dist < bestLayerDist) {
+                    bestLayerDist = dist;
+                    bestLayer = s->dynamicLayer;
+                }
+            }
+            for (const WavSample* s : candidates) {
+                if (s->dynamicLayer == bestLayer) layerCandidates.push_back(s);
+            }
+        }
+        if (layerCandidates.empty()) return candidates[0];
+
+        const int rr = roundRobin[note] % static_cast<int>(layerCandidates.size());
+        roundRobin[note] = rr + 1;
+        return layerCandidates[rr];
+    }
+
+    static WavSample Region(int rootNote) {
+        WavSample s{};
+        s.rootNote = rootNote;
+        s.lokey = rootNote;
+        s.hikey = rootNote;
+        s.lovel = 0;
+        s.hivel = 127;
+        s.dynamicLayer = 1;
+        s.totalDynamics = 1;
+        return s;
+    }
+
+    // Sorted and indexed as LoadFromDirectory does. Some notes get every
+    // layer, some a random subset, and some only release samples.
+    static SampleMap* RandomMxMap(std::mt19937& rng) {
+        std::vector<WavSample> samples;
+        const int notes = 1 + static_cast<int>(rng() % 12);
+        for (int n = 0; n < notes; ++n) {
+            const int root = static_cast<int>(rng() % 128);
+            const int totalDynamics = 1 + static_cast<int>(rng() % 6);
+            const bool releaseOnly = rng() % 6 == 0;
+            const bool sparseLayers = rng() % 2 == 0;
+            for (int layer = 1; layer <= totalDynamics; ++layer) {
+                if (sparseLayers && layer > 1 && rng() % 2 == 0) continue;
+                const int variations = 1 + static_cast<int>(rng() % 4);
+                for (int v = 0; v < variations; ++v) {
+                    WavSample s = Region(root);
+                    s.dynamicLayer = layer;
+                    s.totalDynamics = totalDynamics;
+                    s.variation = v;
+                    s.isRelease = releaseOnly || rng() % 5 == 0;
+                    samples.push_back(s);
+                }
+            }
+        }
+
+        std::sort(samples.begin(), samples.end(), [](const WavSample& a, const WavSample& b) {
+            if (a.rootNote != b.rootNote) return a.rootNote < b.rootNote;
+            if (a.dynamicLayer != b.dynamicLayer) return a.dynamicLayer < b.dynamicLayer;
+            return a.variation < b.variation;
+        });
+
+        SampleMap* map = NewMap(samples, false);
+        for (int i = 0; i < map->sampleCount; ++i) {
+            auto& entry = map->noteTable[map->samples[i].rootNote];
+            if (entry.firstSampleIndex < 0) entry.firstSampleIndex = i;
+            entry.sampleCount++;
+        }
+        return map;
+    }
+
+    // Overlapping key and velocity ranges, sorted as LoadFromSfzFile does
+    static SampleMap* RandomSfzMap(std::mt19937& rng) {
+        std::vector<WavSample> samples;
+        const int regions = 1 + static_cast<int>(rng() % 40);
+        for (int r = 0; r < regions; ++r) {
+            int lokey = static_cast<int>(rng() % 128);
+            int hikey = std::min(127, lokey + static_cast<int>(rng() % 24));
+            int lovel = static_cast<int>(rng() % 128);
+            int hivel = static_cast<int>(rng() % 128);
+            if (lovel > hivel) std::swap(lovel, hivel);
+            if (rng() % 3 == 0) {
+                lovel = 0;
+                hivel = 127;
+            }
+            WavSample s = Region(lokey);
+            s.lokey = lokey;
+            s.hikey = hikey;
+            s.lovel = lovel;
+            s.hivel = hivel;
+            s.variation = static_cast<int>(rng() % 3);
+            s.isRelease = rng() % 8 == 0;
+            samples.push_back(s);
+        }
+
+        std::sort(samples.begin(), samples.end(), [](const WavSample& a, const WavSample& b) {
+            if (a.lokey != b.lokey) return a.lokey < b.lokey;
+            if (a.lovel != b.lovel) return a.lovel < b.lovel;
+            return a.variation < b.variation;
+        });
+        return NewMap(samples, true);
+    }
+
+    static SampleMap* NewMap(const std::vector<WavSample>& samples, bool sfz) {
+        SampleMap* map = new SampleMap{};
+        map->sampleCount = static_cast<int>(samples.size());
+        map->samples = new WavSample[std::max(map->sampleCount, 1)];
+        std::copy(samples.begin(), samples.end(), map->samples);
+        map->useSfzVelocity = sfz;
+        for (int n = 0; n < 128; ++n) {
+            map->noteTable[n].firstSampleIndex = -1;
+            map->noteTable[n].sampleCount = 0;
+        }
+        return map;
+    }
+
+    // Plays the same note-ons through both lookups; returns false on the first mismatch
+    static bool Compare(WavSamplerVoice& voice, SampleMap* map, std::mt19937& rng, int mapIndex) {
+        WavSamplerVoice::BuildRegionTable(map);
+        voice.m_mapActive = map;
+        std::fill(std::begin(voice.m_roundRobin), std::end(voice.m_roundRobin), 0);
+        int roundRobin[128] = {};
+
+        const float edges[] = {0.0f, 1.0f / 127.0f, 0.5f, 126.5f / 127.0f, 1.0f};
+        bool ok = true;
+        for (int call = 0; call < 4000 && ok; ++call) {
+            const int note = static_cast<int>(rng() % 128);
+            const float velocity = rng() % 4 == 0
+                ? edges[rng() % 5]
+                : static_cast<float>(rng() % 100001) / 100000.0f;
+            // A few repeats in a row walk the round-robin cursor
+            const int repeats = 1 + static_cast<int>(rng() % 3);
+            for (int r = 0; r < repeats && ok; ++r) {
+                const WavSample* expected = ReferenceFind(map, roundRobin, note, velocity);
+                const WavSample* actual = voice.FindSample(note, velocity);
+                if (expected != actual) {
+                    std::printf("map %d (%s, %d samples): note %d velocity %.5f picks sample %ld, reference %ld  FAIL\n",
+                                mapIndex, map->useSfzVelocity ? "sfz" : "mx.samples", map->sampleCount, note,
+                                velocity, actual ? static_cast<long>(actual - map->samples) : -1L,
+                                expected ? static_cast<long>(expected - map->samples) : -1L);
+                    ok = false;
+                }
+            }
+        }
+
+        voice.m_mapActive = nullptr;
+        WavSamplerVoice::FreeSampleMap(map);
+        return ok;
+    }
+};
+
+} // namespace Grainulator
+
+using namespace Grainulator;
+
+int main(int argc, char** argv) {
+    int maps = 200;
+    uint32_t seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--maps") == 0) maps = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--seed") == 0) seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+    }
+
+    std::mt19937 rng(seed);
+    WavSamplerVoice voice;
+    voice.Init(48000.0f);
+
+    int failures = 0;
+    for (int m = 0; m < maps; ++m) {
+        SampleMap* map = m % 2 == 0 ? RegionTableCheck::RandomMxMap(rng) : RegionTableCheck::RandomSfzMap(rng);
+        failures += RegionTableCheck::Compare(voice, map, rng, m) ? 0 : 1;
+    }
+
+    std::printf("%d random maps (seed %u), %d mismatched\n", maps, seed, failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,579 @@
+//
+//  render_regression.cpp
+//  Grainulator
+//
+//  Golden-audio regression and render timing for GrainulatorCore. Each scene
+//  builds a fresh AudioEngine with fixed seeds, schedules its notes and
+//  parameter changes on the engine's sample clock, and renders a fixed number
+//  of frames through AudioEngine::process(), or renderOffline() for bounce
+//  scenes. The output is compared with the scene's golden render
+//  (Tools/goldens/<scene>.wav, 16-bit stereo) and the render time is
+//  reported per output sample.
+//
+//  A scene passes when its SNR against the golden is at least the scene's
+//  tolerance. With --repeat N each scene is rendered N times; every repeat
+//  must be bit-identical to the first, and the fastest time is reported.
+//  Goldens were recorded on x86-64 Linux. Noise sources are seeded per
+//  instance, so the goldens do not depend on the C library's rand().
+//
+//  cmake -S . -B build && cmake --build build && ctest --test-dir build
+//  build/render_regression [--goldens dir] [--scene name] [--repeat N]
+//                          [--workers N] [--update] [--out dir] [--json file]
+//
+
+#include "AudioEngine.h"
+#include "dr_wav.h"
+#include "stmlib/utils/random.h"
+#include "test_signals.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Grainulator;
+using P = AudioEngine::ParameterID;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kBlockSize = 256;
+constexpr uint32_t kSeed = 0x21;  // stmlib's own initial Random state
+constexpr double kDefaultToleranceDb = 60.0;
+
+uint64_t at(double seconds) {
+    return static_cast<uint64_t>(seconds * kSampleRate + 0.5);
+}
+
+struct SceneContext {
+    std::filesystem::path scratchDir;  // For scenes that load files
+};
+
+struct Scene {
+    const char* name;
+    double seconds;
+    double toleranceDb;
+    bool (*setup)(AudioEngine& engine, const SceneContext& context);
+    bool offline = false;  // Bounce through renderOffline() with the drum hit cache left on
+};
+
+// ---- Test material ----
+
+// Deterministic stereo test signal for the reels: two detuned partial stacks
+// with a little noise, so grain position and filter changes are audible.
+void makeReelAudio(std::vector<float>& left, std::vector<float>& right, size_t frames) {
+    left.resize(frames);
+    right.resize(frames);
+    tools::NoiseGenerator noise;
+    const double twoPi = 6.283185307179586;
+    for (size_t i = 0; i < frames; ++i) {
+        const float n = noise.next();
+        const double t = static_cast<double>(i) / kSampleRate;
+        const double sweep = 1.0 + 0.5 * std::sin(twoPi * 0.25 * t);
+        left[i] = static_cast<float>(0.4 * std::sin(twoPi * 220.0 * t) + 0.2 * std::sin(twoPi * 660.0 * sweep * t)) + 0.05f * n;
+        right[i] = static_cast<float>(0.4 * std::sin(twoPi * 221.5 * t) + 0.2 * std::sin(twoPi * 990.0 * t)) + 0.05f * n;
+    }
+}
+
+// Harmonic decay of the sampler scenes' WAVs (tools::writeSampleWav)
+constexpr double kSfzSampleDecay = 1.5;
+
+// ---- Scenes ----
+
+// Four-voice Plaits chords across several engines with timbre/harmonics motion
+bool scenePlaitsChords(AudioEngine& engine, const SceneContext&) {
+    engine.setPlaitsVoiceCount(4);
+    engine.setParameter(P::PlaitsLPGDecay, 0, 0.6f);
+    const int chords[4][4] = {{48, 55, 60, 64}, {50, 57, 62, 65}, {43, 50, 55, 59}, {45, 52, 57, 60}};
+    const float engines[4] = {0.0f, 8.0f / 23.0f, 13.0f / 23.0f, 17.0f / 23.0f};
+    for (int c = 0; c < 4; ++c) {
+        const double start = 0.05 + c * 0.5;
+        engine.scheduleParameter(P::PlaitsModel, 0, engines[c], at(start) - 1);
+        for (int n = 0; n < 4; ++n) {
+            engine.scheduleNoteOnTarget(chords[c][n], 90 + n * 8, at(start + n * 0.01), AudioEngine::TargetPlaits);
+            engine.scheduleNoteOffTarget(chords[c][n], at(start + 0.4), AudioEngine::TargetPlaits);
+        }
+    }
+    // A fifth note steals a voice from the last chord
+    engine.scheduleNoteOnTarget(72, 100, at(1.75), AudioEngine::TargetPlaits);
+    engine.scheduleNoteOffTarget(72, at(1.85), AudioEngine::TargetPlaits);
+    for (int k = 0; k < 40; ++k) {
+        const float x = static_cast<float>(k) / 39.0f;
+        engine.scheduleParameter(P::PlaitsHarmonics, 0, 0.2f + 0.6f * x, at(k * 0.05));
+        engine.scheduleParameter(P::PlaitsTimbre, 0, 0.8f - 0.5f * x, at(k * 0.05));
+        engine.scheduleParameter(P::PlaitsMorph, 0, 0.5f + 0.4f * std::sin(x * 6.0f), at(k * 0.05));
+    }
+    return true;
+}
+
+// Rings with its internal exciter: polyphony 4, model changes and damping sweep
+bool sceneRings(AudioEngine& engine, const SceneContext&) {
+    engine.setParameter(P::RingsPolyphony, 0, 1.0f);
+    engine.setParameter(P::RingsBrightness, 0, 0.6f);
+    for (int k = 0; k < 12; ++k) {
+        const double t = 0.02 + k * 0.16;
+        engine.scheduleParameter(P::RingsModel, 0, static_cast<float>(k % 6) / 11.0f, at(t) - 1);
+        engine.scheduleNoteOnTarget(40 + (k * 5) % 24, 100, at(t), AudioEngine::TargetRings);
+        engine.scheduleNoteOffTarget(40 + (k * 5) % 24, at(t + 0.12), AudioEngine::TargetRings);
+        engine.scheduleParameter(P::RingsStructure, 0, static_cast<float>(k) / 11.0f, at(t + 0.05));
+        engine.scheduleParameter(P::RingsDamping, 0, 0.3f + 0.05f * k, at(t + 0.05));
+    }
+    return true;
+}
+
+// Two granular tracks and a looper over a synthetic reel, with filter model,
+// cutoff, envelope and pitch changes
+bool sceneGranular(AudioEngine& engine, const SceneContext&) {
+    std::vector<float> left;
+    std::vector<float> right;
+    makeReelAudio(left, right, kSampleRate * 3);
+    for (int reel = 0; reel < 4; ++reel) {
+        if (!engine.loadAudioData(reel, left.data(), right.data(), left.size(), static_cast<float>(kSampleRate))) {
+            return false;
+        }
+    }
+    for (int track : {0, 1, 3}) {
+        engine.setGranularPlaying(track, true);
+    }
+    engine.setParameter(P::GranularDensity, 0, 0.6f);
+    engine.setParameter(P::GranularDensity, 3, 0.8f);
+    engine.setParameter(P::GranularSpread, 3, 0.7f);
+    engine.setParameter(P::GranularMorph, 3, 0.5f);
+    engine.setParameter(P::GranularFilterResonance, 0, 0.6f);
+    engine.setParameter(P::LooperRate, 1, 0.6f);
+    for (int k = 0; k < 20; ++k) {
+        const double t = k * 0.1;
+        const float x = static_cast<float>(k) / 19.0f;
+        engine.scheduleParameter(P::GranularFilterModel, 0, static_cast<float>(k % 10) / 9.0f, at(t));
+        engine.scheduleParameter(P::GranularFilterCutoff, 0, 0.3f + 0.6f * x, at(t + 0.05));
+        engine.scheduleParameter(P::GranularFilterCutoff, 3, 0.9f - 0.5f * x, at(t + 0.05));
+        engine.scheduleParameter(P::GranularEnvelope, 3, static_cast<float>(k % 8) / 7.0f, at(t));
+        engine.scheduleParameter(P::GranularPitch, 3, static_cast<float>((k % 5) - 2) * 0.1f + 0.5f, at(t));
+    }
+    return true;
+}
+
+// Drum sequencer lanes and the DaisyDrum voice stepping through its engines
+bool sceneDrums(AudioEngine& engine, const SceneContext&) {
+    const uint8_t lanes[4] = {AudioEngine::TargetDrumLane0, AudioEngine::TargetDrumLane1,
+                              AudioEngine::TargetDrumLane2, AudioEngine::TargetDrumLane3};
+    for (int step = 0; step < 16; ++step) {
+        const double t = 0.01 + step * 0.125;
+        uint8_t mask = lanes[3];
+        if (step % 4 == 0) mask |= lanes[0];
+        if (step % 8 == 6) mask |= lanes[1];
+        if (step % 4 == 2) mask |= lanes[2];
+        engine.scheduleNoteOnTarget(36, 110, at(t), mask);
+        engine.scheduleNoteOffTarget(36, at(t + 0.02), mask);
+
+        engine.scheduleParameter(P::DaisyDrumEngine, 0, static_cast<float>(step % 5) / 4.0f, at(t) - 1);
+        engine.scheduleNoteOnTarget(40 + step, 100, at(t + 0.06), AudioEngine::TargetDaisyDrum);
+        engine.scheduleNoteOffTarget(40 + step, at(t + 0.08), AudioEngine::TargetDaisyDrum);
+    }
+    return true;
+}
+
+// SFZ instrument written to the scratch directory: three key zones, two
+// velocity layers, looped and one-shot regions, played as overlapping chords.
+// sample= comes last on each line; the parser reads it to the end of the line.
+bool sceneSampler(AudioEngine& engine, const SceneContext& context) {
+    const std::filesystem::path dir = context.scratchDir / "sampler";
+    std::filesystem::create_directories(dir);
+    const struct { const char* file; double frequency; } samples[] = {
+        {"c3.wav", 130.81}, {"c4.wav", 261.63}, {"c5.wav", 523.25}, {"c4_soft.wav", 261.63},
+    };
+    for (const auto& s : samples) {
+        if (!tools::writeSampleWav(dir / s.file, kSampleRate, s.frequency, 1.0, kSfzSampleDecay)) return false;
+    }
+
+    const std::filesystem::path sfzPath = dir / "regression.sfz";
+    FILE* sfz = std::fopen(sfzPath.string().c_str(), "w");
+    if (!sfz) return false;
+    std::fputs("<global> ampeg_attack=0.005 ampeg_release=0.2\n"
+               "<region> lokey=0 hikey=54 pitch_keycenter=48 loop_mode=loop_continuous loop_start=4800 loop_end=24000 sample=c3.wav\n"
+               "<region> lokey=55 hikey=66 pitch_keycenter=60 lovel=64 hivel=127 sample=c4.wav\n"
+               "<region> lokey=55 hikey=66 pitch_keycenter=60 lovel=0 hivel=63 volume=-6 sample=c4_soft.wav\n"
+               "<region> lokey=67 hikey=127 pitch_keycenter=72 loop_mode=one_shot pan=30 sample=c5.wav\n",
+               sfz);
+    std::fclose(sfz);
+    if (!engine.loadSfzFile(sfzPath.string().c_str())) return false;
+
+    for (int k = 0; k < 8; ++k) {
+        const double t = 0.02 + k * 0.24;
+        const int root = 48 + (k * 5) % 19;
+        for (int n = 0; n < 4; ++n) {
+            const int note = root + n * 4;
+            engine.scheduleNoteOnTarget(note, 40 + 25 * n, at(t + n * 0.005), AudioEngine::TargetSampler);
+            engine.scheduleNoteOffTarget(note, at(t + 0.35), AudioEngine::TargetSampler);
+        }
+    }
+    return true;
+}
+
+// Long samples streamed from disk, pitched up two to three octaves in dense
+// chords, so each block reads far past the head and the I/O thread has
+// several hundred thousand frames to decode per block of the bounce
+bool sceneSamplerStreamed(AudioEngine& engine, const SceneContext& context) {
+    engine.setSamplerStreamingEnabled(true);
+    const std::filesystem::path dir = context.scratchDir / "sampler_streamed";
+    std::filesystem::create_directories(dir);
+    if (!tools::writeSampleWav(dir / "long.wav", kSampleRate, 32.70, 8.0, kSfzSampleDecay)) return false;
+
+    const std::filesystem::path sfzPath = dir / "streamed.sfz";
+    FILE* sfz = std::fopen(sfzPath.string().c_str(), "w");
+    if (!sfz) return false;
+    std::fputs("<region> pitch_keycenter=36 ampeg_attack=0.002 ampeg_release=0.1 sample=long.wav\n", sfz);
+    std::fclose(sfz);
+    if (!engine.loadSfzFile(sfzPath.string().c_str())) return false;
+
+    for (int k = 0; k < 2; ++k) {
+        const double t = 0.02 + k * 0.9;
+        for (int n = 0; n < 13; ++n) {
+            const int note = 60 + n;
+            engine.scheduleNoteOnTarget(note, 60 + 4 * n, at(t + n * 0.002), AudioEngine::TargetSampler);
+            engine.scheduleNoteOffTarget(note, at(t + 0.8), AudioEngine::TargetSampler);
+        }
+    }
+    return true;
+}
+
+// Everything through the sends and master: tape delay with wow/flutter,
+// reverb, master filter model changes and the compressor
+bool sceneEffectsMaster(AudioEngine& engine, const SceneContext& context) {
+    if (!sceneGranular(engine, context)) return false;
+    engine.setPlaitsVoiceCount(2);
+    for (int k = 0; k < 8; ++k) {
+        const double t = 0.05 + k * 0.25;
+        engine.scheduleNoteOnTarget(60 + (k * 7) % 12, 100, at(t), AudioEngine::TargetPlaits);
+        engine.scheduleNoteOffTarget(60 + (k * 7) % 12, at(t + 0.1), AudioEngine::TargetPlaits);
+        engine.scheduleNoteOnTarget(36, 110, at(t), AudioEngine::TargetDrumLane0 | AudioEngine::TargetDrumLane3);
+        engine.scheduleNoteOffTarget(36, at(t + 0.02), AudioEngine::TargetDrumLane0 | AudioEngine::TargetDrumLane3);
+        engine.scheduleParameter(P::MasterFilterModel, 0, static_cast<float>(k) / 9.0f, at(t + 0.1));
+    }
+    for (int c = 0; c < 8; ++c) {
+        engine.setParameter(P::VoiceSend, c, 0.5f);
+    }
+    engine.setParameter(P::DelayMix, 0, 0.4f);
+    engine.setParameter(P::DelayFeedback, 0, 0.6f);
+    engine.setParameter(P::DelayWow, 0, 0.7f);
+    engine.setParameter(P::DelayFlutter, 0, 0.5f);
+    engine.setParameter(P::ReverbMix, 0, 0.35f);
+    engine.setParameter(P::ReverbSize, 0, 0.8f);
+    engine.setParameter(P::MasterFilterCutoff, 0, 0.6f);
+    engine.setParameter(P::MasterFilterResonance, 0, 0.5f);
+    engine.setParameter(P::MasterCompEnabled, 0, 1.0f);
+    engine.setParameter(P::MasterCompThreshold, 0, 0.6f);
+    engine.setParameter(P::MasterCompRatio, 0, 0.4f);
+    for (int k = 0; k < 20; ++k) {
+        engine.scheduleParameter(P::DelayTime, 0, 0.2f + 0.03f * k, at(k * 0.1));
+        engine.scheduleParameter(P::MasterFilterCutoff, 0, 0.5f + 0.02f * k, at(k * 0.1 + 0.05));
+    }
+    return true;
+}
+
+// One short Plaits hit into a two-second synced delay with no feedback: the
+// echo has to come back after the send and the wet output have both gone quiet
+bool sceneDelayTail(AudioEngine& engine, const SceneContext&) {
+    engine.setParameter(P::PlaitsLPGDecay, 0, 0.0f);
+    engine.scheduleNoteOnTarget(60, 110, at(0.05), AudioEngine::TargetPlaits);
+    engine.scheduleNoteOffTarget(60, at(0.1), AudioEngine::TargetPlaits);
+    engine.setParameter(P::VoiceSend, 0, 1.0f);
+    engine.setParameter(P::DelayMix, 0, 1.0f);
+    engine.setParameter(P::DelayFeedback, 0, 0.0f);
+    engine.setParameter(P::DelaySync, 0, 1.0f);
+    engine.setParameter(P::DelayTempo, 0, 0.0f);        // 60 BPM
+    engine.setParameter(P::DelaySubdivision, 0, 0.0f);  // Two beats
+    engine.setParameter(P::ReverbMix, 0, 0.0f);
+    return true;
+}
+
+const Scene kScenes[] = {
+    {"plaits_chords", 2.0, kDefaultToleranceDb, scenePlaitsChords},
+    {"rings", 2.0, kDefaultToleranceDb, sceneRings},
+    {"granular", 2.0, kDefaultToleranceDb, sceneGranular},
+    {"drums", 2.0, kDefaultToleranceDb, sceneDrums},
+    {"sampler", 2.0, kDefaultToleranceDb, sceneSampler},
+    {"effects_master", 2.0, kDefaultToleranceDb, sceneEffectsMaster},
+    {"delay_tail", 3.0, kDefaultToleranceDb, sceneDelayTail},
+    // The drum lanes repeat their hits, so a cache that was not bypassed would
+    // start playing background renders partway through
+    {"drums_offline", 2.0, kDefaultToleranceDb, sceneDrums, true},
+    // A bounce outruns the streaming I/O thread unless it waits for it
+    {"stream_offline", 2.0, kDefaultToleranceDb, sceneSamplerStreamed, true},
+};
+
+// ---- Rendering and comparison ----
+
+struct Render {
+    std::vector<float> interleaved;
+    double seconds = 0.0;  // Wall time spent in process() or renderOffline()
+    uint64_t starvations = 0;  // Sampler blocks that played unstreamed frames as silence
+};
+
+bool readWav(const std::filesystem::path& path, std::vector<float>& interleaved) {
+    unsigned int channels = 0;
+    unsigned int sampleRate = 0;
+    drwav_uint64 frames = 0;
+    float* data = drwav_open_file_and_read_pcm_frames_f32(path.string().c_str(), &channels, &sampleRate, &frames, nullptr);
+    if (!data) return false;
+    const bool ok = channels == 2 && sampleRate == kSampleRate;
+    if (ok) interleaved.assign(data, data + frames * 2);
+    drwav_free(data, nullptr);
+    return ok;
+}
+
+bool renderScene(const Scene& scene, const SceneContext& context, int workers, Render& out) {
+    // Every shared random source starts from the same state for every scene
+    std::srand(kSeed);
+    stmlib::Random::Seed(kSeed);
+
+    auto engine = std::make_unique<AudioEngine>();
+    if (!engine->initialize(kSampleRate, kBlockSize)) return false;
+    if (workers >= 0) engine->setRenderWorkerCount(workers);
+    // Cached drum hits land whenever the background renderer finishes them;
+    // an offline bounce has to bypass the cache by itself
+    if (!scene.offline) engine->setDrumHitCacheEnabled(false);
+    if (!scene.setup(*engine, context)) return false;
+
+    const size_t frames = static_cast<size_t>(scene.seconds * kSampleRate);
+    if (scene.offline) {
+        const std::filesystem::path path = context.scratchDir / (std::string(scene.name) + "_bounce.wav");
+        const auto start = std::chrono::steady_clock::now();
+        const bool ok = engine->renderOffline(path.string().c_str(), frames, 32);
+        out.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        out.starvations = engine->getSamplerStreamStarvationCount();
+        engine->shutdown();
+        return ok && readWav(path, out.interleaved);
+    }
+
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+    float* outputs[2] = {left.data(), right.data()};
+    out.interleaved.assign(frames * 2, 0.0f);
+    out.seconds = 0.0;
+
+    for (size_t offset = 0; offset < frames; offset += kBlockSize) {
+        const int n = static_cast<int>(std::min<size_t>(kBlockSize, frames - offset));
+        const auto start = std::chrono::steady_clock::now();
+        engine->process(nullptr, outputs, 2, n);
+        out.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (int i = 0; i < n; ++i) {
+            out.interleaved[2 * (offset + i)] = left[i];
+            out.interleaved[2 * (offset + i) + 1] = right[i];
+        }
+    }
+    engine->shutdown();
+    return true;
+}
+
+int16_t toPcm16(float sample) {
+    return static_cast<int16_t>(std::lround(std::clamp(sample, -1.0f, 32767.0f / 32768.0f) * 32768.0f));
+}
+
+bool writeWav16(const std::filesystem::path& path, const std::vector<float>& interleaved) {
+    drwav_data_format format{};
+    format.container = drwav_container_riff;
+    format.format = DR_WAVE_FORMAT_PCM;
+    format.channels = 2;
+    format.sampleRate = kSampleRate;
+    format.bitsPerSample = 16;
+
+    drwav wav;
+    if (!drwav_init_file_write(&wav, path.string().c_str(), &format, nullptr)) return false;
+    std::vector<int16_t> pcm(interleaved.size());
+    for (size_t i = 0; i < interleaved.size(); ++i) {
+        pcm[i] = toPcm16(interleaved[i]);
+    }
+    const drwav_uint64 frames = interleaved.size() / 2;
+    const bool ok = drwav_write_pcm_frames(&wav, frames, pcm.data()) == frames;
+    drwav_uninit(&wav);
+    return ok;
+}
+
+struct Comparison {
+    double snrDb = 0.0;
+    double maxDiff = 0.0;
+};
+
+// SNR of the render against the golden. The render is rounded to 16 bits as
+// the golden was, so an unchanged engine compares as identical (infinite SNR).
+Comparison compare(const std::vector<float>& golden, const std::vector<float>& actual) {
+    Comparison result;
+    double signal = 0.0;
+    double noise = 0.0;
+    const size_t n = std::min(golden.size(), actual.size());
+    for (size_t i = 0; i < n; ++i) {
+        const double quantized = toPcm16(actual[i]) / 32768.0;
+        const double diff = quantized - golden[i];
+        signal += static_cast<double>(golden[i]) * golden[i];
+        noise += diff * diff;
+        result.maxDiff = std::max(result.maxDiff, std::fabs(diff));
+    }
+    if (golden.size() != actual.size()) {
+        result.snrDb = -INFINITY;
+    } else if (noise == 0.0) {
+        result.snrDb = INFINITY;
+    } else {
+        result.snrDb = signal > 0.0 ? 10.0 * std::log10(signal / noise) : -INFINITY;
+    }
+    return result;
+}
+
+struct Options {
+    std::filesystem::path goldens = "Tools/goldens";
+    std::filesystem::path outDir;
+    std::string jsonPath;
+    std::string scene;
+    int repeat = 1;
+    int workers = -1;  // -1 keeps the engine's default
+    bool update = false;
+};
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--update") {
+            options.update = true;
+        } else if (arg == "--goldens" && hasValue) {
+            options.goldens = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            options.outDir = argv[++i];
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--scene" && hasValue) {
+            options.scene = argv[++i];
+        } else if (arg == "--repeat" && hasValue) {
+            options.repeat = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--workers" && hasValue) {
+            options.workers = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "usage: %s [--goldens dir] [--scene name] [--repeat N] [--workers N] "
+                                 "[--update] [--out dir] [--json file]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct SceneResult {
+    const char* name;
+    const char* status;
+    double snrDb;
+    double maxDiff;
+    double nsPerSample;
+    double realtimeFactor;
+};
+
+void writeJson(const std::string& path, const std::vector<SceneResult>& results) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) {
+        std::fprintf(stderr, "cannot write %s\n", path.c_str());
+        return;
+    }
+    std::fprintf(f, "{\n  \"sampleRate\": %d,\n  \"blockSize\": %d,\n  \"scenes\": [\n", kSampleRate, kBlockSize);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const SceneResult& r = results[i];
+        // JSON has no infinities; an exact match is reported as null
+        char snr[32];
+        if (std::isfinite(r.snrDb)) std::snprintf(snr, sizeof(snr), "%.2f", r.snrDb);
+        else std::snprintf(snr, sizeof(snr), "null");
+        std::fprintf(f, "    {\"name\": \"%s\", \"status\": \"%s\", \"snrDb\": %s, \"maxDiff\": %.3g, "
+                        "\"nsPerSample\": %.2f, \"realtimeFactor\": %.4f}%s\n",
+                     r.name, r.status, snr, r.maxDiff, r.nsPerSample, r.realtimeFactor,
+                     i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    std::fclose(f);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) return 2;
+
+    SceneContext context;
+    context.scratchDir = std::filesystem::temp_directory_path() / "grainulator_render_regression";
+    std::filesystem::create_directories(context.scratchDir);
+    if (options.update) std::filesystem::create_directories(options.goldens);
+    if (!options.outDir.empty()) std::filesystem::create_directories(options.outDir);
+
+    std::vector<SceneResult> results;
+    int failures = 0;
+
+    std::printf("%-16s %8s %10s %10s %10s %8s\n", "scene", "status", "SNR dB", "max diff", "ns/sample", "x RT");
+    for (const Scene& scene : kScenes) {
+        if (!options.scene.empty() && options.scene != scene.name) continue;
+
+        SceneResult result{scene.name, "ok", 0.0, 0.0, 0.0, 0.0};
+        Render render;
+        double bestSeconds = INFINITY;
+        for (int run = 0; run < options.repeat; ++run) {
+            Render current;
+            if (!renderScene(scene, context, options.workers, current)) {
+                result.status = "ERROR";
+                break;
+            }
+            if (run == 0) {
+                render.interleaved = current.interleaved;
+            } else if (current.interleaved != render.interleaved) {
+                result.status = "NONDET";  // Same seeds, different output
+            }
+            if (current.starvations != 0) {
+                result.status = "STARVED";  // A bounce must wait for the disk
+            }
+            bestSeconds = std::min(bestSeconds, current.seconds);
+        }
+
+        if (std::strcmp(result.status, "ERROR") != 0) {
+            // Per output sample (frame), the unit the render profiler reports
+            const double frames = static_cast<double>(render.interleaved.size() / 2);
+            result.nsPerSample = bestSeconds * 1.0e9 / frames;
+            result.realtimeFactor = bestSeconds / scene.seconds;
+
+            const std::filesystem::path goldenPath = options.goldens / (std::string(scene.name) + ".wav");
+            if (!options.outDir.empty()) {
+                writeWav16(options.outDir / (std::string(scene.name) + ".wav"), render.interleaved);
+            }
+            if (options.update) {
+                if (!writeWav16(goldenPath, render.interleaved)) result.status = "ERROR";
+                else if (std::strcmp(result.status, "ok") == 0) result.status = "updated";
+            } else {
+                std::vector<float> golden;
+                if (!readWav(goldenPath, golden)) {
+                    result.status = "MISSING";
+                } else {
+                    const Comparison c = compare(golden, render.interleaved);
+                    result.snrDb = c.snrDb;
+                    result.maxDiff = c.maxDiff;
+                    if (c.snrDb < scene.toleranceDb && std::strcmp(result.status, "ok") == 0) {
+                        result.status = "FAIL";
+                    }
+                }
+            }
+        }
+
+        const bool passed = std::strcmp(result.status, "ok") == 0 || std::strcmp(result.status, "updated") == 0;
+        failures += passed ? 0 : 1;
+        std::printf("%-16s %8s %10.2f %10.3g %10.1f %8.4f\n", result.name, result.status, result.snrDb,
+                    result.maxDiff, result.nsPerSample, result.realtimeFactor);
+        results.push_back(result);
+    }
+
+    if (results.empty()) {
+        std::fprintf(stderr, "no scene named %s\n", options.scene.c_str());
+        return 2;
+    }
+    if (!options.jsonPath.empty()) writeJson(options.jsonPath, results);
+
+    std::printf("\n%s\n", failures == 0 ? "all scenes match" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
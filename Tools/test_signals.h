@@ -0,0 +1,72 @@
+//
+//  test_signals.h
+//  Grainulator
+//
+//  Deterministic test material shared by the command-line tools: a seeded
+//  white-noise generator and a 16-bit WAV of decaying harmonics for the
+//  sampler. render_regression's goldens depend on both, so changing either
+//  means re-recording them (render_regression --update).
+//
+
+#ifndef GRAINULATOR_TOOLS_TEST_SIGNALS_H
+#define GRAINULATOR_TOOLS_TEST_SIGNALS_H
+
+#include "dr_wav.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Grainulator {
+namespace tools {
+
+// Uniform white noise in [-1, 1) from a 32-bit LCG; the same seed gives the
+// same sequence on every platform
+class NoiseGenerator {
+public:
+    explicit NoiseGenerator(uint32_t seed = 1) : state_(seed) {}
+
+    float next() {
+        state_ = state_ * 1664525u + 1013904223u;
+        return static_cast<float>(state_ >> 8) / 16777216.0f * 2.0f - 1.0f;
+    }
+
+private:
+    uint32_t state_;
+};
+
+// Mono 16-bit WAV of six harmonics of `frequency`; harmonic h decays as
+// exp(-t * h * decay)
+inline bool writeSampleWav(const std::filesystem::path& path, int sampleRate, double frequency,
+                           double seconds, double decay) {
+    drwav_data_format format{};
+    format.container = drwav_container_riff;
+    format.format = DR_WAVE_FORMAT_PCM;
+    format.channels = 1;
+    format.sampleRate = static_cast<drwav_uint32>(sampleRate);
+    format.bitsPerSample = 16;
+
+    drwav wav;
+    if (!drwav_init_file_write(&wav, path.string().c_str(), &format, nullptr)) return false;
+    const size_t frames = static_cast<size_t>(seconds * sampleRate);
+    std::vector<int16_t> pcm(frames);
+    const double twoPi = 6.283185307179586;
+    for (size_t i = 0; i < frames; ++i) {
+        const double t = static_cast<double>(i) / sampleRate;
+        double v = 0.0;
+        for (int h = 1; h <= 6; ++h) {
+            v += std::sin(twoPi * frequency * h * t) * std::exp(-t * h * decay) / h;
+        }
+        pcm[i] = static_cast<int16_t>(std::lround(std::clamp(v * 0.5, -1.0, 1.0) * 32767.0));
+    }
+    const bool ok = drwav_write_pcm_frames(&wav, frames, pcm.data()) == frames;
+    drwav_uninit(&wav);
+    return ok;
+}
+
+} // namespace tools
+} // namespace Grainulator
+
+#endif